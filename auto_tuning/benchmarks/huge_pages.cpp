@@ -0,0 +1,244 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compares the throughput of a neighbor-integration-like sweep with the cell data in regular
+// (4 KiB) pages against the cell data in a huge-page arena (as used with SEISSOL_HUGE_PAGES=1).
+//
+// As in the neighbor integration, each cell reads the time-integrated buffers of its four face
+// neighbors through the faceNeighbors pointers, multiplies them with a (cached) flux matrix and
+// its own flux solver per face, and adds the result to its degrees of freedom. The cells are
+// ordered along a structured grid; hence, the neighbors in z direction are far away in memory,
+// which makes the sweep sensitive to TLB misses.
+
+#include "Initializer/HugePageArena.h"
+#include "Initializer/MemoryAllocator.h"
+#include "Monitoring/Unit.h"
+
+#include <utils/args.h>
+#include <utils/logger.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <sys/mman.h>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+struct Sizes {
+  std::size_t basis;
+  std::size_t quantities;
+
+  [[nodiscard]] std::size_t dofs() const { return basis * quantities; }
+  [[nodiscard]] std::size_t fluxSolver() const { return quantities * quantities; }
+};
+
+struct CellData {
+  double* dofs;
+  double* buffers;
+  double* fluxSolvers;
+  double* (*faceNeighbors)[4];
+};
+
+CellData allocateCellData(std::size_t numCells,
+                          const Sizes& sizes,
+                          seissol::memory::ManagedAllocator& allocator,
+                          seissol::memory::Memkind memkind) {
+  const auto allocate = [&](std::size_t bytes) {
+    void* data = allocator.allocateMemory(bytes, 64, memkind);
+#ifdef MADV_NOHUGEPAGE
+    if (memkind == seissol::memory::Standard) {
+      // keep transparent huge pages away from the baseline
+      const auto address = reinterpret_cast<std::uintptr_t>(data);
+      const auto pageBegin = (address + 4095) / 4096 * 4096;
+      if (pageBegin < address + bytes) {
+        madvise(
+            reinterpret_cast<void*>(pageBegin), address + bytes - pageBegin, MADV_NOHUGEPAGE);
+      }
+    }
+#endif
+    return data;
+  };
+  CellData data{};
+  data.dofs = static_cast<double*>(allocate(numCells * sizes.dofs() * sizeof(double)));
+  data.buffers = static_cast<double*>(allocate(numCells * sizes.dofs() * sizeof(double)));
+  data.fluxSolvers =
+      static_cast<double*>(allocate(numCells * 4 * sizes.fluxSolver() * sizeof(double)));
+  data.faceNeighbors =
+      static_cast<double* (*)[4]>(allocate(numCells * sizeof(*data.faceNeighbors)));
+  return data;
+}
+
+/**
+ * The cells of an n x n x n grid in lexicographic order; each cell has the neighbors in x
+ * direction and (alternating) one of the neighbors in y and z direction, with periodic wrapping.
+ */
+void initialize(CellData& data, std::size_t n, const Sizes& sizes) {
+  const auto numCells = n * n * n;
+  const auto cellId = [n](std::size_t i, std::size_t j, std::size_t k) {
+    return (i % n) + n * ((j % n) + n * (k % n));
+  };
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t cell = 0; cell < numCells; ++cell) {
+    const std::size_t i = cell % n;
+    const std::size_t j = (cell / n) % n;
+    const std::size_t k = cell / (n * n);
+    const std::size_t shift = (cell % 2 == 0) ? 1 : n - 1;
+    const std::array<std::size_t, 4> neighbors = {cellId(i + 1, j, k),
+                                                  cellId(i + n - 1, j, k),
+                                                  cellId(i, j + shift, k),
+                                                  cellId(i, j, k + shift)};
+    for (int face = 0; face < 4; ++face) {
+      data.faceNeighbors[cell][face] = data.buffers + neighbors[face] * sizes.dofs();
+    }
+    for (std::size_t dof = 0; dof < sizes.dofs(); ++dof) {
+      data.dofs[cell * sizes.dofs() + dof] = 0.0;
+      data.buffers[cell * sizes.dofs() + dof] = 1.0e-3 * static_cast<double>(dof % 7);
+    }
+    for (std::size_t entry = 0; entry < 4 * sizes.fluxSolver(); ++entry) {
+      data.fluxSolvers[cell * 4 * sizes.fluxSolver() + entry] =
+          1.0e-2 * static_cast<double>(entry % 5);
+    }
+  }
+}
+
+void sweep(const CellData& data,
+           std::size_t numCells,
+           const Sizes& sizes,
+           const std::vector<double>& fluxMatrices) {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+  {
+    std::vector<double> projected(sizes.dofs());
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+    for (std::size_t cell = 0; cell < numCells; ++cell) {
+      double* dofs = data.dofs + cell * sizes.dofs();
+      for (int face = 0; face < 4; ++face) {
+        const double* neighbor = data.faceNeighbors[cell][face];
+        const double* flux = fluxMatrices.data() + face * sizes.basis * sizes.basis;
+        const double* fluxSolver = data.fluxSolvers + (cell * 4 + face) * sizes.fluxSolver();
+
+        // projected = flux * neighbor (basis x quantities, column-major)
+        std::fill(projected.begin(), projected.end(), 0.0);
+        for (std::size_t q = 0; q < sizes.quantities; ++q) {
+          for (std::size_t l = 0; l < sizes.basis; ++l) {
+            const double value = neighbor[q * sizes.basis + l];
+            for (std::size_t b = 0; b < sizes.basis; ++b) {
+              projected[q * sizes.basis + b] += flux[l * sizes.basis + b] * value;
+            }
+          }
+        }
+        // dofs += projected * fluxSolver
+        for (std::size_t p = 0; p < sizes.quantities; ++p) {
+          for (std::size_t q = 0; q < sizes.quantities; ++q) {
+            const double value = fluxSolver[p * sizes.quantities + q];
+            for (std::size_t b = 0; b < sizes.basis; ++b) {
+              dofs[p * sizes.basis + b] += projected[q * sizes.basis + b] * value;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+double run(const char* name,
+           std::size_t n,
+           const Sizes& sizes,
+           std::size_t iterations,
+           const std::vector<double>& fluxMatrices,
+           seissol::memory::Memkind memkind) {
+  const auto numCells = n * n * n;
+  seissol::memory::ManagedAllocator allocator;
+  auto data = allocateCellData(numCells, sizes, allocator, memkind);
+
+  auto start = Clock::now();
+  initialize(data, n, sizes);
+  const auto initTime = secondsSince(start);
+
+  sweep(data, numCells, sizes, fluxMatrices);
+  start = Clock::now();
+  for (std::size_t iteration = 0; iteration < iterations; ++iteration) {
+    sweep(data, numCells, sizes, fluxMatrices);
+  }
+  const auto time = secondsSince(start);
+
+  const auto cellsPerSecond = static_cast<double>(numCells * iterations) / time;
+  logInfo() << name << ": initialized in" << initTime << "s;" << cellsPerSecond
+            << "cell updates/s (" << time / static_cast<double>(iterations) << "s per sweep).";
+  if (memkind == seissol::memory::HugePages) {
+    const auto statistics = allocator.hugePageStatistics();
+    const auto& perKind = statistics.mappedBytesPerKind;
+    using PageKind = seissol::memory::HugePageArena::PageKind;
+    logInfo() << "Arena:" << statistics.allocations << "allocations,"
+              << seissol::UnitByte.formatPrefix(statistics.usedBytes).c_str() << "used of"
+              << seissol::UnitByte.formatPrefix(statistics.mappedBytes).c_str() << "in"
+              << statistics.blocks << "blocks (1 GiB pages:"
+              << seissol::UnitByte.formatPrefix(perKind[static_cast<int>(PageKind::HugeTlb1G)])
+                     .c_str()
+              << ", 2 MiB pages:"
+              << seissol::UnitByte.formatPrefix(perKind[static_cast<int>(PageKind::HugeTlb2M)])
+                     .c_str()
+              << ", transparent huge pages:"
+              << seissol::UnitByte.formatPrefix(perKind[static_cast<int>(PageKind::Transparent)])
+                     .c_str()
+              << ").";
+  }
+  return cellsPerSecond;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  utils::Args args("Benchmarks a neighbor-integration-like sweep with and without huge pages.");
+  args.addOption("cells", 'c', "Number of cells (default: 500000)", utils::Args::Required, false);
+  args.addOption("basis",
+                 'b',
+                 "Number of (aligned) basis functions (default: 24, i.e. order 4)",
+                 utils::Args::Required,
+                 false);
+  args.addOption(
+      "quantities", 'q', "Number of quantities (default: 9)", utils::Args::Required, false);
+  args.addOption(
+      "iterations", 'i', "Number of sweeps (default: 10)", utils::Args::Required, false);
+  if (args.parse(argc, argv) != utils::Args::Success) {
+    return -1;
+  }
+  const auto numCells = args.getArgument<std::size_t>("cells", 500000);
+  const Sizes sizes{args.getArgument<std::size_t>("basis", 24),
+                    args.getArgument<std::size_t>("quantities", 9)};
+  const auto iterations =
+      std::max<std::size_t>(1, args.getArgument<std::size_t>("iterations", 10));
+
+  const auto n =
+      std::max<std::size_t>(2, static_cast<std::size_t>(std::cbrt(static_cast<double>(numCells))));
+  logInfo() << "Running on" << n * n * n << "cells with" << sizes.basis << "basis functions and"
+            << sizes.quantities << "quantities.";
+
+  std::vector<double> fluxMatrices(4 * sizes.basis * sizes.basis);
+  for (std::size_t entry = 0; entry < fluxMatrices.size(); ++entry) {
+    fluxMatrices[entry] = 1.0e-2 * static_cast<double>(entry % 11);
+  }
+
+  const auto regular =
+      run("4 KiB pages", n, sizes, iterations, fluxMatrices, seissol::memory::Standard);
+  const auto huge =
+      run("Huge pages", n, sizes, iterations, fluxMatrices, seissol::memory::HugePages);
+  logInfo() << "Speedup with huge pages:" << huge / regular;
+  return 0;
+}
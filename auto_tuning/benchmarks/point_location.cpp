@@ -0,0 +1,216 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Compares the point location with the bounding volume hierarchy (as used by findMeshIds) against
+// testing every point against every element. The latter is O(elements x points); hence, it runs
+// on a subset of the points only, and its time is extrapolated to all points.
+
+#include "Geometry/MeshDefinition.h"
+#include "Geometry/MeshTools.h"
+#include "Geometry/TetrahedronBvh.h"
+#include "Initializer/PointMapper.h"
+
+#include <utils/args.h>
+#include <utils/logger.h>
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double secondsSince(Clock::time_point start) {
+  return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/**
+ * Unit cube, divided into n^3 cubes with six (positively oriented) tetrahedra each.
+ * The vertices are perturbed, s.t. the elements are not aligned with the axes.
+ */
+std::pair<std::vector<seissol::Vertex>, std::vector<seissol::Element>>
+    generateMesh(std::size_t numElements) {
+  const auto n = std::max<std::size_t>(
+      1, static_cast<std::size_t>(std::cbrt(static_cast<double>(numElements) / 6.0)));
+  const double h = 1.0 / static_cast<double>(n);
+  const auto vertexId = [n](std::size_t i, std::size_t j, std::size_t k) {
+    return static_cast<int>(i + (n + 1) * (j + (n + 1) * k));
+  };
+
+  std::vector<seissol::Vertex> vertices((n + 1) * (n + 1) * (n + 1));
+  std::mt19937 generator(1);
+  std::uniform_real_distribution<double> perturbation(-0.2 * h, 0.2 * h);
+  for (std::size_t k = 0; k <= n; ++k) {
+    for (std::size_t j = 0; j <= n; ++j) {
+      for (std::size_t i = 0; i <= n; ++i) {
+        auto& coords = vertices[vertexId(i, j, k)].coords;
+        const std::array<std::size_t, 3> index = {i, j, k};
+        for (int d = 0; d < 3; ++d) {
+          const bool boundary = index[d] == 0 || index[d] == n;
+          coords[d] =
+              static_cast<double>(index[d]) * h + (boundary ? 0.0 : perturbation(generator));
+        }
+      }
+    }
+  }
+
+  // the path along the cube edges given by the permutation; odd permutations flip the orientation
+  const int permutations[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+  const bool odd[6] = {false, true, true, false, false, true};
+  std::vector<seissol::Element> elements(6 * n * n * n);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t cube = 0; cube < n * n * n; ++cube) {
+    const std::size_t i = cube % n;
+    const std::size_t j = (cube / n) % n;
+    const std::size_t k = cube / (n * n);
+    for (int p = 0; p < 6; ++p) {
+      auto& element = elements[6 * cube + p];
+      std::array<std::size_t, 3> corner = {i, j, k};
+      element.vertices[0] = vertexId(corner[0], corner[1], corner[2]);
+      for (int step = 0; step < 3; ++step) {
+        ++corner[permutations[p][step]];
+        element.vertices[step + 1] = vertexId(corner[0], corner[1], corner[2]);
+      }
+      if (odd[p]) {
+        std::swap(element.vertices[2], element.vertices[3]);
+      }
+      element.localId = static_cast<int>(6 * cube + p);
+    }
+  }
+  return {std::move(vertices), std::move(elements)};
+}
+
+/**
+ * Tests all points against all elements, as findMeshIds did before the bounding volume hierarchy.
+ */
+void bruteForce(const std::vector<Eigen::Vector3d>& points,
+                const std::vector<seissol::Vertex>& vertices,
+                const std::vector<seissol::Element>& elements,
+                short* contained,
+                unsigned* meshIds) {
+  std::fill_n(contained, points.size(), 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t elem = 0; elem < elements.size(); ++elem) {
+    std::array<std::array<double, 4>, 4> planeEquations{};
+    for (int face = 0; face < 4; ++face) {
+      seissol::VrtxCoords n{};
+      seissol::VrtxCoords p{};
+      seissol::MeshTools::pointOnPlane(elements[elem], face, vertices, p);
+      seissol::MeshTools::normal(elements[elem], face, vertices, n);
+      planeEquations[face] = {n[0], n[1], n[2], -seissol::MeshTools::dot(n, p)};
+    }
+    for (std::size_t point = 0; point < points.size(); ++point) {
+      int notInside = 0;
+      for (int face = 0; face < 4; ++face) {
+        const double resultFace = planeEquations[face][0] * points[point](0) +
+                                  planeEquations[face][1] * points[point](1) +
+                                  planeEquations[face][2] * points[point](2) +
+                                  planeEquations[face][3];
+        notInside += (resultFace > 0.0) ? 1 : 0;
+      }
+      if (notInside == 0) {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        {
+          const auto localId = static_cast<unsigned>(elements[elem].localId);
+          if (contained[point] == 0 || meshIds[point] > localId) {
+            contained[point] = 1;
+            meshIds[point] = localId;
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+  utils::Args args("Benchmarks the point location in a tetrahedral mesh, with and without the "
+                   "bounding volume hierarchy.");
+  args.addOption(
+      "elements", 'e', "Number of elements (default: 10000000)", utils::Args::Required, false);
+  args.addOption(
+      "points", 'p', "Number of points (default: 100000)", utils::Args::Required, false);
+  args.addOption("brute-force-points",
+                 'b',
+                 "Number of points for the brute-force search (default: 100)",
+                 utils::Args::Required,
+                 false);
+  if (args.parse(argc, argv) != utils::Args::Success) {
+    return -1;
+  }
+  const auto numElements = args.getArgument<std::size_t>("elements", 10000000);
+  const auto numPoints = args.getArgument<std::size_t>("points", 100000);
+  const auto numBruteForcePoints =
+      std::min(numPoints, args.getArgument<std::size_t>("brute-force-points", 100));
+
+  auto start = Clock::now();
+  const auto [vertices, elements] = generateMesh(numElements);
+  logInfo() << "Generated" << elements.size() << "elements in" << secondsSince(start) << "s.";
+
+  std::mt19937 generator(2);
+  // (some points are outside of the mesh)
+  std::uniform_real_distribution<double> coordinate(-0.05, 1.05);
+  std::vector<Eigen::Vector3d> points(numPoints);
+  for (auto& point : points) {
+    point = Eigen::Vector3d(coordinate(generator), coordinate(generator), coordinate(generator));
+  }
+
+  start = Clock::now();
+  const seissol::geometry::TetrahedronBvh bvh(vertices, elements);
+  const double buildTime = secondsSince(start);
+
+  std::vector<short> contained(numPoints);
+  std::vector<unsigned> meshIds(numPoints, std::numeric_limits<unsigned>::max());
+  start = Clock::now();
+  seissol::initializer::findMeshIds(
+      points.data(), bvh, numPoints, contained.data(), meshIds.data());
+  const double queryTime = secondsSince(start);
+
+  const std::vector<Eigen::Vector3d> subset(points.begin(), points.begin() + numBruteForcePoints);
+  std::vector<short> containedReference(numBruteForcePoints);
+  std::vector<unsigned> meshIdsReference(numBruteForcePoints);
+  start = Clock::now();
+  bruteForce(subset, vertices, elements, containedReference.data(), meshIdsReference.data());
+  const double bruteForceTime = secondsSince(start);
+  const double bruteForceEstimate =
+      bruteForceTime * static_cast<double>(numPoints) / static_cast<double>(numBruteForcePoints);
+
+  std::size_t numFound = 0;
+  for (const auto found : contained) {
+    numFound += found;
+  }
+  std::size_t mismatches = 0;
+  for (std::size_t point = 0; point < numBruteForcePoints; ++point) {
+    if (contained[point] != containedReference[point] ||
+        (contained[point] == 1 && meshIds[point] != meshIdsReference[point])) {
+      ++mismatches;
+    }
+  }
+
+  logInfo() << "Located" << numFound << "of" << numPoints << "points.";
+  logInfo() << "Hierarchy:" << bvh.numberOfNodes() << "nodes, built in" << buildTime
+            << "s, queried in" << queryTime << "s.";
+  logInfo() << "Brute force:" << bruteForceTime << "s for" << numBruteForcePoints
+            << "points, i.e. about" << bruteForceEstimate << "s for all points.";
+  logInfo() << "Speedup (including the build):" << bruteForceEstimate / (buildTime + queryTime);
+  if (mismatches > 0) {
+    logError() << mismatches << "points were located differently by the brute-force search.";
+  }
+  return 0;
+}
@@ -23,10 +23,25 @@ def addKernels(generator, aderdg, matricesDir, targets=['cpu']):
         xv = [Tensor(f'xv({i})', (((i+1)*(i+2)*(i+3))//6,)) for i in range(rangeLimit)]
         xf = [Tensor(f'xf({i})', (((i+1)*(i+2))//2,)) for i in range(rangeLimit)]
 
+        # all quantities of a cell at once; the layout of qv matches Q (resp. the plastic strain)
+        numberOfPstrainQuantities = 7
+        qv = Tensor('qv', (aderdg.numberOf3DBasisFunctions(), aderdg.numberOfQuantities()), alignStride=True)
+        pv = Tensor('pv', (aderdg.numberOf3DBasisFunctions(), numberOfPstrainQuantities), alignStride=True)
+        xvq = [Tensor(f'xvq({i})', (((i+1)*(i+2)*(i+3))//6, aderdg.numberOfQuantities())) for i in range(rangeLimit)]
+        xvp = [Tensor(f'xvp({i})', (((i+1)*(i+2)*(i+3))//6, numberOfPstrainQuantities)) for i in range(rangeLimit)]
+
         generator.addFamily(f'{name_prefix}projectBasisToVtkVolume',
                   simpleParameterSpace(rangeLimit),
                   lambda i: xv[i]['p'] <= vtko.byName(f'collvv({aderdg.order},{i})')['pb'] * qb['b'],
                   target=target)
+        generator.addFamily(f'{name_prefix}projectQuantitiesToVtkVolume',
+                  simpleParameterSpace(rangeLimit),
+                  lambda i: xvq[i]['pq'] <= vtko.byName(f'collvv({aderdg.order},{i})')['pb'] * qv['bq'],
+                  target=target)
+        generator.addFamily(f'{name_prefix}projectPstrainToVtkVolume',
+                  simpleParameterSpace(rangeLimit),
+                  lambda i: xvp[i]['pq'] <= vtko.byName(f'collvv({aderdg.order},{i})')['pb'] * pv['bq'],
+                  target=target)
         generator.addFamily(f'{name_prefix}projectBasisToVtkFace',
                   simpleParameterSpace(rangeLimit),
                   lambda i: xf[i]['p'] <= vtko.byName(f'collff({aderdg.order},{i})')['pb'] * pb['b'],
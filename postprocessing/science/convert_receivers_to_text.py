@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+
+# Converts the binary receiver output of SeisSol (ReceiverOutputFormat = 'binary' or 'hdf5')
+# to the legacy text layout, i.e. one <prefix>-receiver-<id>[-<rank>].dat file per receiver.
+
+import argparse
+import glob
+import re
+import struct
+
+import numpy as np
+
+MAGIC = b"SSRECV01"
+
+
+def read_uint64(f):
+    data = f.read(8)
+    if len(data) < 8:
+        raise EOFError()
+    return struct.unpack("=Q", data)[0]
+
+
+def read_binary(filename):
+    """returns the variables, the receivers (point id, position) and the sampled data
+    of each receiver of a per-rank binary receiver file"""
+    with open(filename, "rb") as f:
+        if f.read(len(MAGIC)) != MAGIC:
+            raise ValueError(f"{filename} is not a SeisSol binary receiver file")
+        dtype = {4: np.float32, 8: np.float64}[read_uint64(f)]
+        variables = []
+        for _ in range(read_uint64(f)):
+            variables.append(f.read(read_uint64(f)).decode())
+        receivers = []
+        for _ in range(read_uint64(f)):
+            point_id = read_uint64(f)
+            position = struct.unpack("=3d", f.read(24))
+            receivers.append((point_id, position))
+        ncols = len(variables) + 1
+        chunks = [[] for _ in receivers]
+        while True:
+            try:
+                for chunk in chunks:
+                    count = read_uint64(f)
+                    values = np.frombuffer(f.read(count * np.dtype(dtype).itemsize), dtype=dtype)
+                    chunk.append(values.reshape((-1, ncols)))
+            except EOFError:
+                break
+    data = [np.concatenate(chunk) if chunk else np.zeros((0, ncols)) for chunk in chunks]
+    return variables, receivers, data
+
+
+def read_hdf5(filenames):
+    """same as read_binary, but for the HDF5 receiver files (one per synchronization point)"""
+    import h5py
+
+    variables = None
+    receivers = {}
+    data = {}
+    for filename in sorted(filenames, key=lambda name: int(re.findall(r"(\d+)\.h5$", name)[0])):
+        with h5py.File(filename, "r") as f:
+            variables = f["receiverdata"].attrs["variables"]
+            if isinstance(variables, bytes):
+                variables = variables.decode()
+            variables = variables.split(",")[1:]
+            offsets = np.concatenate([[0], np.cumsum(f["samples"][:])])
+            rows = f["receiverdata"][:]
+            for i, point_id in enumerate(f["pointid"][:]):
+                receivers[point_id] = tuple(f["position"][i])
+                data.setdefault(point_id, []).append(rows[offsets[i] : offsets[i + 1]])
+    point_ids = sorted(receivers.keys())
+    return (
+        variables,
+        [(point_id, receivers[point_id]) for point_id in point_ids],
+        [np.concatenate(data[point_id]) for point_id in point_ids],
+    )
+
+
+def write_text(filename, point_id, position, variables, samples):
+    with open(filename, "w") as f:
+        f.write(f'TITLE = "Temporal Signal for receiver number {point_id + 1:05d}"\n')
+        f.write('VARIABLES = "Time"' + "".join(f',"{name}"' for name in variables) + "\n")
+        for d in range(3):
+            f.write(f"# x{d + 1}       {position[d]:.12e}\n")
+        for row in samples:
+            f.write("".join(f"  {value:.15e}" for value in row) + "\n")
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="convert binary or HDF5 SeisSol receiver output to the legacy text layout"
+    )
+    parser.add_argument("prefix", help="output prefix of the SeisSol run")
+    parser.add_argument("--output_prefix", help="prefix of the text files (default: prefix)")
+    args = parser.parse_args()
+    output_prefix = args.output_prefix if args.output_prefix else args.prefix
+
+    converted = 0
+    for filename in sorted(glob.glob(f"{args.prefix}-receivers-*.bin")):
+        rank = int(re.findall(r"-receivers-(\d+)\.bin$", filename)[0])
+        variables, receivers, data = read_binary(filename)
+        for (point_id, position), samples in zip(receivers, data):
+            name = f"{output_prefix}-receiver-{point_id + 1:05d}-{rank:05d}.dat"
+            write_text(name, point_id, position, variables, samples)
+            converted += 1
+
+    hdf5_files = glob.glob(f"{args.prefix}-receiver-*.h5")
+    if hdf5_files:
+        variables, receivers, data = read_hdf5(hdf5_files)
+        for (point_id, position), samples in zip(receivers, data):
+            name = f"{output_prefix}-receiver-{point_id + 1:05d}.dat"
+            write_text(name, point_id, position, variables, samples)
+            converted += 1
+
+    print(f"converted {converted} receivers")
+
+
+if __name__ == "__main__":
+    main()
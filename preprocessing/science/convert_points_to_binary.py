@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+
+# Converts an ASCII point list (one "x y z" line per point, e.g. receivers.dat or the fault
+# pick points) to the binary point list format of SeisSol. SeisSol recognizes binary point
+# lists by their magic string; thus, the converted file can be used in place of the original one.
+
+import argparse
+
+import numpy as np
+
+MAGIC = b"SSPNTS01"
+
+
+def main():
+    parser = argparse.ArgumentParser(description="convert an ASCII point list to binary")
+    parser.add_argument("input", help="ASCII point list")
+    parser.add_argument("output", help="binary point list")
+    args = parser.parse_args()
+
+    points = np.loadtxt(args.input, ndmin=2)
+    if points.shape[1] != 3:
+        raise ValueError(f"expected 3 coordinates per point, got {points.shape[1]}")
+    with open(args.output, "wb") as f:
+        f.write(MAGIC)
+        f.write(np.uint64(points.shape[0]).tobytes())
+        f.write(np.ascontiguousarray(points, dtype=np.float64).tobytes())
+    print(f"wrote {points.shape[0]} points to {args.output}")
+
+
+if __name__ == "__main__":
+    main()
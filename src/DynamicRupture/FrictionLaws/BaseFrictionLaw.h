@@ -1,6 +1,8 @@
 #ifndef SEISSOL_BASEFRICTIONLAW_H
 #define SEISSOL_BASEFRICTIONLAW_H
 
+#include <algorithm>
+#include <array>
 #include <yaml-cpp/yaml.h>
 
 #include "DynamicRupture/Misc.h"
@@ -8,8 +10,24 @@
 #include "FrictionSolverCommon.h"
 #include "Initializer/Parameters/DRParameters.h"
 #include "Monitoring/Instrumentation.h"
+#include "Parallel/Helper.h"
+#include "Parallel/Runtime/ParallelFor.h"
 
 namespace seissol::dr::friction_law {
+//! number of faces updated together by the batched friction solvers
+constexpr std::size_t FaceBatchSize = 8;
+
+/**
+ * Temporary data of a batch of consecutive faces
+ */
+struct FaceBatch {
+  std::size_t firstFace{0};
+  std::size_t size{0};
+  std::array<FaultStresses, FaceBatchSize> faultStresses{};
+  std::array<TractionResults, FaceBatchSize> tractionResults{};
+  std::array<std::array<real, misc::NumPaddedPoints>, FaceBatchSize> stateVariableBuffer{};
+};
+
 /**
  * Base class, has implementations of methods that are used by each friction law
  * Actual friction law is plugged in via CRTP.
@@ -18,7 +36,10 @@ template <typename Derived>
 class BaseFrictionLaw : public FrictionSolver {
   public:
   explicit BaseFrictionLaw(seissol::initializer::parameters::DRParameters* drParameters)
-      : FrictionSolver(drParameters) {};
+      : FrictionSolver(drParameters), useFaceBatches(seissol::useFrictionFaceBatches()) {};
+
+  //! set to true in friction laws which implement updateFrictionAndSlipBatch
+  static constexpr bool SupportsFaceBatches = false;
 
   /**
    * evaluates the current friction model
@@ -32,53 +53,34 @@ class BaseFrictionLaw : public FrictionSolver {
       return;
     }
 
-    SCOREP_USER_REGION_DEFINE(myRegionHandle)
     BaseFrictionLaw::copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
     static_cast<Derived*>(this)->copyLtsTreeToLocal(layerData, dynRup, fullUpdateTime);
 
+    if constexpr (Derived::SupportsFaceBatches) {
+      if (useFaceBatches) {
+        evaluateBatched(layerData, timeWeights);
+        return;
+      }
+    }
+
+    SCOREP_USER_REGION_DEFINE(myRegionHandle)
     // loop over all dynamic rupture faces, in this LTS layer
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (unsigned ltsFace = 0; ltsFace < layerData.getNumberOfCells(); ++ltsFace) {
+    seissol::parallel::runtime::parallelFor(layerData.getNumberOfCells(), [&](std::size_t ltsFace) {
       alignas(Alignment) FaultStresses faultStresses{};
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePrecomputeStress");
-      common::precomputeStressFromQInterpolated(faultStresses,
-                                                impAndEta[ltsFace],
-                                                impedanceMatrices[ltsFace],
-                                                qInterpolatedPlus[ltsFace],
-                                                qInterpolatedMinus[ltsFace]);
-      LIKWID_MARKER_STOP("computeDynamicRupturePrecomputeStress");
-      SCOREP_USER_REGION_END(myRegionHandle)
-
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePreHook", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePreHook");
       // define some temporary variables
       std::array<real, misc::NumPaddedPoints> stateVariableBuffer{0};
       std::array<real, misc::NumPaddedPoints> strengthBuffer{0};
+      TractionResults tractionResults = {};
 
-      static_cast<Derived*>(this)->preHook(stateVariableBuffer, ltsFace);
-      LIKWID_MARKER_STOP("computeDynamicRupturePreHook");
-      SCOREP_USER_REGION_END(myRegionHandle)
+      preFace(faultStresses, stateVariableBuffer, ltsFace);
 
       SCOREP_USER_REGION_BEGIN(myRegionHandle,
                                "computeDynamicRuptureUpdateFrictionAndSlip",
                                SCOREP_USER_REGION_TYPE_COMMON)
       LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
-      TractionResults tractionResults = {};
-
       // loop over sub time steps (i.e. quadrature points in time)
       for (std::size_t timeIndex = 0; timeIndex < ConvergenceOrder; timeIndex++) {
-        common::adjustInitialStress(initialStressInFaultCS[ltsFace],
-                                    nucleationStressInFaultCS[ltsFace],
-                                    initialPressure[ltsFace],
-                                    nucleationPressure[ltsFace],
-                                    this->mFullUpdateTime,
-                                    this->drParameters->t0,
-                                    this->deltaT[timeIndex]);
+        adjustInitialStress(ltsFace, timeIndex);
 
         static_cast<Derived*>(this)->updateFrictionAndSlip(faultStresses,
                                                            tractionResults,
@@ -90,56 +92,143 @@ class BaseFrictionLaw : public FrictionSolver {
       LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
       SCOREP_USER_REGION_END(myRegionHandle)
 
-      SCOREP_USER_REGION_BEGIN(
-          myRegionHandle, "computeDynamicRupturePostHook", SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePostHook");
-      static_cast<Derived*>(this)->postHook(stateVariableBuffer, ltsFace);
-
-      common::saveRuptureFrontOutput(ruptureTimePending[ltsFace],
-                                     ruptureTime[ltsFace],
-                                     slipRateMagnitude[ltsFace],
-                                     mFullUpdateTime);
+      postFace(faultStresses, tractionResults, stateVariableBuffer, timeWeights, ltsFace);
+    });
+  }
 
-      static_cast<Derived*>(this)->saveDynamicStressOutput(ltsFace);
+  private:
+  //! update the friction and slip for batches of faces (cf. useFrictionFaceBatches)
+  bool useFaceBatches{false};
 
-      common::savePeakSlipRateOutput(slipRateMagnitude[ltsFace], peakSlipRate[ltsFace]);
-      LIKWID_MARKER_STOP("computeDynamicRupturePostHook");
-      SCOREP_USER_REGION_END(myRegionHandle)
+  /**
+   * Same as the face loop in evaluate, but updates the friction and slip of FaceBatchSize faces at
+   * once (cf. RateAndStateBase::updateFrictionAndSlipBatch). Gives the same results.
+   */
+  void evaluateBatched(seissol::initializer::Layer& layerData,
+                       const double timeWeights[ConvergenceOrder]) {
+    SCOREP_USER_REGION_DEFINE(myRegionHandle)
+    const std::size_t numberOfFaces = layerData.getNumberOfCells();
+    const std::size_t numberOfBatches = (numberOfFaces + FaceBatchSize - 1) / FaceBatchSize;
+    seissol::parallel::runtime::parallelFor(numberOfBatches, [&](std::size_t batchIndex) {
+      alignas(Alignment) FaceBatch batch{};
+      batch.firstFace = batchIndex * FaceBatchSize;
+      batch.size = std::min(FaceBatchSize, numberOfFaces - batch.firstFace);
+
+      for (std::size_t i = 0; i < batch.size; ++i) {
+        preFace(batch.faultStresses[i], batch.stateVariableBuffer[i], batch.firstFace + i);
+      }
 
       SCOREP_USER_REGION_BEGIN(myRegionHandle,
-                               "computeDynamicRupturePostcomputeImposedState",
+                               "computeDynamicRuptureUpdateFrictionAndSlip",
                                SCOREP_USER_REGION_TYPE_COMMON)
-      LIKWID_MARKER_START("computeDynamicRupturePostcomputeImposedState");
-      common::postcomputeImposedStateFromNewStress(faultStresses,
-                                                   tractionResults,
-                                                   impAndEta[ltsFace],
-                                                   impedanceMatrices[ltsFace],
-                                                   imposedStatePlus[ltsFace],
-                                                   imposedStateMinus[ltsFace],
-                                                   qInterpolatedPlus[ltsFace],
-                                                   qInterpolatedMinus[ltsFace],
-                                                   timeWeights);
-      LIKWID_MARKER_STOP("computeDynamicRupturePostcomputeImposedState");
+      LIKWID_MARKER_START("computeDynamicRuptureUpdateFrictionAndSlip");
+      for (std::size_t timeIndex = 0; timeIndex < ConvergenceOrder; timeIndex++) {
+        for (std::size_t i = 0; i < batch.size; ++i) {
+          adjustInitialStress(batch.firstFace + i, timeIndex);
+        }
+        static_cast<Derived*>(this)->updateFrictionAndSlipBatch(batch, timeIndex);
+      }
+      LIKWID_MARKER_STOP("computeDynamicRuptureUpdateFrictionAndSlip");
       SCOREP_USER_REGION_END(myRegionHandle)
 
-      if (this->drParameters->isFrictionEnergyRequired) {
+      for (std::size_t i = 0; i < batch.size; ++i) {
+        postFace(batch.faultStresses[i],
+                 batch.tractionResults[i],
+                 batch.stateVariableBuffer[i],
+                 timeWeights,
+                 batch.firstFace + i);
+      }
+    });
+  }
 
-        if (this->drParameters->isCheckAbortCriteraEnabled) {
-          common::updateTimeSinceSlipRateBelowThreshold(
-              slipRateMagnitude[ltsFace],
-              ruptureTimePending[ltsFace],
-              energyData[ltsFace],
-              this->sumDt,
-              this->drParameters->terminatorSlipRateThreshold);
-        }
-        common::computeFrictionEnergy(energyData[ltsFace],
-                                      qInterpolatedPlus[ltsFace],
-                                      qInterpolatedMinus[ltsFace],
-                                      impAndEta[ltsFace],
-                                      timeWeights,
-                                      spaceWeights,
-                                      godunovData[ltsFace]);
+  void preFace(FaultStresses& faultStresses,
+               std::array<real, misc::NumPaddedPoints>& stateVariableBuffer,
+               std::size_t ltsFace) {
+    SCOREP_USER_REGION_DEFINE(myRegionHandle)
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePrecomputeStress", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePrecomputeStress");
+    common::precomputeStressFromQInterpolated(faultStresses,
+                                              impAndEta[ltsFace],
+                                              impedanceMatrices[ltsFace],
+                                              qInterpolatedPlus[ltsFace],
+                                              qInterpolatedMinus[ltsFace]);
+    LIKWID_MARKER_STOP("computeDynamicRupturePrecomputeStress");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePreHook", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePreHook");
+    static_cast<Derived*>(this)->preHook(stateVariableBuffer, ltsFace);
+    LIKWID_MARKER_STOP("computeDynamicRupturePreHook");
+    SCOREP_USER_REGION_END(myRegionHandle)
+  }
+
+  void adjustInitialStress(std::size_t ltsFace, std::size_t timeIndex) {
+    common::adjustInitialStress(initialStressInFaultCS[ltsFace],
+                                nucleationStressInFaultCS[ltsFace],
+                                initialPressure[ltsFace],
+                                nucleationPressure[ltsFace],
+                                this->mFullUpdateTime,
+                                this->drParameters->t0,
+                                this->deltaT[timeIndex]);
+  }
+
+  void postFace(const FaultStresses& faultStresses,
+                const TractionResults& tractionResults,
+                std::array<real, misc::NumPaddedPoints>& stateVariableBuffer,
+                const double timeWeights[ConvergenceOrder],
+                std::size_t ltsFace) {
+    SCOREP_USER_REGION_DEFINE(myRegionHandle)
+    SCOREP_USER_REGION_BEGIN(
+        myRegionHandle, "computeDynamicRupturePostHook", SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePostHook");
+    static_cast<Derived*>(this)->postHook(stateVariableBuffer, ltsFace);
+
+    common::saveRuptureFrontOutput(ruptureTimePending[ltsFace],
+                                   ruptureTime[ltsFace],
+                                   slipRateMagnitude[ltsFace],
+                                   mFullUpdateTime);
+
+    static_cast<Derived*>(this)->saveDynamicStressOutput(ltsFace);
+
+    common::savePeakSlipRateOutput(slipRateMagnitude[ltsFace], peakSlipRate[ltsFace]);
+    LIKWID_MARKER_STOP("computeDynamicRupturePostHook");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    SCOREP_USER_REGION_BEGIN(myRegionHandle,
+                             "computeDynamicRupturePostcomputeImposedState",
+                             SCOREP_USER_REGION_TYPE_COMMON)
+    LIKWID_MARKER_START("computeDynamicRupturePostcomputeImposedState");
+    common::postcomputeImposedStateFromNewStress(faultStresses,
+                                                 tractionResults,
+                                                 impAndEta[ltsFace],
+                                                 impedanceMatrices[ltsFace],
+                                                 imposedStatePlus[ltsFace],
+                                                 imposedStateMinus[ltsFace],
+                                                 qInterpolatedPlus[ltsFace],
+                                                 qInterpolatedMinus[ltsFace],
+                                                 timeWeights);
+    LIKWID_MARKER_STOP("computeDynamicRupturePostcomputeImposedState");
+    SCOREP_USER_REGION_END(myRegionHandle)
+
+    if (this->drParameters->isFrictionEnergyRequired) {
+
+      if (this->drParameters->isCheckAbortCriteraEnabled) {
+        common::updateTimeSinceSlipRateBelowThreshold(
+            slipRateMagnitude[ltsFace],
+            ruptureTimePending[ltsFace],
+            energyData[ltsFace],
+            this->sumDt,
+            this->drParameters->terminatorSlipRateThreshold);
       }
+      common::computeFrictionEnergy(energyData[ltsFace],
+                                    qInterpolatedPlus[ltsFace],
+                                    qInterpolatedMinus[ltsFace],
+                                    impAndEta[ltsFace],
+                                    timeWeights,
+                                    spaceWeights,
+                                    godunovData[ltsFace]);
     }
   }
 };
@@ -66,6 +66,104 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
                                   ltsFace);
   }
 
+  static constexpr bool SupportsFaceBatches = true;
+
+  /**
+   * Same as updateFrictionAndSlip, but for all faces of the batch at once.
+   * The Newton iterations of all faces run in lockstep, s.t. the vector units work on the points of
+   * several faces; faces leave the iteration once they have converged. The results are the same as
+   * with updateFrictionAndSlip.
+   */
+  void updateFrictionAndSlipBatch(FaceBatch& batch, unsigned timeIndex) {
+    using PointArray = std::array<real, misc::NumPaddedPoints>;
+    std::array<PointArray, FaceBatchSize> absoluteShearStress{};
+    std::array<PointArray, FaceBatchSize> localSlipRate{};
+    std::array<PointArray, FaceBatchSize> normalStress{};
+    std::array<PointArray, FaceBatchSize> stateVarReference{};
+    std::array<bool, FaceBatchSize> hasConverged{};
+
+    // compute initial slip rate and reference values
+    for (std::size_t i = 0; i < batch.size; ++i) {
+      auto initialVariables = static_cast<Derived*>(this)->calcInitialVariables(
+          batch.faultStresses[i], batch.stateVariableBuffer[i], timeIndex, batch.firstFace + i);
+      absoluteShearStress[i] = initialVariables.absoluteShearTraction;
+      localSlipRate[i] = initialVariables.localSlipRate;
+      normalStress[i] = initialVariables.normalStress;
+      stateVarReference[i] = initialVariables.stateVarReference;
+    }
+
+    // compute slip rates by solving non-linear system of equations
+    std::array<PointArray, FaceBatchSize> testSlipRate{};
+    for (unsigned j = 0; j < settings.numberStateVariableUpdates; j++) {
+      for (std::size_t i = 0; i < batch.size; ++i) {
+        const unsigned ltsFace = batch.firstFace + i;
+#pragma omp simd
+        for (unsigned pointIndex = 0; pointIndex < misc::NumPaddedPoints; pointIndex++) {
+          batch.stateVariableBuffer[i][pointIndex] =
+              static_cast<Derived*>(this)->updateStateVariable(pointIndex,
+                                                               ltsFace,
+                                                               stateVarReference[i][pointIndex],
+                                                               this->deltaT[timeIndex],
+                                                               localSlipRate[i][pointIndex]);
+        }
+        this->tpMethod.calcFluidPressure(normalStress[i],
+                                         this->mu,
+                                         localSlipRate[i],
+                                         this->deltaT[timeIndex],
+                                         false,
+                                         timeIndex,
+                                         ltsFace);
+        updateNormalStress(normalStress[i], batch.faultStresses[i], timeIndex, ltsFace);
+      }
+
+      invertSlipRateIterativeBatch(batch,
+                                   batch.stateVariableBuffer,
+                                   normalStress,
+                                   absoluteShearStress,
+                                   testSlipRate,
+                                   hasConverged);
+
+      for (std::size_t i = 0; i < batch.size; ++i) {
+        const unsigned ltsFace = batch.firstFace + i;
+#pragma omp simd
+        for (unsigned pointIndex = 0; pointIndex < misc::NumPaddedPoints; pointIndex++) {
+          localSlipRate[i][pointIndex] = 0.5 * (this->slipRateMagnitude[ltsFace][pointIndex] +
+                                                std::fabs(testSlipRate[i][pointIndex]));
+          this->slipRateMagnitude[ltsFace][pointIndex] = std::fabs(testSlipRate[i][pointIndex]);
+          this->mu[ltsFace][pointIndex] =
+              static_cast<Derived*>(this)->updateMu(ltsFace,
+                                                    pointIndex,
+                                                    this->slipRateMagnitude[ltsFace][pointIndex],
+                                                    batch.stateVariableBuffer[i][pointIndex]);
+        }
+      }
+    }
+
+    for (std::size_t i = 0; i < batch.size; ++i) {
+      const unsigned ltsFace = batch.firstFace + i;
+      if (!hasConverged[i]) {
+        static_cast<Derived*>(this)->executeIfNotConverged(batch.stateVariableBuffer[i], ltsFace);
+      }
+      tpMethod.calcFluidPressure(normalStress[i],
+                                 this->mu,
+                                 localSlipRate[i],
+                                 this->deltaT[timeIndex],
+                                 true,
+                                 timeIndex,
+                                 ltsFace);
+      updateNormalStress(normalStress[i], batch.faultStresses[i], timeIndex, ltsFace);
+      this->calcSlipRateAndTraction(stateVarReference[i],
+                                    localSlipRate[i],
+                                    batch.stateVariableBuffer[i],
+                                    normalStress[i],
+                                    absoluteShearStress[i],
+                                    batch.faultStresses[i],
+                                    batch.tractionResults[i],
+                                    timeIndex,
+                                    ltsFace);
+    }
+  }
+
   void preHook(std::array<real, misc::NumPaddedPoints>& stateVariableBuffer, unsigned ltsFace) {
 // copy state variable from last time step
 #pragma omp simd
@@ -339,6 +437,101 @@ class RateAndStateBase : public BaseFrictionLaw<RateAndStateBase<Derived, TPMeth
     return false;
   }
 
+  /**
+   * Same as invertSlipRateIterative, but for all faces of the batch.
+   * The batch is transposed point-major, s.t. the simd loops run across the faces; each face is a
+   * vector lane. A lane is masked out as soon as all points of its face have converged, exactly
+   * where invertSlipRateIterative would return; the remaining faces continue to iterate.
+   */
+  void invertSlipRateIterativeBatch(
+      const FaceBatch& batch,
+      const std::array<std::array<real, misc::NumPaddedPoints>, FaceBatchSize>& localStateVariable,
+      const std::array<std::array<real, misc::NumPaddedPoints>, FaceBatchSize>& normalStress,
+      const std::array<std::array<real, misc::NumPaddedPoints>, FaceBatchSize>&
+          absoluteShearStress,
+      std::array<std::array<real, misc::NumPaddedPoints>, FaceBatchSize>& slipRateTest,
+      std::array<bool, FaceBatchSize>& hasConverged) {
+    alignas(Alignment) real slipRate[misc::NumPaddedPoints][FaceBatchSize]{};
+    alignas(Alignment) real stateVar[misc::NumPaddedPoints][FaceBatchSize]{};
+    alignas(Alignment) real absNormalStress[misc::NumPaddedPoints][FaceBatchSize]{};
+    alignas(Alignment) real shearStress[misc::NumPaddedPoints][FaceBatchSize]{};
+    // Note that we need double precision here, since single precision led to NaNs.
+    alignas(Alignment) double g[misc::NumPaddedPoints][FaceBatchSize]{};
+    alignas(Alignment) double invEtaS[FaceBatchSize]{};
+    // per-face lane masks: true while the face still iterates; the lanes past the batch stay off
+    std::array<bool, FaceBatchSize> active{};
+    std::array<bool, FaceBatchSize> converged{};
+
+    for (std::size_t i = 0; i < batch.size; ++i) {
+      const unsigned ltsFace = batch.firstFace + i;
+      hasConverged[i] = false;
+      active[i] = true;
+      invEtaS[i] = this->impAndEta[ltsFace].invEtaS;
+      for (unsigned pointIndex = 0; pointIndex < misc::NumPaddedPoints; pointIndex++) {
+        // first guess = sliprate value of the previous step
+        slipRate[pointIndex][i] = this->slipRateMagnitude[ltsFace][pointIndex];
+        stateVar[pointIndex][i] = localStateVariable[i][pointIndex];
+        absNormalStress[pointIndex][i] = std::fabs(normalStress[i][pointIndex]);
+        shearStress[pointIndex][i] = absoluteShearStress[i][pointIndex];
+      }
+    }
+
+    std::size_t activeFaces = batch.size;
+    for (unsigned iteration = 0; iteration < settings.maxNumberSlipRateUpdates && activeFaces > 0;
+         iteration++) {
+      for (unsigned pointIndex = 0; pointIndex < misc::NumPaddedPoints; pointIndex++) {
+#pragma omp simd
+        for (std::size_t i = 0; i < FaceBatchSize; ++i) {
+          if (active[i]) {
+            // calculate friction coefficient and objective function
+            const double muF = static_cast<Derived*>(this)->updateMu(
+                batch.firstFace + i, pointIndex, slipRate[pointIndex][i], stateVar[pointIndex][i]);
+            g[pointIndex][i] =
+                -invEtaS[i] * (absNormalStress[pointIndex][i] * muF - shearStress[pointIndex][i]) -
+                slipRate[pointIndex][i];
+          }
+        }
+      }
+
+      // max element of g must be smaller than newtonTolerance, per face
+      converged = active;
+      for (unsigned pointIndex = 0; pointIndex < misc::NumPaddedPoints; pointIndex++) {
+#pragma omp simd
+        for (std::size_t i = 0; i < FaceBatchSize; ++i) {
+          converged[i] = converged[i] && std::fabs(g[pointIndex][i]) < settings.newtonTolerance;
+        }
+      }
+      for (std::size_t i = 0; i < batch.size; ++i) {
+        if (converged[i]) {
+          hasConverged[i] = true;
+          active[i] = false;
+          --activeFaces;
+        }
+      }
+
+      for (unsigned pointIndex = 0; pointIndex < misc::NumPaddedPoints; pointIndex++) {
+#pragma omp simd
+        for (std::size_t i = 0; i < FaceBatchSize; ++i) {
+          if (active[i]) {
+            // derivative of g
+            const double dMuF = static_cast<Derived*>(this)->updateMuDerivative(
+                batch.firstFace + i, pointIndex, slipRate[pointIndex][i], stateVar[pointIndex][i]);
+            const double dG = -invEtaS[i] * (absNormalStress[pointIndex][i] * dMuF) - 1.0;
+            // newton update
+            const real tmp3 = g[pointIndex][i] / dG;
+            slipRate[pointIndex][i] = std::max(rs::almostZero(), slipRate[pointIndex][i] - tmp3);
+          }
+        }
+      }
+    }
+
+    for (std::size_t i = 0; i < batch.size; ++i) {
+      for (unsigned pointIndex = 0; pointIndex < misc::NumPaddedPoints; pointIndex++) {
+        slipRateTest[i][pointIndex] = slipRate[pointIndex][i];
+      }
+    }
+  }
+
   void updateNormalStress(std::array<real, misc::NumPaddedPoints>& normalStress,
                           const FaultStresses& faultStresses,
                           size_t timeIndex,
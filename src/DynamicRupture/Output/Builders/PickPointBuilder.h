@@ -3,6 +3,7 @@
 
 #include "Initializer/Parameters/OutputParameters.h"
 #include "Initializer/PointMapper.h"
+#include "Reader/PointList.h"
 #include "ReceiverBasedOutputBuilder.h"
 
 namespace seissol::dr::output {
@@ -30,15 +31,24 @@ class PickPointBuilder : public ReceiverBasedOutputBuilder {
 
   protected:
   void readCoordsFromFile() {
-    using namespace seissol::initializer;
-    StringsType content = FileProcessor::getFileAsStrings(pickpointParams.pickpointFileName);
-    FileProcessor::removeEmptyLines(content);
-
-    // iterate line by line and initialize DrRecordPoints
-    for (const auto& line : content) {
-      std::array<real, 3> coords{};
-      convertStringToMask(line, coords);
+    const auto readText = [](const std::string& fileName) {
+      using namespace seissol::initializer;
+      StringsType content = FileProcessor::getFileAsStrings(fileName);
+      FileProcessor::removeEmptyLines(content);
+
+      std::vector<Eigen::Vector3d> points;
+      for (const auto& line : content) {
+        std::array<real, 3> coords{};
+        convertStringToMask(line, coords);
+        points.emplace_back(coords[0], coords[1], coords[2]);
+      }
+      return points;
+    };
+    const auto points =
+        seissol::reader::readPointList(pickpointParams.pickpointFileName, readText);
 
+    // initialize DrRecordPoints
+    for (const auto& coords : points) {
       ReceiverPoint point{};
       for (int i = 0; i < 3; ++i) {
         point.global.coords[i] = coords[i];
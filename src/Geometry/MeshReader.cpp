@@ -44,7 +44,15 @@ bool MeshReader::hasFault() const { return !m_fault.empty(); }
 
 bool MeshReader::hasPlusFault() const { return m_hasPlusFault; }
 
+const TetrahedronBvh& MeshReader::getBvh() const {
+  if (m_bvh == nullptr) {
+    m_bvh = std::make_unique<TetrahedronBvh>(m_vertices, m_elements);
+  }
+  return *m_bvh;
+}
+
 void MeshReader::displaceMesh(const Eigen::Vector3d& displacement) {
+  m_bvh.reset();
   for (unsigned vertexNo = 0; vertexNo < m_vertices.size(); ++vertexNo) {
     for (unsigned i = 0; i < 3; ++i) {
       m_vertices[vertexNo].coords[i] += displacement[i];
@@ -56,6 +64,7 @@ void MeshReader::displaceMesh(const Eigen::Vector3d& displacement) {
 //  scalingMatrix is stored column-major, i.e.
 //  scalingMatrix_ij = scalingMatrix[j][i]
 void MeshReader::scaleMesh(const Eigen::Matrix3d& scalingMatrix) {
+  m_bvh.reset();
   for (unsigned vertexNo = 0; vertexNo < m_vertices.size(); ++vertexNo) {
     Eigen::Vector3d point;
     point << m_vertices[vertexNo].coords[0], m_vertices[vertexNo].coords[1],
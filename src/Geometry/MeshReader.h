@@ -43,9 +43,11 @@
 #define MESH_READER_H
 
 #include "MeshDefinition.h"
+#include "TetrahedronBvh.h"
 
 #include <cmath>
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -90,6 +92,9 @@ class MeshReader {
   /** Has a plus fault side */
   bool m_hasPlusFault{false};
 
+  /** Point location structure, built on first use */
+  mutable std::unique_ptr<TetrahedronBvh> m_bvh;
+
   MeshReader(int rank);
 
   public:
@@ -104,6 +109,12 @@ class MeshReader {
   bool hasFault() const;
   bool hasPlusFault() const;
 
+  /**
+   * Bounding volume hierarchy over the elements, for locating points in the mesh.
+   * It is built on the first call, and kept until the mesh is moved.
+   */
+  const TetrahedronBvh& getBvh() const;
+
   void displaceMesh(const Eigen::Vector3d& displacement);
 
   // scalingMatrix is stored column-major, i.e.
@@ -0,0 +1,314 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "PreparedMeshReader.h"
+
+#include "Common/Filesystem.h"
+#include "IO/Datatype/Datatype.h"
+#include "IO/Datatype/HDF5Type.h"
+#include "IO/Datatype/Inference.h"
+#include "IO/Datatype/MPIType.h"
+#include "IO/Reader/File/Hdf5Reader.h"
+#include "MeshDefinition.h"
+#include "Parallel/MPI.h"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <hdf5.h>
+#include <memory>
+#include <mpi.h>
+#include <string>
+#include <vector>
+
+#include "utils/logger.h"
+
+namespace {
+#define _eh(x) _ehh(x, __FILE__, __LINE__)
+
+hid_t _ehh(hid_t data, const char* file, int line) {
+  if (data < 0) {
+    logError() << "HDF5 error:" << data << "at" << file << ":" << line;
+  }
+  return data;
+}
+
+using namespace seissol::io::datatype;
+
+// per rank: elements, vertices, vertex elements, MPI neighbors, MPI neighbor elements
+constexpr std::size_t NumCounts = 5;
+
+// (mpiFaultIndices are set when extracting the fault information)
+std::shared_ptr<Datatype> elementDatatype() {
+  using seissol::Element;
+  return std::make_shared<StructDatatype>(
+      std::vector<StructDatatype::MemberInfo>{
+          {"globalId", offsetof(Element, globalId), inferDatatype<seissol::GlobalElemId>()},
+          {"localId", offsetof(Element, localId), inferDatatype<seissol::LocalElemId>()},
+          {"vertices", offsetof(Element, vertices), inferDatatype<seissol::ElemVertices>()},
+          {"neighbors", offsetof(Element, neighbors), inferDatatype<seissol::ElemNeighbors>()},
+          {"neighborSides",
+           offsetof(Element, neighborSides),
+           inferDatatype<seissol::ElemNeighborSides>()},
+          {"sideOrientations",
+           offsetof(Element, sideOrientations),
+           inferDatatype<seissol::ElemSideOrientations>()},
+          {"boundaries", offsetof(Element, boundaries), inferDatatype<seissol::ElemBoundaries>()},
+          {"neighborRanks",
+           offsetof(Element, neighborRanks),
+           inferDatatype<seissol::ElemNeighborRanks>()},
+          {"mpiIndices", offsetof(Element, mpiIndices), inferDatatype<seissol::ElemMPIIndices>()},
+          {"group", offsetof(Element, group), inferDatatype<seissol::ElemGroup>()},
+          {"faultTags", offsetof(Element, faultTags), inferDatatype<seissol::ElemFaultTags>()},
+      },
+      sizeof(Element));
+}
+
+std::shared_ptr<Datatype> neighborElementDatatype() {
+  using seissol::MPINeighborElement;
+  return std::make_shared<StructDatatype>(
+      std::vector<StructDatatype::MemberInfo>{
+          {"localElement",
+           offsetof(MPINeighborElement, localElement),
+           inferDatatype<seissol::LocalElemId>()},
+          {"localSide", offsetof(MPINeighborElement, localSide), inferDatatype<seissol::SideId>()},
+          {"neighborElement",
+           offsetof(MPINeighborElement, neighborElement),
+           inferDatatype<seissol::LocalElemId>()},
+          {"neighborSide",
+           offsetof(MPINeighborElement, neighborSide),
+           inferDatatype<seissol::SideId>()},
+      },
+      sizeof(MPINeighborElement));
+}
+
+/**
+ * Writes a one-dimensional dataset, with the data of all ranks concatenated in rank order.
+ */
+void writeDistributed(hid_t file,
+                      const std::string& name,
+                      const void* data,
+                      std::size_t count,
+                      const std::shared_ptr<Datatype>& type) {
+  const MPI_Comm comm = seissol::MPI::mpi.comm();
+  const MPI_Datatype sizetype = convertToMPI(inferDatatype<std::size_t>());
+
+  std::size_t total = 0;
+  std::size_t offset = 0;
+  MPI_Allreduce(&count, &total, 1, sizetype, MPI_SUM, comm);
+  MPI_Exscan(&count, &offset, 1, sizetype, MPI_SUM, comm);
+
+  // stay below 2 GB per call, as Hdf5Writer does
+  const std::size_t chunksize = std::max(std::size_t(1), std::size_t(2'000'000'000) / type->size());
+  std::size_t rounds = (count + chunksize - 1) / chunksize;
+  MPI_Allreduce(MPI_IN_PLACE, &rounds, 1, sizetype, MPI_MAX, comm);
+
+  const hid_t memtype = convertToHdf5(type);
+  const hid_t filetype = _eh(H5Tcopy(memtype));
+  if (_eh(H5Tget_class(filetype)) == H5T_COMPOUND) {
+    _eh(H5Tpack(filetype));
+  }
+
+  const hsize_t globalSize = total;
+  const hid_t filespace = _eh(H5Screate_simple(1, &globalSize, nullptr));
+  const hid_t dataset = _eh(H5Dcreate(
+      file, name.c_str(), filetype, filespace, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT));
+
+  const hid_t h5dxlist = _eh(H5Pcreate(H5P_DATASET_XFER));
+#ifdef USE_MPI
+  _eh(H5Pset_dxpl_mpio(h5dxlist, H5FD_MPIO_COLLECTIVE));
+#endif
+
+  const auto* ptr = static_cast<const unsigned char*>(data);
+  std::size_t written = 0;
+  for (std::size_t i = 0; i < rounds; ++i) {
+    const hsize_t start = offset + written;
+    const hsize_t length = std::min(chunksize, count - written);
+    const hsize_t nullstart = 0;
+    const hid_t memspace = _eh(H5Screate_simple(1, &length, nullptr));
+    _eh(H5Sselect_hyperslab(memspace, H5S_SELECT_SET, &nullstart, nullptr, &length, nullptr));
+    _eh(H5Sselect_hyperslab(filespace, H5S_SELECT_SET, &start, nullptr, &length, nullptr));
+    _eh(H5Dwrite(dataset, memtype, memspace, filespace, h5dxlist, ptr));
+    _eh(H5Sclose(memspace));
+
+    written += length;
+    ptr += length * type->size();
+  }
+
+  _eh(H5Pclose(h5dxlist));
+  _eh(H5Dclose(dataset));
+  _eh(H5Sclose(filespace));
+  _eh(H5Tclose(filetype));
+}
+
+template <typename T>
+void writeAttribute(hid_t file, const std::string& name, const T& value) {
+  const hid_t type = convertToHdf5(inferDatatype<T>());
+  const hid_t space = _eh(H5Screate(H5S_SCALAR));
+  const hid_t attribute =
+      _eh(H5Acreate(file, name.c_str(), type, space, H5P_DEFAULT, H5P_DEFAULT));
+  _eh(H5Awrite(attribute, type, &value));
+  _eh(H5Aclose(attribute));
+  _eh(H5Sclose(space));
+}
+} // namespace
+
+namespace seissol::geometry {
+
+PreparedMeshReader::PreparedMeshReader(const std::string& file) : MeshReader(MPI::mpi.rank()) {
+  auto reader = io::reader::file::Hdf5Reader(MPI::mpi.comm());
+  reader.openFile(file);
+
+  const auto counts = reader.readData<std::size_t>("counts");
+  if (counts.size() != NumCounts) {
+    logError() << "The prepared mesh" << file << "does not match the number of ranks.";
+  }
+
+  m_elements.resize(counts[0]);
+  reader.readDataRaw(m_elements.data(), "elements", m_elements.size(), elementDatatype());
+  for (auto& element : m_elements) {
+    std::fill_n(element.mpiFaultIndices, 4, 0);
+  }
+
+  std::vector<std::array<double, 3>> coords(counts[1]);
+  reader.readDataRaw(
+      coords.data(), "vertices", coords.size(), inferDatatype<std::array<double, 3>>());
+  std::vector<LocalElemId> vertexElementCounts(counts[1]);
+  reader.readDataRaw(vertexElementCounts.data(),
+                     "vertexElementCounts",
+                     vertexElementCounts.size(),
+                     inferDatatype<LocalElemId>());
+  std::vector<LocalElemId> vertexElements(counts[2]);
+  reader.readDataRaw(vertexElements.data(),
+                     "vertexElements",
+                     vertexElements.size(),
+                     inferDatatype<LocalElemId>());
+
+  m_vertices.resize(counts[1]);
+  std::size_t position = 0;
+  for (std::size_t i = 0; i < m_vertices.size(); ++i) {
+    std::copy(coords[i].begin(), coords[i].end(), m_vertices[i].coords);
+    m_vertices[i].elements.assign(vertexElements.begin() + position,
+                                  vertexElements.begin() + position + vertexElementCounts[i]);
+    position += vertexElementCounts[i];
+  }
+
+  // per neighbor: rank, local ID, number of elements
+  std::vector<std::array<int, 3>> neighbors(counts[3]);
+  reader.readDataRaw(
+      neighbors.data(), "neighbors", neighbors.size(), inferDatatype<std::array<int, 3>>());
+  std::vector<MPINeighborElement> neighborElements(counts[4]);
+  reader.readDataRaw(neighborElements.data(),
+                     "neighborElements",
+                     neighborElements.size(),
+                     neighborElementDatatype());
+
+  position = 0;
+  for (const auto& [rank, localID, numElements] : neighbors) {
+    auto& neighbor = m_MPINeighbors[rank];
+    neighbor.localID = localID;
+    neighbor.elements.assign(neighborElements.begin() + position,
+                             neighborElements.begin() + position + numElements);
+    position += numElements;
+  }
+
+  reader.closeFile();
+}
+
+bool PreparedMeshReader::matches(const std::string& file, std::uint64_t signature) {
+  if (!seissol::filesystem::exists(file)) {
+    return false;
+  }
+  auto reader = io::reader::file::Hdf5Reader(MPI::mpi.comm());
+  reader.openFile(file);
+  const bool matching = reader.hasAttribute("signature") && reader.hasAttribute("ranks") &&
+                        reader.readAttributeScalar<std::uint64_t>("signature") == signature &&
+                        reader.readAttributeScalar<int>("ranks") == MPI::mpi.size();
+  reader.closeFile();
+  return matching;
+}
+
+void PreparedMeshReader::write(const MeshReader& mesh,
+                               const std::string& file,
+                               std::uint64_t signature) {
+  const auto& elements = mesh.getElements();
+  const auto& vertices = mesh.getVertices();
+  const auto& mpiNeighbors = mesh.getMPINeighbors();
+
+  std::vector<std::array<double, 3>> coords(vertices.size());
+  std::vector<LocalElemId> vertexElementCounts(vertices.size());
+  std::vector<LocalElemId> vertexElements;
+  for (std::size_t i = 0; i < vertices.size(); ++i) {
+    std::copy_n(vertices[i].coords, 3, coords[i].begin());
+    vertexElementCounts[i] = vertices[i].elements.size();
+    vertexElements.insert(
+        vertexElements.end(), vertices[i].elements.begin(), vertices[i].elements.end());
+  }
+
+  std::vector<std::array<int, 3>> neighbors;
+  std::vector<MPINeighborElement> neighborElements;
+  for (const auto& [rank, neighbor] : mpiNeighbors) {
+    neighbors.push_back({rank, neighbor.localID, static_cast<int>(neighbor.elements.size())});
+    neighborElements.insert(
+        neighborElements.end(), neighbor.elements.begin(), neighbor.elements.end());
+  }
+
+  const std::array<std::size_t, NumCounts> counts = {elements.size(),
+                                                     vertices.size(),
+                                                     vertexElements.size(),
+                                                     neighbors.size(),
+                                                     neighborElements.size()};
+
+  // write to a temporary file first, s.t. an incomplete file is never used
+  const auto temporaryFile = file + ".tmp";
+  const hid_t h5falist = _eh(H5Pcreate(H5P_FILE_ACCESS));
+#ifdef H5F_LIBVER_V18
+  _eh(H5Pset_libver_bounds(h5falist, H5F_LIBVER_V18, H5F_LIBVER_V18));
+#else
+  _eh(H5Pset_libver_bounds(h5falist, H5F_LIBVER_LATEST, H5F_LIBVER_LATEST));
+#endif
+  _eh(H5Pset_fapl_mpio(h5falist, MPI::mpi.comm(), MPI_INFO_NULL));
+  const hid_t h5file = _eh(H5Fcreate(temporaryFile.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, h5falist));
+  _eh(H5Pclose(h5falist));
+
+  writeDistributed(h5file, "counts", counts.data(), counts.size(), inferDatatype<std::size_t>());
+  writeDistributed(h5file, "elements", elements.data(), elements.size(), elementDatatype());
+  writeDistributed(
+      h5file, "vertices", coords.data(), coords.size(), inferDatatype<std::array<double, 3>>());
+  writeDistributed(h5file,
+                   "vertexElementCounts",
+                   vertexElementCounts.data(),
+                   vertexElementCounts.size(),
+                   inferDatatype<LocalElemId>());
+  writeDistributed(h5file,
+                   "vertexElements",
+                   vertexElements.data(),
+                   vertexElements.size(),
+                   inferDatatype<LocalElemId>());
+  writeDistributed(h5file,
+                   "neighbors",
+                   neighbors.data(),
+                   neighbors.size(),
+                   inferDatatype<std::array<int, 3>>());
+  writeDistributed(h5file,
+                   "neighborElements",
+                   neighborElements.data(),
+                   neighborElements.size(),
+                   neighborElementDatatype());
+
+  writeAttribute(h5file, "signature", signature);
+  writeAttribute(h5file, "ranks", MPI::mpi.size());
+  _eh(H5Fclose(h5file));
+
+  MPI_Barrier(MPI::mpi.comm());
+  if (MPI::mpi.rank() == 0 && std::rename(temporaryFile.c_str(), file.c_str()) != 0) {
+    logWarning() << "Could not move the prepared mesh to" << file;
+  }
+  MPI_Barrier(MPI::mpi.comm());
+}
+
+} // namespace seissol::geometry
@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_GEOMETRY_PREPAREDMESHREADER_H_
+#define SEISSOL_SRC_GEOMETRY_PREPAREDMESHREADER_H_
+
+#include "MeshReader.h"
+
+#include <cstdint>
+#include <string>
+
+namespace seissol::geometry {
+
+/**
+ * Reads a prepared mesh, i.e. the already partitioned mesh of all ranks, as written by write().
+ *
+ * A prepared mesh holds the state of a mesh reader right after reading and partitioning:
+ * the elements of each rank in their local order (including the face relations and the
+ * boundary conditions), the vertices, and the elements at the MPI boundaries per neighboring
+ * rank. The remaining setup (e.g. the ghost layer metadata and the fault information) is
+ * derived from it as for any other mesh reader.
+ *
+ * The data of all ranks is concatenated in rank order; each rank reads its part with collective
+ * HDF5 reads. Hence, a prepared mesh can only be used with the number of ranks it was written
+ * with.
+ */
+class PreparedMeshReader : public MeshReader {
+  public:
+  explicit PreparedMeshReader(const std::string& file);
+
+  /**
+   * Returns true, if the file exists and was written with the given signature and the current
+   * number of ranks. (collective)
+   */
+  static bool matches(const std::string& file, std::uint64_t signature);
+
+  /**
+   * Writes the mesh of all ranks. It needs to be called before the mesh is post-processed, i.e.
+   * displaced, scaled, or the fault information is extracted. (collective)
+   *
+   * @param signature identifies everything the partitioned mesh depends on
+   */
+  static void write(const MeshReader& mesh, const std::string& file, std::uint64_t signature);
+};
+
+} // namespace seissol::geometry
+
+#endif // SEISSOL_SRC_GEOMETRY_PREPAREDMESHREADER_H_
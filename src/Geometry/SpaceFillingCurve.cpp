@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "SpaceFillingCurve.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+namespace {
+// spreads the lower 21 bits of value s.t. there are two zero bits between each of them
+std::uint64_t spreadBits(std::uint64_t value) {
+  value &= 0x1fffffULL;
+  value = (value | (value << 32U)) & 0x1f00000000ffffULL;
+  value = (value | (value << 16U)) & 0x1f0000ff0000ffULL;
+  value = (value | (value << 8U)) & 0x100f00f00f00f00fULL;
+  value = (value | (value << 4U)) & 0x10c30c30c30c30c3ULL;
+  value = (value | (value << 2U)) & 0x1249249249249249ULL;
+  return value;
+}
+} // namespace
+
+namespace seissol::geometry {
+
+std::uint64_t mortonKey(const std::array<std::uint32_t, 3>& point) {
+  return (spreadBits(point[0]) << 2U) | (spreadBits(point[1]) << 1U) | spreadBits(point[2]);
+}
+
+std::uint64_t hilbertKey(const std::array<std::uint32_t, 3>& point) {
+  // transform the coordinates in-place into the "transposed" Hilbert index
+  auto x = point;
+  constexpr std::uint32_t M = 1U << (SpaceFillingCurveBits - 1);
+
+  // inverse undo
+  for (std::uint32_t q = M; q > 1; q >>= 1U) {
+    const std::uint32_t p = q - 1;
+    for (unsigned i = 0; i < 3; ++i) {
+      if ((x[i] & q) != 0) {
+        x[0] ^= p;
+      } else {
+        const std::uint32_t t = (x[0] ^ x[i]) & p;
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  for (unsigned i = 1; i < 3; ++i) {
+    x[i] ^= x[i - 1];
+  }
+  std::uint32_t t = 0;
+  for (std::uint32_t q = M; q > 1; q >>= 1U) {
+    if ((x[2] & q) != 0) {
+      t ^= q - 1;
+    }
+  }
+  for (auto& coordinate : x) {
+    coordinate ^= t;
+  }
+
+  // the transposed index interleaves like a Morton key
+  return mortonKey(x);
+}
+
+std::vector<std::size_t> spaceFillingCurveOrder(const std::vector<std::array<double, 3>>& points,
+                                                SpaceFillingCurve curve) {
+  std::array<double, 3> minimum{};
+  std::array<double, 3> maximum{};
+  minimum.fill(std::numeric_limits<double>::max());
+  maximum.fill(std::numeric_limits<double>::lowest());
+  for (const auto& point : points) {
+    for (unsigned d = 0; d < 3; ++d) {
+      minimum[d] = std::min(minimum[d], point[d]);
+      maximum[d] = std::max(maximum[d], point[d]);
+    }
+  }
+
+  // use the same scaling in all directions, s.t. the curve follows the geometry
+  double extent = 0;
+  for (unsigned d = 0; d < 3; ++d) {
+    extent = std::max(extent, maximum[d] - minimum[d]);
+  }
+  constexpr double GridMax = static_cast<double>((1U << SpaceFillingCurveBits) - 1);
+  const double scale = extent > 0 ? GridMax / extent : 0;
+
+  std::vector<std::uint64_t> keys(points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    std::array<std::uint32_t, 3> gridPoint{};
+    for (unsigned d = 0; d < 3; ++d) {
+      const double scaled = std::floor((points[i][d] - minimum[d]) * scale);
+      gridPoint[d] = static_cast<std::uint32_t>(std::clamp(scaled, 0.0, GridMax));
+    }
+    keys[i] = curve == SpaceFillingCurve::Hilbert ? hilbertKey(gridPoint) : mortonKey(gridPoint);
+  }
+
+  std::vector<std::size_t> order(points.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+    return keys[a] < keys[b];
+  });
+  return order;
+}
+
+} // namespace seissol::geometry
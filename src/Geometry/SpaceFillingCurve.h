@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_GEOMETRY_SPACEFILLINGCURVE_H_
+#define SEISSOL_SRC_GEOMETRY_SPACEFILLINGCURVE_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace seissol::geometry {
+
+enum class SpaceFillingCurve { Morton, Hilbert };
+
+//! bits per coordinate of the integer grid the curves are evaluated on
+constexpr unsigned SpaceFillingCurveBits = 21;
+
+/**
+ * Position of the grid point on the Morton (Z-order) curve.
+ * Each coordinate needs to be smaller than 2^SpaceFillingCurveBits.
+ */
+std::uint64_t mortonKey(const std::array<std::uint32_t, 3>& point);
+
+/**
+ * Position of the grid point on the Hilbert curve (following J. Skilling, "Programming the Hilbert
+ * curve", AIP Conf. Proc. 707, 2004).
+ * Each coordinate needs to be smaller than 2^SpaceFillingCurveBits.
+ */
+std::uint64_t hilbertKey(const std::array<std::uint32_t, 3>& point);
+
+/**
+ * Returns the permutation which sorts the given points along the curve; i.e. the i-th point on the
+ * curve is points[order[i]]. The curve is laid over the bounding box of the points.
+ */
+std::vector<std::size_t> spaceFillingCurveOrder(const std::vector<std::array<double, 3>>& points,
+                                                SpaceFillingCurve curve);
+
+} // namespace seissol::geometry
+
+#endif // SEISSOL_SRC_GEOMETRY_SPACEFILLINGCURVE_H_
@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "TetrahedronBvh.h"
+
+#include "MeshTools.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace {
+// relative enlargement of the element bounding boxes
+constexpr double BoxTolerance = 1.0e-8;
+
+// bounds the depth of the tree: each level halves the number of elements, which fits into unsigned
+constexpr std::size_t MaxStackSize = 64;
+
+// subtrees over more elements are built in separate tasks
+constexpr unsigned ParallelBuildSize = 1U << 14U;
+} // namespace
+
+namespace seissol::geometry {
+
+TetrahedronBvh::TetrahedronBvh(const std::vector<Vertex>& vertices,
+                               const std::vector<Element>& elements)
+    : meshVertices(&vertices), meshElements(&elements), elementOrder(elements.size()) {
+  if (elements.empty()) {
+    return;
+  }
+
+  std::vector<Box> boxes(elements.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t elem = 0; elem < elements.size(); ++elem) {
+    auto& box = boxes[elem];
+    box.lower.fill(std::numeric_limits<double>::max());
+    box.upper.fill(std::numeric_limits<double>::lowest());
+    for (const auto vertex : elements[elem].vertices) {
+      for (int i = 0; i < 3; ++i) {
+        box.lower[i] = std::min(box.lower[i], vertices[vertex].coords[i]);
+        box.upper[i] = std::max(box.upper[i], vertices[vertex].coords[i]);
+      }
+    }
+    // (the plane test may accept points slightly outside due to rounding)
+    for (int i = 0; i < 3; ++i) {
+      const double tolerance =
+          BoxTolerance * (std::abs(box.upper[i] - box.lower[i]) + std::abs(box.lower[i]) + 1.0);
+      box.lower[i] -= tolerance;
+      box.upper[i] += tolerance;
+    }
+  }
+
+  std::iota(elementOrder.begin(), elementOrder.end(), 0U);
+  nodes.resize(subtreeSize(elements.size()));
+#ifdef _OPENMP
+#pragma omp parallel
+#pragma omp single
+#endif
+  build(boxes, 0, static_cast<unsigned>(elements.size()), 0);
+}
+
+std::size_t TetrahedronBvh::subtreeSize(std::size_t numElements) {
+  // the ranges on one level have the same size up to one; count the smaller and larger ones
+  std::size_t size = 0;
+  std::size_t smallSize = numElements;
+  std::size_t numSmall = 1;
+  std::size_t numLarge = 0;
+  while (numSmall + numLarge > 0) {
+    size += numSmall + numLarge;
+    const std::size_t nextSmallSize = smallSize / 2;
+    std::size_t nextNumSmall = 0;
+    std::size_t nextNumLarge = 0;
+    const auto split = [&](std::size_t rangeSize, std::size_t numRanges) {
+      if (rangeSize > LeafSize) {
+        for (const auto childSize : {rangeSize / 2, rangeSize - rangeSize / 2}) {
+          (childSize == nextSmallSize ? nextNumSmall : nextNumLarge) += numRanges;
+        }
+      }
+    };
+    split(smallSize, numSmall);
+    split(smallSize + 1, numLarge);
+    smallSize = nextSmallSize;
+    numSmall = nextNumSmall;
+    numLarge = nextNumLarge;
+  }
+  return size;
+}
+
+void TetrahedronBvh::build(const std::vector<Box>& boxes,
+                           unsigned begin,
+                           unsigned end,
+                           unsigned nodeId) {
+  auto& node = nodes[nodeId];
+  node.lower.fill(std::numeric_limits<double>::max());
+  node.upper.fill(std::numeric_limits<double>::lowest());
+
+  if (end - begin <= LeafSize) {
+    for (unsigned position = begin; position < end; ++position) {
+      const auto& box = boxes[elementOrder[position]];
+      for (int i = 0; i < 3; ++i) {
+        node.lower[i] = std::min(node.lower[i], box.lower[i]);
+        node.upper[i] = std::max(node.upper[i], box.upper[i]);
+      }
+    }
+    node.index = begin;
+    node.count = end - begin;
+    return;
+  }
+
+  // split at the median of the centroids (times two) along the axis of their largest extent
+  std::array<double, 3> centroidLower = node.lower;
+  std::array<double, 3> centroidUpper = node.upper;
+  for (unsigned position = begin; position < end; ++position) {
+    const auto& box = boxes[elementOrder[position]];
+    for (int i = 0; i < 3; ++i) {
+      const double centroid = box.lower[i] + box.upper[i];
+      centroidLower[i] = std::min(centroidLower[i], centroid);
+      centroidUpper[i] = std::max(centroidUpper[i], centroid);
+    }
+  }
+  int axis = 0;
+  for (int i = 1; i < 3; ++i) {
+    if (centroidUpper[i] - centroidLower[i] > centroidUpper[axis] - centroidLower[axis]) {
+      axis = i;
+    }
+  }
+  const unsigned middle = begin + (end - begin) / 2;
+  std::nth_element(elementOrder.begin() + begin,
+                   elementOrder.begin() + middle,
+                   elementOrder.begin() + end,
+                   [&](unsigned first, unsigned second) {
+                     const double firstCentroid =
+                         boxes[first].lower[axis] + boxes[first].upper[axis];
+                     const double secondCentroid =
+                         boxes[second].lower[axis] + boxes[second].upper[axis];
+                     return firstCentroid < secondCentroid ||
+                            (firstCentroid == secondCentroid && first < second);
+                   });
+
+  // the left subtree follows its parent; the right one follows the left one
+  const unsigned left = nodeId + 1;
+  const auto right = static_cast<unsigned>(left + subtreeSize(middle - begin));
+#ifdef _OPENMP
+#pragma omp task default(shared) if (end - begin > ParallelBuildSize)
+#endif
+  build(boxes, begin, middle, left);
+  build(boxes, middle, end, right);
+#ifdef _OPENMP
+#pragma omp taskwait
+#endif
+
+  for (const auto child : {left, right}) {
+    for (int i = 0; i < 3; ++i) {
+      node.lower[i] = std::min(node.lower[i], nodes[child].lower[i]);
+      node.upper[i] = std::max(node.upper[i], nodes[child].upper[i]);
+    }
+  }
+  node.index = right;
+  node.count = 0;
+}
+
+std::size_t TetrahedronBvh::locate(const Eigen::Vector3d& point) const {
+  std::size_t found = NotFound;
+  if (nodes.empty()) {
+    return found;
+  }
+
+  std::array<unsigned, MaxStackSize> stack{};
+  std::size_t stackSize = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const auto nodeId = stack[--stackSize];
+    const auto& node = nodes[nodeId];
+    bool inside = true;
+    for (int i = 0; i < 3; ++i) {
+      inside = inside && node.lower[i] <= point(i) && point(i) <= node.upper[i];
+    }
+    if (!inside) {
+      continue;
+    }
+    if (node.count > 0) {
+      for (unsigned position = node.index; position < node.index + node.count; ++position) {
+        const auto elem = elementOrder[position];
+        /* It might actually happen that a point is found in two tetrahedrons
+         * if it lies on the boundary. In this case we arbitrarily assign
+         * it to the one with the lower localId. */
+        if ((found == NotFound ||
+             (*meshElements)[elem].localId < (*meshElements)[found].localId) &&
+            contains(elem, point)) {
+          found = elem;
+        }
+      }
+    } else {
+      stack[stackSize++] = node.index;
+      stack[stackSize++] = nodeId + 1;
+    }
+  }
+  return found;
+}
+
+bool TetrahedronBvh::contains(std::size_t element, const Eigen::Vector3d& point) const {
+  const auto& tetrahedron = (*meshElements)[element];
+  for (int face = 0; face < 4; ++face) {
+    VrtxCoords n{};
+    VrtxCoords p{};
+    MeshTools::pointOnPlane(tetrahedron, face, *meshVertices, p);
+    MeshTools::normal(tetrahedron, face, *meshVertices, n);
+
+    const std::array<double, 4> planeEquation = {n[0], n[1], n[2], -MeshTools::dot(n, p)};
+    const std::array<double, 4> homogeneousPoint = {point(0), point(1), point(2), 1.0};
+    double resultFace = 0;
+    for (int dim = 0; dim < 4; ++dim) {
+      resultFace += planeEquation[dim] * homogeneousPoint[dim];
+    }
+    if (resultFace > 0.0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace seissol::geometry
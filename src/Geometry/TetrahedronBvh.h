@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_GEOMETRY_TETRAHEDRONBVH_H_
+#define SEISSOL_SRC_GEOMETRY_TETRAHEDRONBVH_H_
+
+#include "MeshDefinition.h"
+
+#include <Eigen/Dense>
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace seissol::geometry {
+
+/**
+ * Bounding volume hierarchy over the tetrahedra of a mesh, for locating points.
+ *
+ * The tree is built once by median splits of the element centroids along the axis of their
+ * largest extent, until a leaf holds at most LeafSize elements. As the splits halve the ranges,
+ * the size of each subtree is known in advance; hence, the subtrees are built in parallel tasks. The element bounding boxes are
+ * enlarged slightly, s.t. all points accepted by the (rounded) plane test of an element are found.
+ * The hierarchy refers to the given vertices and elements; they need to outlive it unchanged.
+ */
+class TetrahedronBvh {
+  public:
+  static constexpr unsigned LeafSize = 4;
+
+  //! returned by locate() for points outside of all elements
+  static constexpr std::size_t NotFound = std::numeric_limits<std::size_t>::max();
+
+  TetrahedronBvh(const std::vector<Vertex>& vertices, const std::vector<Element>& elements);
+
+  /**
+   * Index of the element which contains the point, or NotFound.
+   * A point on the boundary between elements is assigned to the one with the lowest localId.
+   */
+  [[nodiscard]] std::size_t locate(const Eigen::Vector3d& point) const;
+
+  //! plane test of the point against the faces of the element
+  [[nodiscard]] bool contains(std::size_t element, const Eigen::Vector3d& point) const;
+
+  [[nodiscard]] const std::vector<Vertex>& vertices() const { return *meshVertices; }
+  [[nodiscard]] const std::vector<Element>& elements() const { return *meshElements; }
+
+  [[nodiscard]] std::size_t numberOfNodes() const { return nodes.size(); }
+
+  private:
+  struct Node {
+    std::array<double, 3> lower;
+    std::array<double, 3> upper;
+    // leaf: the first position in elementOrder; inner node: the right child (the left one follows)
+    unsigned index;
+    // number of elements in a leaf, 0 for inner nodes
+    unsigned count;
+  };
+
+  struct Box {
+    std::array<double, 3> lower;
+    std::array<double, 3> upper;
+  };
+
+  //! number of nodes of the (sub)tree over the given number of elements
+  static std::size_t subtreeSize(std::size_t numElements);
+
+  //! builds the subtree over elementOrder[begin, end), rooted in nodes[nodeId]
+  void build(const std::vector<Box>& boxes, unsigned begin, unsigned end, unsigned nodeId);
+
+  const std::vector<Vertex>* meshVertices;
+  const std::vector<Element>* meshElements;
+  std::vector<Node> nodes;
+  std::vector<unsigned> elementOrder;
+};
+
+} // namespace seissol::geometry
+
+#endif // SEISSOL_SRC_GEOMETRY_TETRAHEDRONBVH_H_
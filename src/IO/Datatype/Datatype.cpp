@@ -7,7 +7,10 @@
 #include <algorithm>
 #include <array>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iomanip>
 #include <memory>
 #include <optional>
@@ -95,10 +98,57 @@ std::optional<std::vector<char>> fromStringRawPrimitive(const std::string& str)
   std::copy_n(valuePtr, sizeof(T), data.begin());
   return std::make_optional(data);
 }
+
 } // namespace
 
 namespace seissol::io::datatype {
 
+float halfToFloat(std::uint16_t half) {
+  const std::uint32_t sign = static_cast<std::uint32_t>(half & 0x8000U) << 16U;
+  const std::uint32_t exponent = (half >> 10U) & 0x1fU;
+  const std::uint32_t mantissa = half & 0x3ffU;
+  if (exponent == 0) {
+    // zero or subnormal
+    const float value = std::ldexp(static_cast<float>(mantissa), -24);
+    return sign != 0 ? -value : value;
+  }
+  std::uint32_t bits = 0;
+  if (exponent == 0x1fU) {
+    bits = sign | 0x7f800000U | (mantissa << 13U);
+  } else {
+    bits = sign | ((exponent + 112U) << 23U) | (mantissa << 13U);
+  }
+  float value = 0;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+std::uint16_t floatToHalf(float value) {
+  std::uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const auto sign = static_cast<std::uint16_t>((bits >> 16U) & 0x8000U);
+  const std::uint32_t absBits = bits & 0x7fffffffU;
+  if (absBits >= 0x7f800000U) {
+    // infinity or NaN
+    return sign | 0x7c00U | (absBits > 0x7f800000U ? 0x200U : 0U);
+  }
+  if (absBits >= 0x477ff000U) {
+    // rounds to a value beyond the largest half (65504)
+    return sign | 0x7c00U;
+  }
+  if (absBits < 0x38800000U) {
+    // subnormal half (or zero); the rounding mode is round-to-nearest-even by default
+    return sign | static_cast<std::uint16_t>(std::nearbyint(std::fabs(value) * 16777216.0F));
+  }
+  // rebias the exponent, and round the mantissa to nearest even
+  std::uint32_t half = (absBits - 0x38000000U) >> 13U;
+  const std::uint32_t rest = absBits & 0x1fffU;
+  if (rest > 0x1000U || (rest == 0x1000U && (half & 1U) != 0)) {
+    ++half;
+  }
+  return sign | static_cast<std::uint16_t>(half);
+}
+
 Datatype::~Datatype() = default;
 
 Array::Array(std::shared_ptr<Datatype> type, const std::vector<std::size_t>& dimensions)
@@ -165,6 +215,30 @@ std::optional<std::vector<char>> StringDatatype::fromStringRaw(const std::string
   return std::make_optional(std::vector<char>(str.begin(), str.end()));
 }
 
+std::size_t F16Datatype::size() const { return 2; }
+
+YAML::Node F16Datatype::serialize() const {
+  YAML::Node node;
+  node["type"] = "f16";
+  return node;
+}
+
+std::string F16Datatype::toStringRaw(const void* data) const {
+  std::uint16_t half = 0;
+  std::memcpy(&half, data, sizeof(half));
+  const float value = halfToFloat(half);
+  return toStringRawPrimitive<float>(&value, 4);
+}
+std::optional<std::vector<char>> F16Datatype::fromStringRaw(const std::string& str) const {
+  const auto single = fromStringRawPrimitive<float>(str);
+  float value = 0;
+  std::memcpy(&value, single.value().data(), sizeof(value));
+  const std::uint16_t half = floatToHalf(value);
+  std::vector<char> data(sizeof(half));
+  std::memcpy(data.data(), &half, sizeof(half));
+  return std::make_optional(data);
+}
+
 std::size_t F32Datatype::size() const { return 4; }
 
 YAML::Node F32Datatype::serialize() const {
@@ -325,6 +399,9 @@ std::size_t StructDatatype::minSize(const std::vector<MemberInfo>& members) {
 
 std::shared_ptr<Datatype> Datatype::deserialize(YAML::Node node) {
   auto type = node["type"].as<std::string>();
+  if (type == "f16") {
+    return std::make_shared<F16Datatype>();
+  }
   if (type == "f32") {
     return std::make_shared<F32Datatype>();
   }
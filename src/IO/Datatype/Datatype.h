@@ -5,6 +5,7 @@
 #ifndef SEISSOL_SRC_IO_DATATYPE_DATATYPE_H_
 #define SEISSOL_SRC_IO_DATATYPE_DATATYPE_H_
 
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
@@ -85,6 +86,22 @@ class StringDatatype : public Datatype {
   std::size_t sizeP;
 };
 
+// conversions between float and IEEE 754 half precision (given as its bit pattern); the conversion
+// to half rounds to nearest even, and overflows to infinity
+float halfToFloat(std::uint16_t half);
+std::uint16_t floatToHalf(float value);
+
+// IEEE 754 half precision; only used as a storage type (e.g. for reduced-precision output)
+class F16Datatype : public Datatype {
+  public:
+  std::size_t size() const override;
+
+  YAML::Node serialize() const override;
+
+  std::string toStringRaw(const void* data) const override;
+  std::optional<std::vector<char>> fromStringRaw(const std::string& str) const override;
+};
+
 class F32Datatype : public Datatype {
   public:
   std::size_t size() const override;
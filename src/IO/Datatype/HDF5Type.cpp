@@ -49,6 +49,21 @@ hid_t convertStruct(const seissol::io::datatype::StructDatatype& datatype) {
   return handle;
 }
 
+hid_t convertF16() {
+  // IEEE 754 half precision (cf. H5T_IEEE_F16LE, which is only available in newer HDF5 versions).
+  // The type is created once, and locked s.t. it can be returned like the predefined types.
+  static const hid_t Handle = []() {
+    const hid_t handle = _eh(H5Tcopy(H5T_IEEE_F32LE));
+    _eh(H5Tset_fields(handle, 15, 10, 5, 0, 10));
+    _eh(H5Tset_precision(handle, 16));
+    _eh(H5Tset_size(handle, 2));
+    _eh(H5Tset_ebias(handle, 15));
+    _eh(H5Tlock(handle));
+    return handle;
+  }();
+  return Handle;
+}
+
 hid_t convertInteger(const seissol::io::datatype::IntegerDatatype& datatype) {
   if (datatype.size() == 1) {
     return datatype.sign() ? H5T_STD_I8LE : H5T_STD_U8LE;
@@ -75,6 +90,8 @@ hid_t convertToHdf5(const std::shared_ptr<Datatype>& datatype) {
     return convertStruct(dynamic_cast<const StructDatatype&>(*datatype));
   } else if (dynamic_cast<const IntegerDatatype*>(datatype.get()) != nullptr) {
     return convertInteger(dynamic_cast<const IntegerDatatype&>(*datatype));
+  } else if (dynamic_cast<const F16Datatype*>(datatype.get()) != nullptr) {
+    return convertF16();
   } else if (dynamic_cast<const F32Datatype*>(datatype.get()) != nullptr) {
     return H5T_NATIVE_FLOAT;
   } else if (dynamic_cast<const F64Datatype*>(datatype.get()) != nullptr) {
@@ -99,6 +99,10 @@ MPI_Datatype convertToMPI(const std::shared_ptr<Datatype>& datatype, bool autoco
   } else if (dynamic_cast<const IntegerDatatype*>(datatype.get()) != nullptr) {
     type = convertInteger(dynamic_cast<const IntegerDatatype&>(*datatype));
     needsCommit = false;
+  } else if (dynamic_cast<const F16Datatype*>(datatype.get()) != nullptr) {
+    // MPI has no half-precision type; the values are only moved, not reduced
+    type = MPI_UINT16_T;
+    needsCommit = false;
   } else if (dynamic_cast<const F32Datatype*>(datatype.get()) != nullptr) {
     type = MPI_FLOAT;
     needsCommit = false;
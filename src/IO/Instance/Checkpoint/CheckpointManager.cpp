@@ -5,36 +5,157 @@
 #include "CheckpointManager.h"
 
 #include <Common/Constants.h>
+#include <Common/Filesystem.h>
+#include <IO/Datatype/Datatype.h>
 #include <IO/Datatype/Inference.h>
 #include <IO/Datatype/MPIType.h>
 #include <IO/Reader/Distribution.h>
 #include <IO/Reader/File/Hdf5Reader.h>
+#include <IO/Writer/File/StagingFile.h>
 #include <IO/Writer/Instructions/Data.h>
 #include <IO/Writer/Instructions/Hdf5.h>
 #include <IO/Writer/Writer.h>
 #include <Initializer/Tree/LTSTree.h>
 #include <Initializer/Tree/Layer.h>
 #include <Parallel/MPI.h>
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
-#include <cstdlib>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <memory>
 #include <mpi.h>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "utils/logger.h"
 
+namespace {
+// the amount of data per variable which is read (and redistributed) at once when loading
+constexpr std::size_t LoadRoundBytes = 256 * 1024 * 1024;
+
+std::shared_ptr<seissol::io::datatype::Datatype>
+    singlePrecision(const std::shared_ptr<seissol::io::datatype::Datatype>& type) {
+  using namespace seissol::io::datatype;
+  if (dynamic_cast<F64Datatype*>(type.get()) != nullptr) {
+    return std::make_shared<F32Datatype>();
+  }
+  if (auto* array = dynamic_cast<ArrayDatatype*>(type.get()); array != nullptr) {
+    return std::make_shared<ArrayDatatype>(singlePrecision(array->base()), array->dimensions());
+  }
+  return type;
+}
+
+std::string constantFileName(const std::string& prefix, std::size_t counter) {
+  return prefix + std::string("-checkpoint-constant-") + std::to_string(counter) + ".h5";
+}
+
+std::uint64_t hashIds(const std::string& name, const std::vector<std::size_t>& ids) {
+  // FNV-1a
+  constexpr std::uint64_t Prime = 0x100000001b3ULL;
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : name) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * Prime;
+  }
+  for (const auto id : ids) {
+    hash = (hash ^ id) * Prime;
+  }
+  return hash;
+}
+
+std::string stagingPath(const std::string& directory, const std::string& prefix) {
+  const auto name = seissol::filesystem::path(prefix).filename().string();
+  return (seissol::filesystem::path(directory) / (name + "-checkpoint")).string();
+}
+
+// incremental checkpoints keep the global IDs in a separate file; if so, open it
+void openConstantData(seissol::io::reader::file::Hdf5Reader& reader,
+                      const std::string& file,
+                      std::optional<seissol::io::reader::file::Hdf5Reader>& idReader) {
+  if (!reader.hasAttribute("__constant")) {
+    return;
+  }
+  const auto constantCounter = reader.readAttributeScalar<std::size_t>("__constant");
+  const auto signature = reader.readAttributeScalar<std::uint64_t>("__signature");
+  const auto prefixEnd = file.rfind("-checkpoint-");
+  if (prefixEnd == std::string::npos) {
+    logError() << "Could not derive the constant checkpoint data file name from" << file;
+  }
+  const auto idFile = constantFileName(file.substr(0, prefixEnd), constantCounter);
+  logInfo(seissol::MPI::mpi.rank()) << "Constant checkpoint data file:" << idFile;
+  idReader.emplace(seissol::MPI::mpi.comm());
+  idReader->openFile(idFile);
+  idReader->openGroup("checkpoint");
+  if (idReader->readAttributeScalar<std::uint64_t>("__signature") != signature) {
+    logError() << "The constant checkpoint data in" << idFile << "does not belong to" << file;
+  }
+}
+
+// expects the group of the tree to be open in the reader
+std::vector<std::size_t>
+    readGroupIds(seissol::io::reader::file::Hdf5Reader& reader,
+                 std::optional<seissol::io::reader::file::Hdf5Reader>& idReader,
+                 const std::string& treeName) {
+  if (idReader.has_value()) {
+    idReader->openGroup(treeName);
+    auto groupIds = idReader->readData<std::size_t>("__ids");
+    idReader->closeGroup();
+    return groupIds;
+  }
+  return reader.readData<std::size_t>("__ids");
+}
+
+std::uint64_t mix(std::uint64_t value) {
+  // (the splitmix64 finalizer)
+  value = (value ^ (value >> 30U)) * 0xbf58476d1ce4e5b9ULL;
+  value = (value ^ (value >> 27U)) * 0x94d049bb133111ebULL;
+  return value ^ (value >> 31U);
+}
+} // namespace
+
 namespace seissol::io::instance::checkpoint {
 
+std::uint64_t CheckpointManager::layoutSignature() const {
+  // independent of the order of the trees, but not of the order of the ranks
+  std::uint64_t local = 0;
+  for (const auto& [_, ckpTree] : dataRegistry) {
+    local += hashIds(ckpTree.name, ckpTree.ids);
+  }
+  local = mix(local + mix(MPI::mpi.rank()));
+  std::uint64_t global = 0;
+  MPI_Allreduce(&local,
+                &global,
+                1,
+                datatype::convertToMPI(datatype::inferDatatype<std::uint64_t>()),
+                MPI_SUM,
+                MPI::mpi.comm());
+  return global;
+}
+
 std::function<writer::Writer(const std::string&, std::size_t, double)>
     CheckpointManager::makeWriter() {
   auto dataRegistry = this->dataRegistry;
-  return [=](const std::string& prefix, std::size_t counter, double time) -> writer::Writer {
+  const auto options = this->writeOptions;
+  const auto signature = options.incremental ? layoutSignature() : 0;
+  std::optional<std::size_t> constantCounter;
+  return [=](const std::string& prefix,
+             std::size_t counter,
+             double time) mutable -> writer::Writer {
     writer::Writer writer;
+    if (!options.localDirectory.empty()) {
+      writer.setStagingPath(stagingPath(options.localDirectory, prefix));
+    }
     const auto filename = prefix + std::string("-checkpoint-") + std::to_string(counter) + ".h5";
+    const bool writeConstant = !options.incremental || !constantCounter.has_value();
+    if (options.incremental && !constantCounter.has_value()) {
+      constantCounter = counter;
+    }
+    const auto idFilename =
+        options.incremental ? constantFileName(prefix, constantCounter.value()) : filename;
     for (const auto& [_, ckpTree] : dataRegistry) {
       const std::size_t cells = ckpTree.tree->getNumberOfCells(Ghost);
       assert(cells == ckpTree.ids.size());
@@ -45,20 +166,43 @@ std::function<writer::Writer(const std::string&, std::size_t, double)>
                     datatype::convertToMPI(datatype::inferDatatype<std::size_t>()),
                     MPI_SUM,
                     MPI::mpi.comm());
-      writer.addInstruction(std::make_shared<writer::instructions::Hdf5DataWrite>(
-          writer::instructions::Hdf5Location(filename, {"checkpoint", ckpTree.name}),
-          "__ids",
-          writer::WriteBuffer::create(ckpTree.ids.data(), ckpTree.ids.size()),
-          datatype::inferDatatype<std::size_t>()));
+      if (writeConstant) {
+        writer.addInstruction(std::make_shared<writer::instructions::Hdf5DataWrite>(
+            writer::instructions::Hdf5Location(idFilename, {"checkpoint", ckpTree.name}),
+            "__ids",
+            writer::WriteBuffer::create(ckpTree.ids.data(), ckpTree.ids.size()),
+            datatype::inferDatatype<std::size_t>(),
+            options.compression));
+      }
       for (const auto& variable : ckpTree.variables) {
+        const auto targetType = (options.lossy && variable.allowLossy)
+                                    ? singlePrecision(variable.datatype)
+                                    : variable.datatype;
         writer.addInstruction(std::make_shared<writer::instructions::Hdf5DataWrite>(
             writer::instructions::Hdf5Location(filename, {"checkpoint", ckpTree.name}),
             variable.name,
             std::make_shared<writer::WriteBuffer>(
                 variable.data, cells, variable.datatype, std::vector<std::size_t>()),
-            variable.datatype));
+            targetType,
+            options.compression));
       }
     }
+    if (options.incremental) {
+      if (writeConstant) {
+        writer.addInstruction(std::make_shared<writer::instructions::Hdf5AttributeWrite>(
+            writer::instructions::Hdf5Location(idFilename, {"checkpoint"}),
+            "__signature",
+            writer::WriteInline::create(signature)));
+      }
+      writer.addInstruction(std::make_shared<writer::instructions::Hdf5AttributeWrite>(
+          writer::instructions::Hdf5Location(filename, {"checkpoint"}),
+          "__constant",
+          writer::WriteInline::create(constantCounter.value())));
+      writer.addInstruction(std::make_shared<writer::instructions::Hdf5AttributeWrite>(
+          writer::instructions::Hdf5Location(filename, {"checkpoint"}),
+          "__signature",
+          writer::WriteInline::create(signature)));
+    }
     writer.addInstruction(std::make_shared<writer::instructions::Hdf5AttributeWrite>(
         writer::instructions::Hdf5Location(filename, {"checkpoint"}),
         "__time",
@@ -71,13 +215,106 @@ std::function<writer::Writer(const std::string&, std::size_t, double)>
   };
 }
 
-double CheckpointManager::loadCheckpoint(const std::string& file) {
-  std::size_t storesize = 1;
-  void* datastore = std::malloc(1);
+std::optional<double> CheckpointManager::loadLocalCheckpoint(const std::string& file) {
+  const auto prefixEnd = file.rfind("-checkpoint-");
+  if (writeOptions.localDirectory.empty() || prefixEnd == std::string::npos) {
+    return {};
+  }
+  const auto signature = layoutSignature();
+  const auto localFile = writer::file::StagingFile::fileName(
+      stagingPath(writeOptions.localDirectory, file.substr(0, prefixEnd)), MPI::mpi.rank());
+
+  // the staged copy contains the write plan of the checkpoint; thus, look up the data from there
+  std::unique_ptr<writer::file::StagingFile> staged;
+  std::unordered_map<std::string, std::pair<const void*, std::size_t>> datasets;
+  std::unordered_map<std::string, const void*> attributes;
+  bool usable = seissol::filesystem::exists(localFile);
+  if (usable) {
+    staged = std::make_unique<writer::file::StagingFile>(localFile);
+    const auto plan = writer::Writer(staged->plan());
+    const auto targetName = seissol::filesystem::path(file).filename().string();
+    bool containsTarget = false;
+    for (const auto& instruction : plan.getInstructions()) {
+      if (auto* write = dynamic_cast<writer::instructions::Hdf5DataWrite*>(instruction.get())) {
+        auto* source = dynamic_cast<writer::WriteBufferRemote*>(write->dataSource.get());
+        const auto groups = write->location.groups();
+        if (source != nullptr && staged->hasBuffer(source->bufferId()) && groups.size() == 2) {
+          datasets[groups[1] + "/" + write->name] = {staged->buffer(source->bufferId()),
+                                                     staged->bufferSize(source->bufferId())};
+        }
+      }
+      if (auto* write =
+              dynamic_cast<writer::instructions::Hdf5AttributeWrite*>(instruction.get())) {
+        if (seissol::filesystem::path(write->location.file()).filename().string() == targetName) {
+          containsTarget = true;
+          attributes[write->name] = write->dataSource->getLocalPointer();
+        }
+      }
+    }
+    const auto attribute = [&](const std::string& name, auto& value) {
+      if (attributes.find(name) == attributes.end()) {
+        return false;
+      }
+      std::memcpy(&value, attributes.at(name), sizeof(value));
+      return true;
+    };
+    int order = 0;
+    std::uint64_t stagedSignature = 0;
+    usable = containsTarget && staged->commsize() == MPI::mpi.size() &&
+             attribute("__order", order) && order == ConvergenceOrder &&
+             attributes.find("__time") != attributes.end();
+    const bool signatureMatches = attribute("__signature", stagedSignature) &&
+                                  stagedSignature == signature && signature != 0;
+    for (const auto& [_, ckpTree] : dataRegistry) {
+      const auto ids = datasets.find(ckpTree.name + "/__ids");
+      const bool idsMatch =
+          ids != datasets.end() && ids->second.second == ckpTree.ids.size() * sizeof(std::size_t) &&
+          std::memcmp(ids->second.first, ckpTree.ids.data(), ids->second.second) == 0;
+      usable = usable && (idsMatch || signatureMatches);
+      for (const auto& variable : ckpTree.variables) {
+        if (variable.writeOnly) {
+          continue;
+        }
+        const auto data = datasets.find(ckpTree.name + "/" + variable.name);
+        usable = usable && data != datasets.end() &&
+                 data->second.second == ckpTree.ids.size() * variable.datatype->size();
+      }
+    }
+  }
+
+  int allUsable = usable ? 1 : 0;
+  MPI_Allreduce(MPI_IN_PLACE, &allUsable, 1, MPI_INT, MPI_MIN, MPI::mpi.comm());
+  if (allUsable == 0) {
+    logInfo(MPI::mpi.rank())
+        << "No matching local copy of the checkpoint on all ranks; reading the checkpoint file.";
+    return {};
+  }
+
+  logInfo(MPI::mpi.rank()) << "Reading the local copy of the checkpoint:" << localFile;
+  for (auto& [_, ckpTree] : dataRegistry) {
+    for (auto& variable : ckpTree.variables) {
+      if (variable.writeOnly) {
+        continue;
+      }
+      const auto& data = datasets.at(ckpTree.name + "/" + variable.name);
+      std::memcpy(variable.data, data.first, data.second);
+    }
+  }
+  double time = 0;
+  std::memcpy(&time, attributes.at("__time"), sizeof(time));
+  logInfo(MPI::mpi.rank()) << "Checkpoint loading complete.";
+  return time;
+}
 
+double CheckpointManager::loadCheckpoint(const std::string& file) {
   logInfo(seissol::MPI::mpi.rank()) << "Loading checkpoint...";
   logInfo(seissol::MPI::mpi.rank()) << "Checkpoint file:" << file;
 
+  // prefer the node-local copy (if it is still there and the rank layout did not change)
+  if (const auto time = loadLocalCheckpoint(file); time.has_value()) {
+    return time.value();
+  }
+
   auto reader = reader::file::Hdf5Reader(seissol::MPI::mpi.comm());
   reader.openFile(file);
   reader.openGroup("checkpoint");
@@ -85,46 +322,94 @@ double CheckpointManager::loadCheckpoint(const std::string& file) {
   if (convergenceOrderRead != ConvergenceOrder) {
     logError() << "Convergence order does not match. Read:" << convergenceOrderRead;
   }
+
+  std::optional<reader::file::Hdf5Reader> idReader;
+  openConstantData(reader, file, idReader);
+
+  std::vector<char> datastore;
   for (auto& [_, ckpTree] : dataRegistry) {
     reader.openGroup(ckpTree.name);
     auto distributor = reader::Distributor(seissol::MPI::mpi.comm());
 
     logInfo(seissol::MPI::mpi.rank()) << "Reading group IDs for" << ckpTree.name;
-    auto groupIds = reader.readData<std::size_t>("__ids");
+    const auto groupIds = readGroupIds(reader, idReader, ckpTree.name);
     distributor.setup(groupIds, ckpTree.ids);
 
-    std::vector<reader::Distributor::DistributionInstance> distributions;
-    distributions.reserve(ckpTree.variables.size());
+    // stream the variables in rounds of bounded size, instead of reading them as a whole
+    std::size_t maxTypeSize = 1;
+    for (const auto& variable : ckpTree.variables) {
+      maxTypeSize = std::max(maxTypeSize, variable.datatype->size());
+    }
+    const std::size_t roundSize = std::max(std::size_t(1), LoadRoundBytes / maxTypeSize);
+    const std::size_t rounds = distributor.setupRounds(roundSize);
+    datastore.resize(std::min(roundSize, groupIds.size()) * maxTypeSize);
+
     for (auto& variable : ckpTree.variables) {
+      if (variable.writeOnly) {
+        continue;
+      }
       logInfo(seissol::MPI::mpi.rank())
           << "Reading variable" << ckpTree.name << "/" << variable.name;
       const std::size_t count = reader.dataCount(variable.name);
-      const std::size_t currsize = count * variable.datatype->size();
-      if (currsize > storesize) {
-        datastore = std::realloc(datastore, currsize);
-        storesize = currsize;
+      for (std::size_t round = 0; round < rounds; ++round) {
+        const std::size_t offset = std::min(round * roundSize, count);
+        const std::size_t roundCount = std::min(roundSize, count - offset);
+        reader.readDataRawRange(
+            datastore.data(), variable.name, offset, roundCount, variable.datatype);
+        distributor
+            .distributeRound(round,
+                             variable.data,
+                             static_cast<const void*>(datastore.data()),
+                             datatype::convertToMPI(variable.datatype))
+            .complete();
       }
-      reader.readDataRaw(datastore, variable.name, count, variable.datatype);
-      const auto distribution = distributor.distribute(
-          variable.data, datastore, datatype::convertToMPI(variable.datatype));
-      distributions.push_back(distribution);
-    }
-    logInfo(seissol::MPI::mpi.rank()) << "Finishing data distribution for" << ckpTree.name;
-    for (auto& distribution : distributions) {
-      distribution.complete();
     }
 
     reader.closeGroup();
   }
+  if (idReader.has_value()) {
+    idReader->closeGroup();
+    idReader->closeFile();
+  }
   const auto time = reader.readAttributeScalar<double>("__time");
   reader.closeGroup();
   reader.closeFile();
 
   logInfo(seissol::MPI::mpi.rank()) << "Checkpoint loading complete.";
 
-  std::free(datastore);
-
   return time;
 }
 
+std::optional<std::vector<double>>
+    CheckpointManager::readWriteOnlyData(const std::string& file,
+                                         const std::string& treeName,
+                                         const std::string& name,
+                                         const std::vector<std::size_t>& ids) {
+  auto reader = reader::file::Hdf5Reader(seissol::MPI::mpi.comm());
+  reader.openFile(file);
+  reader.openGroup("checkpoint");
+  std::optional<reader::file::Hdf5Reader> idReader;
+  openConstantData(reader, file, idReader);
+
+  std::optional<std::vector<double>> result;
+  reader.openGroup(treeName);
+  if (reader.hasDataset(name)) {
+    const auto groupIds = readGroupIds(reader, idReader, treeName);
+    const auto data = reader.readData<double>(name);
+    auto distributor = reader::Distributor(seissol::MPI::mpi.comm());
+    distributor.setup(groupIds, ids);
+    result.emplace(ids.size());
+    distributor.distribute(result->data(), data.data()).complete();
+  }
+  reader.closeGroup();
+
+  if (idReader.has_value()) {
+    idReader->closeGroup();
+    idReader->closeFile();
+  }
+  reader.closeGroup();
+  reader.closeFile();
+  return result;
+}
+
 } // namespace seissol::io::instance::checkpoint
@@ -14,8 +14,11 @@
 #include <IO/Writer/Writer.h>
 #include <Initializer/Tree/LTSTree.h>
 #include <Initializer/Tree/Layer.h>
+#include <cstdint>
+#include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "utils/logger.h"
 
@@ -25,6 +28,22 @@ struct CheckpointVariable {
   std::string name;
   void* data;
   std::shared_ptr<datatype::Datatype> datatype;
+  // the variable may be stored in single precision (i.e. it is not needed bit-exact for a restart)
+  bool allowLossy{false};
+  // the variable is not restored when loading the checkpoint (cf. readWriteOnlyData)
+  bool writeOnly{false};
+};
+
+struct CheckpointWriteOptions {
+  // deflate level for all checkpoint data (0: no compression); lossless
+  int compression{0};
+  // store the variables which allow it in single precision
+  bool lossy{false};
+  // write the constant data (i.e. the global IDs) only once and reference it from all checkpoints
+  bool incremental{false};
+  // if not empty: stage each checkpoint in this (node-local) directory first, and write it to the
+  // checkpoint file in the background
+  std::string localDirectory;
 };
 
 struct CheckpointTree {
@@ -47,20 +66,51 @@ class CheckpointManager {
   template <typename T>
   void registerData(const std::string& name,
                     initializer::LTSTree* tree,
-                    initializer::Variable<T> var) {
+                    initializer::Variable<T> var,
+                    bool allowLossy = false) {
     if (var.mask != initializer::LayerMask(Ghost)) {
       logError() << "Invalid layer mask for a checkpointing variable (i.e.: NYI).";
     }
     dataRegistry[tree].variables.emplace_back(
-        CheckpointVariable{name, tree->var(var), datatype::inferDatatype<T>()});
+        CheckpointVariable{name, tree->var(var), datatype::inferDatatype<T>(), allowLossy});
+  }
+
+  // registers data which is written with each checkpoint, but not restored when loading it
+  void registerWriteOnlyData(const std::string& name,
+                             initializer::LTSTree* tree,
+                             std::vector<double>& data) {
+    if (data.size() != tree->getNumberOfCells(Ghost)) {
+      logError() << "The checkpoint variable" << name << "does not match the size of its tree.";
+    }
+    dataRegistry[tree].variables.emplace_back(CheckpointVariable{
+        name, data.data(), datatype::inferDatatype<double>(), false, true});
   }
 
+  void setWriteOptions(const CheckpointWriteOptions& options) { writeOptions = options; }
+
   std::function<writer::Writer(const std::string&, std::size_t, double)> makeWriter();
 
   double loadCheckpoint(const std::string& file);
 
+  /**
+   * Reads a write-only variable of a tree from a checkpoint, for the given global IDs.
+   * Can be used before the data structures of the tree (or the partition) exist.
+   *
+   * @return std::nullopt, if the checkpoint does not contain the variable
+   */
+  static std::optional<std::vector<double>> readWriteOnlyData(const std::string& file,
+                                                              const std::string& treeName,
+                                                              const std::string& name,
+                                                              const std::vector<std::size_t>& ids);
+
   private:
+  [[nodiscard]] std::uint64_t layoutSignature() const;
+
+  // reads the checkpoint from the staged copy in the local directory, if all ranks have one
+  std::optional<double> loadLocalCheckpoint(const std::string& file);
+
   std::unordered_map<initializer::LTSTree*, CheckpointTree> dataRegistry;
+  CheckpointWriteOptions writeOptions;
 };
 
 } // namespace seissol::io::instance::checkpoint
@@ -15,10 +15,84 @@
 #include <IO/Writer/Instructions/Instruction.h>
 #include <IO/Writer/Writer.h>
 #include <Initializer/MemoryManager.h>
+#include <algorithm>
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <string>
+#include <utility>
+#include <vector>
 
 namespace seissol::io::instance::mesh {
+
+/**
+ * Generates several point data arrays with a single pass over the elements.
+ *
+ * The projector writes the values of all components of one element at once, as
+ * [component][point]. The writer module asks for the target buffers of the arrays one after
+ * another; once all of them are known, the elements are projected in parallel, directly into them.
+ */
+template <typename T>
+class PointDataBatch {
+  public:
+  PointDataBatch(std::size_t elementCount,
+                 std::size_t pointsPerElement,
+                 std::size_t componentCount,
+                 std::vector<std::size_t> components,
+                 std::function<void(T*, std::size_t)> projector)
+      : elementCount(elementCount), pointsPerElement(pointsPerElement),
+        componentCount(componentCount), components(std::move(components)),
+        targets(this->components.size(), nullptr), projector(std::move(projector)) {}
+
+  void setTarget(std::size_t array, T* target) {
+    targets[array] = target;
+    ++received;
+    if (received == targets.size()) {
+      project();
+      received = 0;
+    }
+  }
+
+  private:
+  void project() {
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+      std::vector<T> element(componentCount * pointsPerElement);
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+      for (std::size_t i = 0; i < elementCount; ++i) {
+        projector(element.data(), i);
+        for (std::size_t j = 0; j < targets.size(); ++j) {
+          std::copy_n(element.data() + components[j] * pointsPerElement,
+                      pointsPerElement,
+                      targets[j] + i * pointsPerElement);
+        }
+      }
+    }
+  }
+
+  std::size_t elementCount;
+  std::size_t pointsPerElement;
+  std::size_t componentCount;
+  std::vector<std::size_t> components;
+  std::vector<T*> targets;
+  std::size_t received{0};
+  std::function<void(T*, std::size_t)> projector;
+};
+
+/**
+ * How a point data array is stored. Without a target type, the array is stored with the type of
+ * its data.
+ */
+struct PointDataFormat {
+  std::shared_ptr<datatype::Datatype> targetType;
+  writer::instructions::Hdf5Encoding encoding{writer::instructions::Hdf5Encoding::Convert};
+  int compress{0};
+};
+
 class VtkHdfWriter {
   public:
   VtkHdfWriter(const std::string& name,
@@ -58,6 +132,42 @@ class VtkHdfWriter {
     });
   }
 
+  /**
+   * Adds the point data arrays names, which are the components of the projector output with the
+   * indices components (out of componentCount), stored as given by formats. Cf. PointDataBatch.
+   */
+  template <typename T, typename F>
+  void addPointDataBatch(const std::vector<std::string>& names,
+                         const std::vector<std::size_t>& components,
+                         const std::vector<PointDataFormat>& formats,
+                         std::size_t componentCount,
+                         F projector) {
+    auto selfLocalElementCount = localElementCount;
+    auto selfPointsPerElement = pointsPerElement;
+    auto batch = std::make_shared<PointDataBatch<T>>(
+        localElementCount, pointsPerElement, componentCount, components, projector);
+
+    for (std::size_t array = 0; array < names.size(); ++array) {
+      const auto format = formats[array];
+      const auto targetType =
+          format.targetType != nullptr ? format.targetType : datatype::inferDatatype<T>();
+      instructions.emplace_back([=](const std::string& filename, double time) {
+        return std::make_shared<writer::instructions::Hdf5DataWrite>(
+            writer::instructions::Hdf5Location(filename, {GroupName, PointDataName}),
+            names[array],
+            std::make_shared<writer::GeneratedBuffer>(
+                selfLocalElementCount,
+                selfPointsPerElement,
+                [=](void* target) { batch->setTarget(array, reinterpret_cast<T*>(target)); },
+                datatype::inferDatatype<T>(),
+                std::vector<std::size_t>()),
+            targetType,
+            format.compress,
+            format.encoding);
+      });
+    }
+  }
+
   template <typename T, typename F>
   void addCellData(const std::string& name,
                    const std::vector<std::size_t>& dimensions,
@@ -172,6 +172,41 @@ std::pair<std::vector<std::size_t>, std::vector<std::size_t>> matchRanks(
   return {sendOffsets, sendReorder};
 }
 
+std::vector<MPI_Request> postExchange(const char* send,
+                                      char* recv,
+                                      const std::vector<std::size_t>& sendOffsets,
+                                      const std::vector<std::size_t>& recvOffsets,
+                                      MPI_Datatype datatype,
+                                      std::size_t typesize,
+                                      int tag,
+                                      MPI_Comm comm) {
+  int commsize = 0;
+  MPI_Comm_size(comm, &commsize);
+
+  std::vector<MPI_Request> requests(static_cast<std::size_t>(commsize) * 2, MPI_REQUEST_NULL);
+  for (int i = 0; i < commsize; ++i) {
+    if (sendOffsets[i + 1] > sendOffsets[i]) {
+      MPI_Isend(send + sendOffsets[i] * typesize,
+                sendOffsets[i + 1] - sendOffsets[i],
+                datatype,
+                i,
+                tag,
+                comm,
+                &requests[i]);
+    }
+    if (recvOffsets[i + 1] > recvOffsets[i]) {
+      MPI_Irecv(recv + recvOffsets[i] * typesize,
+                recvOffsets[i + 1] - recvOffsets[i],
+                datatype,
+                i,
+                tag,
+                comm,
+                &requests[static_cast<std::size_t>(commsize) + i]);
+    }
+  }
+  return requests;
+}
+
 } // namespace
 
 namespace seissol::io::reader {
@@ -302,8 +337,6 @@ Distributor::DistributionInstance
   MPI_Type_size(datatype, &typesizeInt);
   const std::size_t typesize = typesizeInt;
 
-  std::vector<MPI_Request> requests(static_cast<std::size_t>(commsize) * 2, MPI_REQUEST_NULL);
-
   const char* sourceChar = reinterpret_cast<const char*>(source);
   char* targetChar = reinterpret_cast<char*>(target);
 
@@ -317,26 +350,14 @@ Distributor::DistributionInstance
     std::memcpy(sourceReordered + i * typesize, sourceChar + sendReorder[i] * typesize, typesize);
   }
 
-  for (int i = 0; i < commsize; ++i) {
-    if (sendOffsets[i + 1] > sendOffsets[i]) {
-      MPI_Isend(sourceReordered + sendOffsets[i] * typesize,
-                sendOffsets[i + 1] - sendOffsets[i],
-                datatype,
-                i,
-                Tag,
-                comm,
-                &requests[i]);
-    }
-    if (recvOffsets[i + 1] > recvOffsets[i]) {
-      MPI_Irecv(targetReordered + recvOffsets[i] * typesize,
-                recvOffsets[i + 1] - recvOffsets[i],
-                datatype,
-                i,
-                Tag,
-                comm,
-                &requests[static_cast<std::size_t>(commsize) + i]);
-    }
-  }
+  const auto requests = postExchange(sourceReordered,
+                                     targetReordered,
+                                     sendOffsets,
+                                     recvOffsets,
+                                     datatype,
+                                     typesize,
+                                     Tag,
+                                     comm);
   const auto completion =
       [this, requests, targetChar, sourceReordered, targetReordered, typesize]() {
         // temporary hack to make requests non-const (as it will not matter)
@@ -357,6 +378,129 @@ Distributor::DistributionInstance
   return DistributionInstance(completion);
 }
 
+std::size_t Distributor::setupRounds(std::size_t roundSize) {
+  constexpr int TagRoundLabels = 31;
+
+  int commsize = 0;
+  MPI_Comm_size(comm, &commsize);
+  MPI_Datatype sizetype =
+      seissol::io::datatype::convertToMPI(seissol::io::datatype::inferDatatype<std::size_t>());
+
+  assert(roundSize > 0);
+  std::size_t localRounds = 0;
+  for (const auto position : sendReorder) {
+    localRounds = std::max(localRounds, position / roundSize + 1);
+  }
+  std::size_t rounds = 0;
+  MPI_Allreduce(&localRounds, &rounds, 1, sizetype, MPI_MAX, comm);
+
+  // tell the receiving side in which round each element will arrive
+  std::vector<std::size_t> sendLabels(sendReorder.size());
+  for (std::size_t i = 0; i < sendReorder.size(); ++i) {
+    sendLabels[i] = sendReorder[i] / roundSize;
+  }
+  std::vector<std::size_t> recvLabels(recvOffsets.back());
+  auto requests = postExchange(reinterpret_cast<const char*>(sendLabels.data()),
+                               reinterpret_cast<char*>(recvLabels.data()),
+                               sendOffsets,
+                               recvOffsets,
+                               sizetype,
+                               sizeof(std::size_t),
+                               TagRoundLabels,
+                               comm);
+  MPI_Waitall(requests.size(), requests.data(), MPI_STATUSES_IGNORE);
+
+  // keep the per-rank order within each round; then sender and receiver agree on it
+  roundSendIndices.assign(rounds, {});
+  roundSendOffsets.assign(rounds, std::vector<std::size_t>(commsize + 1, 0));
+  roundRecvOffsets.assign(rounds, std::vector<std::size_t>(commsize + 1, 0));
+  roundTargets.assign(rounds, {});
+  std::vector<std::size_t> recvIndexInRound(recvLabels.size());
+  std::vector<std::size_t> recvCountInRound(rounds, 0);
+  for (int rank = 0; rank < commsize; ++rank) {
+    for (std::size_t i = sendOffsets[rank]; i < sendOffsets[rank + 1]; ++i) {
+      const auto round = sendLabels[i];
+      roundSendIndices[round].push_back(sendReorder[i] - round * roundSize);
+      ++roundSendOffsets[round][rank + 1];
+    }
+    for (std::size_t i = recvOffsets[rank]; i < recvOffsets[rank + 1]; ++i) {
+      const auto round = recvLabels[i];
+      recvIndexInRound[i] = recvCountInRound[round];
+      ++recvCountInRound[round];
+      ++roundRecvOffsets[round][rank + 1];
+    }
+  }
+  for (std::size_t round = 0; round < rounds; ++round) {
+    for (int rank = 0; rank < commsize; ++rank) {
+      roundSendOffsets[round][rank + 1] += roundSendOffsets[round][rank];
+    }
+    for (int rank = 0; rank < commsize; ++rank) {
+      roundRecvOffsets[round][rank + 1] += roundRecvOffsets[round][rank];
+    }
+  }
+  for (std::size_t i = 0; i < recvReorder.size(); ++i) {
+    const auto received = recvReorder[i];
+    roundTargets[recvLabels[received]].emplace_back(i, recvIndexInRound[received]);
+  }
+
+  return rounds;
+}
+
+Distributor::DistributionInstance Distributor::distributeRoundInternal(std::size_t round,
+                                                                       void* target,
+                                                                       const void* source,
+                                                                       MPI_Datatype datatype) {
+  constexpr int Tag = 32;
+
+  int typesizeInt = 0;
+  MPI_Type_size(datatype, &typesizeInt);
+  const std::size_t typesize = typesizeInt;
+
+  const char* sourceChar = reinterpret_cast<const char*>(source);
+  char* targetChar = reinterpret_cast<char*>(target);
+
+  const auto& sendIndices = roundSendIndices[round];
+  const auto& targets = roundTargets[round];
+
+  char* sourceReordered = reinterpret_cast<char*>(std::malloc(typesize * sendIndices.size()));
+  char* targetReordered =
+      reinterpret_cast<char*>(std::malloc(typesize * roundRecvOffsets[round].back()));
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t i = 0; i < sendIndices.size(); ++i) {
+    std::memcpy(sourceReordered + i * typesize, sourceChar + sendIndices[i] * typesize, typesize);
+  }
+
+  const auto requests = postExchange(sourceReordered,
+                                     targetReordered,
+                                     roundSendOffsets[round],
+                                     roundRecvOffsets[round],
+                                     datatype,
+                                     typesize,
+                                     Tag,
+                                     comm);
+  const auto completion =
+      [requests, &targets, targetChar, sourceReordered, targetReordered, typesize]() {
+        auto requests2 = requests;
+        MPI_Waitall(requests2.size(), requests2.data(), MPI_STATUSES_IGNORE);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (std::size_t i = 0; i < targets.size(); ++i) {
+          std::memcpy(targetChar + targets[i].first * typesize,
+                      targetReordered + targets[i].second * typesize,
+                      typesize);
+        }
+
+        std::free(sourceReordered);
+        std::free(targetReordered);
+      };
+  return DistributionInstance(completion);
+}
+
 void Distributor::DistributionInstance::complete() {
   if (!completed) {
     std::invoke(completion);
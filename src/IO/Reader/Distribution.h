@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <functional>
 #include <mpi.h>
+#include <utility>
 #include <vector>
 
 namespace seissol::io::reader {
@@ -38,14 +39,42 @@ private:
     return distributeInternal(target, source, datatype);
   }
 
+  // splits the source data into rounds of (at most) roundSize elements each, s.t. it can be
+  // distributed round by round, without holding all of it in memory at once.
+  // Returns the number of rounds (the same on all ranks).
+  std::size_t setupRounds(std::size_t roundSize);
+
+  // distributes the source elements [round * roundSize, (round + 1) * roundSize);
+  // source points to the first of them. Needs to be called for all rounds, in order.
+  template <typename T>
+  DistributionInstance distributeRound(std::size_t round,
+                                       T* target,
+                                       const T* source,
+                                       MPI_Datatype datatype = seissol::io::datatype::convertToMPI(
+                                           seissol::io::datatype::inferDatatype<T>())) {
+    return distributeRoundInternal(round, target, source, datatype);
+  }
+
   private:
   // distributes data. Note that in-place operations are supported.
   DistributionInstance distributeInternal(void* target, const void* source, MPI_Datatype datatype);
 
+  DistributionInstance distributeRoundInternal(std::size_t round,
+                                               void* target,
+                                               const void* source,
+                                               MPI_Datatype datatype);
+
   std::vector<std::size_t> sendOffsets;
   std::vector<std::size_t> recvOffsets;
   std::vector<std::size_t> sendReorder;
   std::vector<std::size_t> recvReorder;
+
+  // per round: the source positions to send (grouped by rank), and the offsets per rank
+  std::vector<std::vector<std::size_t>> roundSendIndices;
+  std::vector<std::vector<std::size_t>> roundSendOffsets;
+  // per round: the (target position, received element) pairs, and the receive offsets per rank
+  std::vector<std::vector<std::pair<std::size_t, std::size_t>>> roundTargets;
+  std::vector<std::vector<std::size_t>> roundRecvOffsets;
   MPI_Comm comm;
 };
 } // namespace seissol::io::reader
@@ -68,6 +68,9 @@ void Hdf5Reader::openGroup(const std::string& name) {
   const hid_t handle = _eh(H5Gopen(handles.top(), name.c_str(), H5P_DEFAULT));
   handles.push(handle);
 }
+bool Hdf5Reader::hasAttribute(const std::string& name) {
+  return _eh(H5Aexists(handles.top(), name.c_str())) > 0;
+}
 std::size_t Hdf5Reader::attributeCount(const std::string& name) {
   checkExistence(name, "attribute");
   const hid_t attr = _eh(H5Aopen(handles.top(), name.c_str(), H5P_DEFAULT));
@@ -87,6 +90,9 @@ void Hdf5Reader::readAttributeRaw(void* data,
   _eh(H5Aread(attr, datatype::convertToHdf5(type), data));
   _eh(H5Aclose(attr));
 }
+bool Hdf5Reader::hasDataset(const std::string& name) {
+  return _eh(H5Lexists(handles.top(), name.c_str(), H5P_DEFAULT)) > 0;
+}
 std::size_t Hdf5Reader::dataCount(const std::string& name) {
   checkExistence(name, "dataset");
   const hid_t dataset = _eh(H5Dopen(handles.top(), name.c_str(), H5P_DEFAULT));
@@ -108,6 +114,35 @@ void Hdf5Reader::readDataRaw(void* data,
                              const std::string& name,
                              std::size_t count,
                              const std::shared_ptr<datatype::Datatype>& targetType) {
+  std::size_t start = 0;
+  MPI_Exscan(&count,
+             &start,
+             1,
+             datatype::convertToMPI(datatype::inferDatatype<std::size_t>()),
+             MPI_SUM,
+             comm);
+  readDataRawAt(data, name, start, count, targetType);
+}
+void Hdf5Reader::readDataRawRange(void* data,
+                                  const std::string& name,
+                                  std::size_t offset,
+                                  std::size_t count,
+                                  const std::shared_ptr<datatype::Datatype>& targetType) {
+  const std::size_t localCount = dataCount(name);
+  std::size_t start = 0;
+  MPI_Exscan(&localCount,
+             &start,
+             1,
+             datatype::convertToMPI(datatype::inferDatatype<std::size_t>()),
+             MPI_SUM,
+             comm);
+  readDataRawAt(data, name, start + offset, count, targetType);
+}
+void Hdf5Reader::readDataRawAt(void* data,
+                               const std::string& name,
+                               std::size_t start,
+                               std::size_t count,
+                               const std::shared_ptr<datatype::Datatype>& targetType) {
   checkExistence(name, "dataset");
   const hid_t h5alist = H5Pcreate(H5P_DATASET_XFER);
   _eh(h5alist);
@@ -124,36 +159,28 @@ void Hdf5Reader::readDataRaw(void* data,
   std::vector<hsize_t> dims(rank);
   _eh(H5Sget_simple_extent_dims(dataspace, dims.data(), nullptr));
 
-  std::size_t dimprod = 1;
-  for (auto dim : dims) {
-    dimprod *= dim;
+  // the size of one row; the rows are distributed (cf. Hdf5File::writeData)
+  std::size_t subsize = 1;
+  for (std::size_t i = 1; i < dims.size(); ++i) {
+    subsize *= dims[i];
   }
 
   const std::size_t chunksize =
-      std::max(std::size_t(1), std::size_t(2'000'000'000) / (targetType->size() * dimprod));
+      std::max(std::size_t(1), std::size_t(2'000'000'000) / (targetType->size() * subsize));
   std::size_t rounds = (count + chunksize - 1) / chunksize;
-  std::size_t start = 0;
   MPI_Allreduce(MPI_IN_PLACE,
                 &rounds,
                 1,
                 datatype::convertToMPI(datatype::inferDatatype<std::size_t>()),
                 MPI_MAX,
                 comm);
-  MPI_Exscan(&count,
-             &start,
-             1,
-             datatype::convertToMPI(datatype::inferDatatype<std::size_t>()),
-             MPI_SUM,
-             comm);
 
   std::vector<hsize_t> nullstart(rank);
   std::vector<hsize_t> readcount(rank);
   std::vector<hsize_t> filepos(rank);
 
-  std::size_t subsize = 1;
   for (std::size_t i = 1; i < readcount.size(); ++i) {
     readcount[i] = dims[i];
-    subsize *= dims[i];
   }
   readcount[0] = std::min(chunksize, count);
 
@@ -35,6 +35,7 @@ class Hdf5Reader {
     readAttributeRaw(&attr, name, type);
     return attr;
   }
+  bool hasAttribute(const std::string& name);
   std::size_t attributeCount(const std::string& name);
   void readAttributeRaw(void* data,
                         const std::string& name,
@@ -48,17 +49,31 @@ class Hdf5Reader {
     readDataRaw(output.data(), name, count, targetType);
     return output;
   }
+  bool hasDataset(const std::string& name);
   std::size_t dataCount(const std::string& name);
   void readDataRaw(void* data,
                    const std::string& name,
                    std::size_t count,
                    const std::shared_ptr<datatype::Datatype>& targetType);
+  // reads count elements, starting at the given offset into the part of the dataset
+  // which readDataRaw would read on this rank (collective)
+  void readDataRawRange(void* data,
+                        const std::string& name,
+                        std::size_t offset,
+                        std::size_t count,
+                        const std::shared_ptr<datatype::Datatype>& targetType);
   void closeGroup();
   void closeFile();
 
   void checkExistence(const std::string& name, const std::string& type);
 
   private:
+  void readDataRawAt(void* data,
+                     const std::string& name,
+                     std::size_t start,
+                     std::size_t count,
+                     const std::shared_ptr<datatype::Datatype>& targetType);
+
   std::stack<hid_t> handles;
   MPI_Comm comm;
 };
@@ -8,13 +8,16 @@
 #include <IO/Datatype/HDF5Type.h>
 #include <IO/Datatype/Inference.h>
 #include <IO/Datatype/MPIType.h>
+#include <IO/Writer/File/ScaledInt16.h>
 #include <IO/Writer/Instructions/Data.h>
 #include <IO/Writer/Instructions/Hdf5.h>
 #include <algorithm>
 #include <async/ExecInfo.h>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <hdf5.h>
+#include <limits>
 #include <memory>
 #include <mpi.h>
 #include <stack>
@@ -103,7 +106,12 @@ void Hdf5File::writeData(const async::ExecInfo& info,
                          const std::string& name,
                          const std::shared_ptr<DataSource>& source,
                          const std::shared_ptr<datatype::Datatype>& targetType,
-                         int compress) {
+                         int compress,
+                         instructions::Hdf5Encoding encoding) {
+  const bool scaled = encoding == instructions::Hdf5Encoding::ScaledInt16;
+  const auto fileType =
+      scaled ? std::make_shared<datatype::IntegerDatatype>(2, true) : targetType;
+
   MPI_Datatype sizetype = datatype::convertToMPI(datatype::inferDatatype<std::size_t>());
 
   std::size_t trueCount = source->count(info);
@@ -170,9 +178,9 @@ void Hdf5File::writeData(const async::ExecInfo& info,
   _eh(H5Pset_dxpl_mpio(h5dxlist, H5FD_MPIO_COLLECTIVE));
 #endif
 
-  const hid_t h5memtype = datatype::convertToHdf5(source->datatype());
+  hid_t h5memtype = datatype::convertToHdf5(source->datatype());
 
-  const hid_t preh5type = datatype::convertToHdf5(targetType);
+  const hid_t preh5type = datatype::convertToHdf5(fileType);
   const hid_t h5type = _eh(H5Tcopy(preh5type));
   if (_eh(H5Tget_class(h5type)) == H5T_COMPOUND) {
     _eh(H5Tpack(h5type));
@@ -184,10 +192,25 @@ void Hdf5File::writeData(const async::ExecInfo& info,
                 H5P_DEFAULT,
                 H5P_DEFAULT));
 
+  // the chunk layout needs to be the same on all ranks; hence, we derive it from the global size
+  std::vector<hsize_t> chunkSizes(globalSizes.begin(), globalSizes.end());
+  if (source->distributed() && !chunkSizes.empty()) {
+    constexpr std::size_t TargetChunkBytes = 4 * 1024 * 1024;
+    const std::size_t rowBytes = std::max(std::size_t(1), fileType->size() * dimprod);
+    chunkSizes[0] =
+        std::min<hsize_t>(allcount, std::max(std::size_t(1), TargetChunkBytes / rowBytes));
+  }
+  const bool chunkable =
+      !chunkSizes.empty() &&
+      std::all_of(chunkSizes.begin(), chunkSizes.end(), [](auto size) { return size > 0; });
+
   hid_t h5filter = H5P_DEFAULT;
-  if (compress > 0) {
+  const bool filtered = compress > 0 && chunkable;
+  if (filtered) {
     h5filter = _eh(H5Pcreate(H5P_DATASET_CREATE));
-    _eh(H5Pset_chunk(h5filter, actualDimensions, writeLength.data()));
+    _eh(H5Pset_chunk(h5filter, actualDimensions, chunkSizes.data()));
+    // byte-shuffling groups the exponent bytes of floating point data, which helps deflate a lot
+    _eh(H5Pset_shuffle(h5filter));
     const int deflateStrength = compress;
     _eh(H5Pset_deflate(h5filter, deflateStrength));
   }
@@ -201,8 +224,63 @@ void Hdf5File::writeData(const async::ExecInfo& info,
 
   const char* data = reinterpret_cast<const char*>(source->getPointer(info));
 
+  // the scaled integers are computed here, i.e. on the writer side, for blocks of rows matching
+  // the chunks; s.t. each chunk of the dataset can be decoded on its own
+  std::vector<std::int16_t> quantized;
+  std::size_t blockRows = 1;
+  std::vector<double> scales;
+  std::vector<double> offsets;
+  if (scaled) {
+    blockRows = (source->distributed() && chunkable) ? chunkSizes[0] : allcount;
+    blockRows = std::max(std::size_t(1), blockRows);
+    const std::size_t blocks = (allcount + blockRows - 1) / blockRows;
+
+    std::vector<double> lower(blocks, std::numeric_limits<double>::infinity());
+    std::vector<double> upper(blocks, -std::numeric_limits<double>::infinity());
+    const auto sourceType = source->datatype();
+    const bool isF32 = dynamic_cast<const datatype::F32Datatype*>(sourceType.get()) != nullptr;
+    const bool isF64 = dynamic_cast<const datatype::F64Datatype*>(sourceType.get()) != nullptr;
+    if (isF32) {
+      blockRange(
+          reinterpret_cast<const float*>(data), count, dimprod, offset, blockRows, lower, upper);
+    } else if (isF64) {
+      blockRange(
+          reinterpret_cast<const double*>(data), count, dimprod, offset, blockRows, lower, upper);
+    } else {
+      logError() << "The scaled 16-bit encoding needs floating point data; dataset" << name
+                 << "has a different type.";
+    }
+    MPI_Allreduce(MPI_IN_PLACE, lower.data(), blocks, MPI_DOUBLE, MPI_MIN, comm);
+    MPI_Allreduce(MPI_IN_PLACE, upper.data(), blocks, MPI_DOUBLE, MPI_MAX, comm);
+
+    blockScaling(lower, upper, offsets, scales);
+
+    quantized.resize(count * dimprod);
+    if (isF32) {
+      quantize(reinterpret_cast<const float*>(data),
+               count,
+               dimprod,
+               offset,
+               blockRows,
+               offsets,
+               scales,
+               quantized.data());
+    } else {
+      quantize(reinterpret_cast<const double*>(data),
+               count,
+               dimprod,
+               offset,
+               blockRows,
+               offsets,
+               scales,
+               quantized.data());
+    }
+    data = reinterpret_cast<const char*>(quantized.data());
+    h5memtype = H5T_NATIVE_INT16;
+  }
+
   // TODO(David): maybe always compute in the loop instead?
-  std::size_t baseWriteSize = targetType->size();
+  std::size_t baseWriteSize = fileType->size();
   for (const auto& dim : dimensions) {
     baseWriteSize *= dim;
   }
@@ -233,7 +311,18 @@ void Hdf5File::writeData(const async::ExecInfo& info,
     dataloc += writeSize;
   }
 
-  if (compress > 0) {
+  if (scaled && !scales.empty()) {
+    // value = offset[row / blockSize] + scale[row / blockSize] * stored
+    handles.push(h5data);
+    writeAttribute(info, "ScaledInt16BlockSize", WriteInline::create(blockRows));
+    writeAttribute(
+        info, "ScaledInt16Scale", WriteInline::createArray<double>({scales.size()}, scales));
+    writeAttribute(
+        info, "ScaledInt16Offset", WriteInline::createArray<double>({offsets.size()}, offsets));
+    handles.pop();
+  }
+
+  if (filtered) {
     _eh(H5Pclose(h5filter));
   }
   _eh(H5Tclose(h5type));
@@ -293,7 +382,8 @@ void Hdf5Writer::writeData(const async::ExecInfo& info, const instructions::Hdf5
   if (write.location.dataset().has_value()) {
     file.openDataset(write.location.dataset().value());
   }
-  file.writeData(info, write.name, write.dataSource, write.targetType, write.compress);
+  file.writeData(
+      info, write.name, write.dataSource, write.targetType, write.compress, write.encoding);
   if (write.location.dataset().has_value()) {
     file.closeDataset();
   }
@@ -29,7 +29,8 @@ class Hdf5File {
                  const std::string& name,
                  const std::shared_ptr<DataSource>& source,
                  const std::shared_ptr<datatype::Datatype>& targetType,
-                 int compress);
+                 int compress,
+                 instructions::Hdf5Encoding encoding = instructions::Hdf5Encoding::Convert);
   void closeDataset();
   void closeGroup();
   void closeFile();
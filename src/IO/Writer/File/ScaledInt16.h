@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_IO_WRITER_FILE_SCALEDINT16_H_
+#define SEISSOL_SRC_IO_WRITER_FILE_SCALEDINT16_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace seissol::io::writer::file {
+
+// The scaled 16-bit encoding stores each value as offset + scale * q with q a 16-bit integer; the
+// offset and scale are given per block of rows. Values are rounded to the nearest integer, i.e. the
+// encoding error of a finite value is at most scale / 2.
+
+// the value range of each block of rows; the rows are numbered globally, starting at firstRow
+template <typename T>
+void blockRange(const T* values,
+                std::size_t rows,
+                std::size_t rowSize,
+                std::size_t firstRow,
+                std::size_t blockRows,
+                std::vector<double>& lower,
+                std::vector<double>& upper) {
+  for (std::size_t i = 0; i < rows; ++i) {
+    const std::size_t block = (firstRow + i) / blockRows;
+    for (std::size_t j = 0; j < rowSize; ++j) {
+      const double value = values[i * rowSize + j];
+      if (std::isfinite(value)) {
+        lower[block] = std::min(lower[block], value);
+        upper[block] = std::max(upper[block], value);
+      }
+    }
+  }
+}
+
+// maps the value range of each block symmetrically onto [-32767, 32767]
+inline void blockScaling(const std::vector<double>& lower,
+                         const std::vector<double>& upper,
+                         std::vector<double>& offsets,
+                         std::vector<double>& scales) {
+  offsets.resize(lower.size());
+  scales.resize(lower.size());
+  for (std::size_t i = 0; i < lower.size(); ++i) {
+    const bool empty = !(lower[i] <= upper[i]);
+    offsets[i] = empty ? 0.0 : (lower[i] + upper[i]) / 2;
+    const double scale = empty ? 0.0 : (upper[i] - lower[i]) / 65534;
+    scales[i] = (scale > 0 && std::isfinite(scale)) ? scale : 1.0;
+  }
+}
+
+template <typename T>
+void quantize(const T* values,
+              std::size_t rows,
+              std::size_t rowSize,
+              std::size_t firstRow,
+              std::size_t blockRows,
+              const std::vector<double>& offsets,
+              const std::vector<double>& scales,
+              std::int16_t* target) {
+  constexpr double Limit = std::numeric_limits<std::int16_t>::max();
+  for (std::size_t i = 0; i < rows; ++i) {
+    const std::size_t block = (firstRow + i) / blockRows;
+    for (std::size_t j = 0; j < rowSize; ++j) {
+      const double scaled = (values[i * rowSize + j] - offsets[block]) / scales[block];
+      // NaN maps to the offset; infinite values are clamped
+      const double clamped = std::isnan(scaled) ? 0.0 : std::clamp(scaled, -Limit, Limit);
+      target[i * rowSize + j] = static_cast<std::int16_t>(std::lround(clamped));
+    }
+  }
+}
+
+} // namespace seissol::io::writer::file
+
+#endif // SEISSOL_SRC_IO_WRITER_FILE_SCALEDINT16_H_
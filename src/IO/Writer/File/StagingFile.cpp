@@ -0,0 +1,127 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "StagingFile.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <string>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+#include "utils/logger.h"
+
+namespace {
+constexpr char Magic[] = "SSSTAGE1";
+constexpr std::size_t MagicLength = sizeof(Magic) - 1;
+
+void writeInteger(std::ofstream& stream, std::uint64_t value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::uint64_t readInteger(const char* data, std::size_t size, std::size_t& position) {
+  if (position + sizeof(std::uint64_t) > size) {
+    logError() << "Unexpected end of the staging file.";
+  }
+  std::uint64_t value = 0;
+  std::memcpy(&value, data + position, sizeof(value));
+  position += sizeof(value);
+  return value;
+}
+} // namespace
+
+namespace seissol::io::writer::file {
+
+std::string StagingFile::fileName(const std::string& stagingPath, int rank) {
+  return stagingPath + "-" + std::to_string(rank) + ".stage";
+}
+
+void StagingFile::write(const std::string& path,
+                        const std::string& plan,
+                        int commsize,
+                        const std::vector<Buffer>& buffers) {
+  const auto temporaryPath = path + ".tmp";
+  {
+    std::ofstream stream(temporaryPath, std::ios::binary | std::ios::trunc);
+    stream.write(Magic, MagicLength);
+    writeInteger(stream, commsize);
+    writeInteger(stream, plan.size());
+    stream.write(plan.data(), static_cast<std::streamsize>(plan.size()));
+    writeInteger(stream, buffers.size());
+    for (const auto& buffer : buffers) {
+      writeInteger(stream, buffer.id);
+      writeInteger(stream, buffer.size);
+      stream.write(reinterpret_cast<const char*>(buffer.data),
+                   static_cast<std::streamsize>(buffer.size));
+    }
+    if (!stream) {
+      logError() << "Could not write the staging file" << temporaryPath;
+    }
+  }
+  if (std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+    logError() << "Could not rename the staging file" << temporaryPath << "to" << path;
+  }
+}
+
+StagingFile::StagingFile(const std::string& path) {
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    logError() << "Could not open the staging file" << path;
+  }
+  struct stat status {};
+  fstat(fd, &status);
+  mappedSize = status.st_size;
+  mapped = mmap(nullptr, mappedSize, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    logError() << "Could not map the staging file" << path;
+  }
+
+  const char* data = reinterpret_cast<const char*>(mapped);
+  if (mappedSize < MagicLength || std::memcmp(data, Magic, MagicLength) != 0) {
+    logError() << path << "is not a staging file.";
+  }
+  std::size_t position = MagicLength;
+  commsizeP = static_cast<int>(readInteger(data, mappedSize, position));
+  const auto planSize = readInteger(data, mappedSize, position);
+  if (position + planSize > mappedSize) {
+    logError() << "Unexpected end of the staging file" << path;
+  }
+  planP = std::string(data + position, data + position + planSize);
+  position += planSize;
+  const auto bufferCount = readInteger(data, mappedSize, position);
+  for (std::uint64_t i = 0; i < bufferCount; ++i) {
+    const auto id = static_cast<int>(readInteger(data, mappedSize, position));
+    const auto size = readInteger(data, mappedSize, position);
+    if (position + size > mappedSize) {
+      logError() << "Unexpected end of the staging file" << path;
+    }
+    buffers[id] = Buffer{id, data + position, size};
+    position += size;
+  }
+}
+
+StagingFile::~StagingFile() {
+  if (mapped != nullptr && mapped != MAP_FAILED) {
+    munmap(mapped, mappedSize);
+  }
+}
+
+const std::string& StagingFile::plan() const { return planP; }
+
+int StagingFile::commsize() const { return commsizeP; }
+
+bool StagingFile::hasBuffer(int id) const { return buffers.find(id) != buffers.end(); }
+
+const void* StagingFile::buffer(int id) const { return buffers.at(id).data; }
+
+std::size_t StagingFile::bufferSize(int id) const { return buffers.at(id).size; }
+
+} // namespace seissol::io::writer::file
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_IO_WRITER_FILE_STAGINGFILE_H_
+#define SEISSOL_SRC_IO_WRITER_FILE_STAGINGFILE_H_
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace seissol::io::writer::file {
+
+/**
+ * A rank-local copy of a planned write, i.e. the serialized plan and the data of all buffers it
+ * references. It is meant to be placed on node-local storage (or shared memory, e.g. /dev/shm),
+ * such that a write can be finished from it later on, or re-read directly on a restart.
+ *
+ * Layout (all integers are 64 bit unsigned, native byte order):
+ * - the magic string "SSSTAGE1"
+ * - the number of ranks which wrote the staged data
+ * - the length of the plan, followed by the plan itself
+ * - the number of buffers, followed by the buffer id, the size in bytes and the data of each
+ */
+class StagingFile {
+  public:
+  struct Buffer {
+    int id;
+    const void* data;
+    std::size_t size;
+  };
+
+  static std::string fileName(const std::string& stagingPath, int rank);
+
+  // writes a staging file; the file is written under a temporary name first, and then renamed.
+  // Thus, an existing staging file stays intact until the new one is complete.
+  static void write(const std::string& path,
+                    const std::string& plan,
+                    int commsize,
+                    const std::vector<Buffer>& buffers);
+
+  // maps an existing staging file read-only
+  explicit StagingFile(const std::string& path);
+  ~StagingFile();
+
+  StagingFile(const StagingFile&) = delete;
+  StagingFile& operator=(const StagingFile&) = delete;
+
+  [[nodiscard]] const std::string& plan() const;
+  [[nodiscard]] int commsize() const;
+  [[nodiscard]] bool hasBuffer(int id) const;
+  [[nodiscard]] const void* buffer(int id) const;
+  [[nodiscard]] std::size_t bufferSize(int id) const;
+
+  private:
+  void* mapped{nullptr};
+  std::size_t mappedSize{0};
+  std::string planP;
+  int commsizeP{0};
+  std::unordered_map<int, Buffer> buffers;
+};
+
+} // namespace seissol::io::writer::file
+
+#endif // SEISSOL_SRC_IO_WRITER_FILE_STAGINGFILE_H_
@@ -83,10 +83,20 @@ YAML::Node WriteBufferRemote::serialize() {
   return node;
 }
 
-const void* WriteBufferRemote::getPointer(const async::ExecInfo& info) { return info.buffer(id); }
+const void* WriteBufferRemote::getPointer(const async::ExecInfo& info) {
+  return redirected ? staged : info.buffer(id);
+}
 
 std::size_t WriteBufferRemote::count(const async::ExecInfo& info) {
-  return info.bufferSize(id) / datatype()->size();
+  return (redirected ? stagedSize : info.bufferSize(id)) / datatype()->size();
+}
+
+int WriteBufferRemote::bufferId() const { return id; }
+
+void WriteBufferRemote::redirect(const void* stagedData, std::size_t stagedDataSize) {
+  staged = stagedData;
+  stagedSize = stagedDataSize;
+  redirected = true;
 }
 
 void WriteBufferRemote::assignId(int /*id*/) {}
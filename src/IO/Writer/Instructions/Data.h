@@ -105,8 +105,16 @@ class WriteBufferRemote : public DataSource {
   [[nodiscard]] const void* getLocalPointer() const override;
   [[nodiscard]] size_t getLocalSize() const override;
 
+  [[nodiscard]] int bufferId() const;
+
+  // reads the data from a staged copy instead of the ASYNC buffer from now on
+  void redirect(const void* stagedData, std::size_t stagedDataSize);
+
   private:
   int id;
+  const void* staged{nullptr};
+  std::size_t stagedSize{0};
+  bool redirected{false};
 };
 
 class WriteBuffer : public DataSource {
@@ -92,9 +92,10 @@ Hdf5DataWrite::Hdf5DataWrite(const Hdf5Location& location,
                              const std::string& name,
                              std::shared_ptr<writer::DataSource> dataSource,
                              std::shared_ptr<datatype::Datatype> targetType,
-                             int compress)
+                             int compress,
+                             Hdf5Encoding encoding)
     : location(location), name(name), dataSource(std::move(dataSource)),
-      targetType(std::move(targetType)), compress(compress) {}
+      targetType(std::move(targetType)), compress(compress), encoding(encoding) {}
 
 YAML::Node Hdf5DataWrite::serialize() {
   YAML::Node node;
@@ -105,6 +106,7 @@ YAML::Node Hdf5DataWrite::serialize() {
   node["writer"] = "hdf5";
   node["type"] = "data";
   node["compress"] = compress;
+  node["encoding"] = static_cast<int>(encoding);
   return node;
 }
 
@@ -113,7 +115,8 @@ Hdf5DataWrite::Hdf5DataWrite(YAML::Node node)
       dataSource(writer::DataSource::deserialize(node["source"])),
       location(Hdf5Location(node["location"])),
       targetType(datatype::Datatype::deserialize(node["targetType"])),
-      compress(node["compress"].as<int>()) {}
+      compress(node["compress"].as<int>()),
+      encoding(static_cast<Hdf5Encoding>(node["encoding"].as<int>())) {}
 
 std::vector<std::shared_ptr<DataSource>> Hdf5DataWrite::dataSources() { return {dataSource}; }
 } // namespace seissol::io::writer::instructions
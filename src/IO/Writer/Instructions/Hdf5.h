@@ -56,6 +56,13 @@ struct Hdf5AttributeWrite : public WriteInstruction {
   std::vector<std::shared_ptr<DataSource>> dataSources() override;
 };
 
+enum class Hdf5Encoding : int {
+  // let HDF5 convert the data to the target type
+  Convert = 0,
+  // store 16-bit integers, with a scale and an offset per block of rows (given as attributes)
+  ScaledInt16 = 1
+};
+
 struct Hdf5DataWrite : public WriteInstruction {
   ~Hdf5DataWrite() override = default;
   Hdf5Location location;
@@ -63,12 +70,14 @@ struct Hdf5DataWrite : public WriteInstruction {
   std::shared_ptr<writer::DataSource> dataSource;
   std::shared_ptr<datatype::Datatype> targetType;
   int compress;
+  Hdf5Encoding encoding;
 
   Hdf5DataWrite(const Hdf5Location& location,
                 const std::string& name,
                 std::shared_ptr<writer::DataSource> dataSource,
                 std::shared_ptr<datatype::Datatype> targetType,
-                int compress = 0);
+                int compress = 0,
+                Hdf5Encoding encoding = Hdf5Encoding::Convert);
 
   YAML::Node serialize() override;
 
@@ -5,11 +5,19 @@
 #include "AsyncWriter.h"
 
 #include "async/ExecInfo.h"
+#include <IO/Writer/File/StagingFile.h>
+#include <IO/Writer/Instructions/Data.h>
 #include <IO/Writer/Writer.h>
+#include <Parallel/MPI.h>
 #include <cstddef>
+#include <hdf5.h>
+#include <memory>
 #include <mpi.h>
 #include <mutex>
 #include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
 #include <utils/logger.h>
 
 namespace seissol::io::writer::module {
@@ -23,25 +31,111 @@ void AsyncWriter::exec(const async::ExecInfo& info, const AsyncWriterExec& param
   const size_t size = info.bufferSize(PlanId);
   const char* strData = reinterpret_cast<const char*>(data);
 
-  int rank = 0;
-  MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+  const auto rank = seissol::MPI::mpi.rank();
   if (printPlan && rank == 0) {
     logInfo(rank) << "Printing current plan:" << std::string(strData, strData + size);
   }
 
+  // the previous drain still uses the writer and the staged copy
+  finishDrain();
+
   {
     // for the Hdf5 implementations, we'll need to serialize writes
     // (TODO: make one AsyncWriter only in total)
     const std::lock_guard lock(globalLock);
-    writer = Writer(std::string(strData, strData + size));
+    const auto plan = std::string(strData, strData + size);
+    writer = Writer(plan);
+    if (!writer.stagingPath().empty()) {
+      stage(info, plan);
+      startDrain(info);
+      return;
+    }
     instance = std::optional(writer.beginWrite(info));
     // for now write synchronously
     instance.value().close();
     instance.reset();
   }
 }
+
+void AsyncWriter::stage(const async::ExecInfo& info, const std::string& plan) {
+  const auto rank = seissol::MPI::mpi.rank();
+  const auto commsize = seissol::MPI::mpi.size();
+
+  std::vector<WriteBufferRemote*> remoteSources;
+  std::vector<file::StagingFile::Buffer> buffers;
+  std::unordered_set<int> bufferIds;
+  for (const auto& instruction : writer.getInstructions()) {
+    for (const auto& dataSource : instruction->dataSources()) {
+      auto* remote = dynamic_cast<WriteBufferRemote*>(dataSource.get());
+      if (remote != nullptr) {
+        remoteSources.push_back(remote);
+        const int id = remote->bufferId();
+        if (bufferIds.find(id) == bufferIds.end()) {
+          bufferIds.emplace(id);
+          buffers.push_back(file::StagingFile::Buffer{id, info.buffer(id), info.bufferSize(id)});
+        }
+      }
+    }
+  }
+
+  // release the previous snapshot before replacing it
+  staged.reset();
+  const auto path = file::StagingFile::fileName(writer.stagingPath(), rank);
+  file::StagingFile::write(path, plan, commsize, buffers);
+  staged = std::make_unique<file::StagingFile>(path);
+
+  // the drain then reads from the staged copy only, i.e. not from the ASYNC buffers anymore
+  for (auto* remote : remoteSources) {
+    remote->redirect(staged->buffer(remote->bufferId()), staged->bufferSize(remote->bufferId()));
+  }
+}
+
+void AsyncWriter::startDrain(const async::ExecInfo& info) {
+  // the ExecInfo lives as long as the ASYNC module; and the (redirected) plan does not read from it
+  drainInfo = &info;
+
+  // HDF5 may only be called concurrently to other threads (e.g. other writers, or the solver
+  // reading a file) with a threadsafe build; otherwise, the drain is deferred to the next write
+  hbool_t threadsafe = 0;
+  H5is_library_threadsafe(&threadsafe);
+  if (threadsafe == 0) {
+    drainPending = true;
+    return;
+  }
+
+  // the drain runs concurrently to the solver (and to the executor); thus, give it a communicator
+  // of its own
+  if (drainComm == MPI_COMM_NULL) {
+    MPI_Comm_dup(seissol::MPI::mpi.comm(), &drainComm);
+  }
+  drain = std::thread([this]() { writeStaged(drainComm); });
+}
+
+void AsyncWriter::writeStaged(MPI_Comm comm) {
+  const std::lock_guard lock(globalLock);
+  auto drainInstance = writer.beginWrite(*drainInfo, comm);
+  drainInstance.close();
+}
+
+void AsyncWriter::finishDrain() {
+  if (drain.joinable()) {
+    drain.join();
+  }
+  if (drainPending) {
+    drainPending = false;
+    writeStaged(seissol::MPI::mpi.comm());
+  }
+}
+
 void AsyncWriter::execWait(const async::ExecInfo& info) {
   // TODO: async finalize
 }
-void AsyncWriter::finalize() {}
+
+void AsyncWriter::finalize() {
+  finishDrain();
+  staged.reset();
+  if (drainComm != MPI_COMM_NULL) {
+    MPI_Comm_free(&drainComm);
+  }
+}
 } // namespace seissol::io::writer::module
@@ -7,8 +7,14 @@
 
 #include "async/ExecInfo.h"
 #include "async/Module.h"
+#include <IO/Writer/File/StagingFile.h>
 #include <IO/Writer/Writer.h>
+#include <memory>
+#include <mpi.h>
 #include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
 
 namespace seissol::io::writer::module {
 struct AsyncWriterInit {};
@@ -24,11 +30,27 @@ class AsyncWriter {
   void finalize();
 
   private:
+  // copies all buffers of the current plan to a rank-local staging file, and redirects the plan
+  // to that copy
+  void stage(const async::ExecInfo& info, const std::string& plan);
+
+  // writes the staged plan on a background thread with a threadsafe HDF5 build; otherwise, the
+  // write is deferred until the next exec (or finalize)
+  void startDrain(const async::ExecInfo& info);
+  void finishDrain();
+  void writeStaged(MPI_Comm comm);
+
   static constexpr int PlanId = 0;
   bool printPlan{false};
   seissol::io::writer::Writer writer;
   std::optional<seissol::io::writer::WriteInstance> instance;
 
+  std::unique_ptr<file::StagingFile> staged;
+  const async::ExecInfo* drainInfo{nullptr};
+  std::thread drain;
+  bool drainPending{false};
+  MPI_Comm drainComm{MPI_COMM_NULL};
+
   static std::mutex globalLock;
 };
 
@@ -43,9 +43,12 @@ Writer::Writer() = default;
 
 Writer::Writer(const std::string& data) {
   const YAML::Node plan = YAML::Load(data);
-  for (const YAML::Node& instruction : plan) {
+  for (const YAML::Node& instruction : plan["instructions"]) {
     instructions.push_back(instructions::WriteInstruction::deserialize(instruction));
   }
+  if (plan["staging"]) {
+    stagingPathP = plan["staging"].as<std::string>();
+  }
 }
 
 void Writer::addInstruction(const std::shared_ptr<instructions::WriteInstruction>& instruction) {
@@ -56,17 +59,22 @@ std::string Writer::serialize() {
   std::stringstream sstr;
   {
     YAML::Emitter output(sstr);
-    output << YAML::BeginSeq;
+    output << YAML::BeginMap;
+    if (!stagingPathP.empty()) {
+      output << YAML::Key << "staging" << YAML::Value << stagingPathP;
+    }
+    output << YAML::Key << "instructions" << YAML::Value << YAML::BeginSeq;
     for (const auto& instruction : instructions) {
       output << instruction->serialize();
     }
     output << YAML::EndSeq;
+    output << YAML::EndMap;
   }
   return sstr.str();
 }
 
-WriteInstance Writer::beginWrite(const async::ExecInfo& info) {
-  WriteInstance instance(MPI_COMM_WORLD);
+WriteInstance Writer::beginWrite(const async::ExecInfo& info, MPI_Comm comm) {
+  WriteInstance instance(comm);
   for (const auto& instruction : instructions) {
     instance.write(info, instruction);
   }
@@ -80,4 +88,8 @@ const std::vector<std::shared_ptr<instructions::WriteInstruction>>&
   return instructions;
 }
 
+void Writer::setStagingPath(const std::string& path) { stagingPathP = path; }
+
+const std::string& Writer::stagingPath() const { return stagingPathP; }
+
 } // namespace seissol::io::writer
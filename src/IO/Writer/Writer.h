@@ -12,6 +12,8 @@
 #include <IO/Writer/Instructions/Binary.h>
 #include <IO/Writer/Instructions/Hdf5.h>
 #include <memory>
+#include <mpi.h>
+#include <string>
 #include <yaml-cpp/yaml.h>
 
 namespace seissol::io::writer {
@@ -40,15 +42,22 @@ class Writer {
 
   std::string serialize();
 
-  WriteInstance beginWrite(const async::ExecInfo& info);
+  WriteInstance beginWrite(const async::ExecInfo& info, MPI_Comm comm = MPI_COMM_WORLD);
 
   void endWrite();
 
   [[nodiscard]] const std::vector<std::shared_ptr<instructions::WriteInstruction>>&
       getInstructions() const;
 
+  // if set, the write is first staged to a rank-local file (named by the given path and the rank)
+  // and then finished from that copy; cf. file::StagingFile
+  void setStagingPath(const std::string& path);
+
+  [[nodiscard]] const std::string& stagingPath() const;
+
   private:
   std::vector<std::shared_ptr<instructions::WriteInstruction>> instructions;
+  std::string stagingPathP;
 };
 
 struct ScheduledWriter {
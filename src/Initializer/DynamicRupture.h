@@ -168,9 +168,9 @@ struct DynamicRupture {
     manager.registerData("slip1", tree, slip1);
     manager.registerData("slip2", tree, slip2);
     manager.registerData("peakSlipRate", tree, peakSlipRate);
-    manager.registerData("ruptureTime", tree, ruptureTime);
+    manager.registerData("ruptureTime", tree, ruptureTime, true);
     manager.registerData("ruptureTimePending", tree, ruptureTimePending);
-    manager.registerData("dynStressTime", tree, dynStressTime);
+    manager.registerData("dynStressTime", tree, dynStressTime, true);
     manager.registerData("dynStressTimePending", tree, dynStressTimePending);
     manager.registerData("drEnergyOutput", tree, drEnergyOutput);
   }
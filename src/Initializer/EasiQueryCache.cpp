@@ -0,0 +1,177 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "EasiQueryCache.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fcntl.h>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+#include <utils/env.h>
+#include <utils/logger.h>
+
+namespace {
+constexpr char Magic[8] = {'S', 'S', 'E', 'A', 'S', 'I', '0', '1'};
+
+// the values follow the header, aligned to doubles
+struct Header {
+  char magic[8];
+  std::uint64_t key;
+  std::uint64_t numValues;
+};
+
+// query points per independently hashed chunk; the result does not depend on the thread count
+constexpr std::size_t ChunkSize = 4096;
+
+// finalizer of splitmix64
+std::uint64_t mix(std::uint64_t value) {
+  value ^= value >> 30U;
+  value *= 0xbf58476d1ce4e5b9ULL;
+  value ^= value >> 27U;
+  value *= 0x94d049bb133111ebULL;
+  value ^= value >> 31U;
+  return value;
+}
+
+std::uint64_t combine(std::uint64_t hash, std::uint64_t value) { return mix(hash ^ mix(value)); }
+
+std::uint64_t combine(std::uint64_t hash, double value) {
+  std::uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return combine(hash, bits);
+}
+
+std::uint64_t combine(std::uint64_t hash, const std::string& text) {
+  hash = combine(hash, static_cast<std::uint64_t>(text.size()));
+  for (std::size_t offset = 0; offset < text.size(); offset += sizeof(std::uint64_t)) {
+    std::uint64_t word = 0;
+    std::memcpy(&word, text.data() + offset, std::min(sizeof(word), text.size() - offset));
+    hash = combine(hash, word);
+  }
+  return hash;
+}
+} // namespace
+
+namespace seissol::initializer {
+
+EasiQueryCache::EasiQueryCache() : EasiQueryCache(utils::Env::get("SEISSOL_EASI_CACHE", "")) {}
+
+EasiQueryCache::EasiQueryCache(std::string directory) : directory(std::move(directory)) {}
+
+std::uint64_t EasiQueryCache::key(const std::string& modelFile,
+                                  const easi::Query& query,
+                                  const std::vector<std::string>& parameters) {
+  std::ifstream model(modelFile, std::ios::binary);
+  const std::string modelContent{std::istreambuf_iterator<char>(model),
+                                 std::istreambuf_iterator<char>()};
+  std::uint64_t hash = combine(0, modelContent);
+  for (const auto& parameter : parameters) {
+    hash = combine(hash, parameter);
+  }
+
+  // (all queries of SeisSol are three-dimensional)
+  const std::size_t numPoints = query.numPoints();
+  const std::size_t numChunks = (numPoints + ChunkSize - 1) / ChunkSize;
+  std::vector<std::uint64_t> chunkHashes(numChunks);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (std::size_t chunk = 0; chunk < numChunks; ++chunk) {
+    std::uint64_t chunkHash = chunk;
+    const auto end = std::min(numPoints, (chunk + 1) * ChunkSize);
+    for (std::size_t point = chunk * ChunkSize; point < end; ++point) {
+      for (unsigned dim = 0; dim < 3; ++dim) {
+        chunkHash = combine(chunkHash, query.x(point, dim));
+      }
+      chunkHash = combine(chunkHash, static_cast<std::uint64_t>(query.group(point)));
+    }
+    chunkHashes[chunk] = chunkHash;
+  }
+  hash = combine(hash, static_cast<std::uint64_t>(numPoints));
+  for (const auto chunkHash : chunkHashes) {
+    hash = combine(hash, chunkHash);
+  }
+  return hash;
+}
+
+bool EasiQueryCache::load(std::uint64_t key,
+                          std::size_t numValues,
+                          const std::function<void(const double*)>& reader) const {
+  if (!enabled()) {
+    return false;
+  }
+  const int fd = open(fileName(key).c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  const std::size_t size = sizeof(Header) + numValues * sizeof(double);
+  struct stat status {};
+  if (fstat(fd, &status) != 0 || static_cast<std::size_t>(status.st_size) != size) {
+    close(fd);
+    return false;
+  }
+  void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+
+  Header header{};
+  std::memcpy(&header, mapped, sizeof(Header));
+  const bool valid = std::memcmp(header.magic, Magic, sizeof(Magic)) == 0 && header.key == key &&
+                     header.numValues == numValues;
+  if (valid) {
+    reader(reinterpret_cast<const double*>(static_cast<const char*>(mapped) + sizeof(Header)));
+  }
+  munmap(mapped, size);
+  return valid;
+}
+
+void EasiQueryCache::store(std::uint64_t key, const std::vector<double>& values) const {
+  if (!enabled()) {
+    return;
+  }
+  std::error_code error;
+  std::filesystem::create_directories(directory, error);
+
+  // write to a temporary file first, s.t. no partial entry can be loaded
+  const auto name = fileName(key);
+  const auto temporaryName = name + ".tmp";
+  {
+    std::ofstream file(temporaryName, std::ios::binary);
+    Header header{};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.key = key;
+    header.numValues = values.size();
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(reinterpret_cast<const char*>(values.data()),
+               static_cast<std::streamsize>(values.size() * sizeof(double)));
+    if (!file) {
+      logWarning() << "Could not write the easi cache entry" << temporaryName;
+      std::remove(temporaryName.c_str());
+      return;
+    }
+  }
+  if (std::rename(temporaryName.c_str(), name.c_str()) != 0) {
+    logWarning() << "Could not write the easi cache entry" << name;
+    std::remove(temporaryName.c_str());
+  }
+}
+
+std::string EasiQueryCache::fileName(std::uint64_t key) const {
+  std::ostringstream name;
+  name << directory << "/easi-" << std::hex << key << ".cache";
+  return name.str();
+}
+
+} // namespace seissol::initializer
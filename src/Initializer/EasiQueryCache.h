@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_INITIALIZER_EASIQUERYCACHE_H_
+#define SEISSOL_SRC_INITIALIZER_EASIQUERYCACHE_H_
+
+#include "easi/Query.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace seissol::initializer {
+
+/**
+ * On-disk cache for the results of easi queries, enabled by setting SEISSOL_EASI_CACHE to a
+ * directory.
+ *
+ * An entry holds the evaluated parameters (e.g. the materials of all cells of a rank) as a flat
+ * array of doubles after a small header, and is memory-mapped when loaded. It is keyed by the
+ * content of the model file, the requested parameters, and all query points and groups; thus, a
+ * changed model, mesh, or partition leads to a new entry. Files which are referenced by the model
+ * file (e.g. ASAGI or NetCDF grids) are not part of the key; hence, the cache directory needs to be
+ * cleared if these change.
+ */
+class EasiQueryCache {
+  public:
+  //! reads the cache directory from the environment
+  EasiQueryCache();
+
+  //! an empty directory disables the cache
+  explicit EasiQueryCache(std::string directory);
+
+  [[nodiscard]] bool enabled() const { return !directory.empty(); }
+
+  /**
+   * @param modelFile the easi model file
+   * @param query the query which is evaluated
+   * @param parameters names of the parameters which are stored, together with anything else which
+   *        changes the stored values (e.g. the averaging over cells)
+   */
+  [[nodiscard]] static std::uint64_t key(const std::string& modelFile,
+                                         const easi::Query& query,
+                                         const std::vector<std::string>& parameters);
+
+  /**
+   * Maps the entry and passes its numValues values to reader.
+   * Returns false (without calling reader), if there is no valid entry.
+   */
+  bool load(std::uint64_t key,
+            std::size_t numValues,
+            const std::function<void(const double*)>& reader) const;
+
+  //! stores the entry; failures only result in a warning
+  void store(std::uint64_t key, const std::vector<double>& values) const;
+
+  private:
+  [[nodiscard]] std::string fileName(std::uint64_t key) const;
+
+  std::string directory;
+};
+
+} // namespace seissol::initializer
+
+#endif // SEISSOL_SRC_INITIALIZER_EASIQUERYCACHE_H_
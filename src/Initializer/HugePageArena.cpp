@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "HugePageArena.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <sys/mman.h>
+#include <utility>
+#include <utils/env.h>
+#include <utils/logger.h>
+
+// not defined by older C libraries
+#ifndef MAP_HUGE_SHIFT
+#define MAP_HUGE_SHIFT 26
+#endif
+#ifndef MAP_HUGE_2MB
+#define MAP_HUGE_2MB (21 << MAP_HUGE_SHIFT)
+#endif
+#ifndef MAP_HUGE_1GB
+#define MAP_HUGE_1GB (30 << MAP_HUGE_SHIFT)
+#endif
+
+namespace {
+std::size_t roundUp(std::size_t value, std::size_t multiple) {
+  return (value + multiple - 1) / multiple * multiple;
+}
+
+// the blocks of all arenas, by their start address: end address and page size
+struct MappedRange {
+  std::uintptr_t end;
+  std::size_t pageSize;
+};
+std::mutex mappedRangesMutex;
+std::map<std::uintptr_t, MappedRange> mappedRanges;
+
+std::size_t pageSizeOfKind(seissol::memory::HugePageArena::PageKind kind) {
+  using seissol::memory::HugePageArena;
+  return kind == HugePageArena::PageKind::HugeTlb1G ? HugePageArena::GiganticPageSize
+                                                    : HugePageArena::HugePageSize;
+}
+
+void* mapHugeTlb(std::size_t size, int pageFlag) {
+#ifdef MAP_HUGETLB
+  void* data = mmap(nullptr,
+                    size,
+                    PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | pageFlag,
+                    -1,
+                    0);
+  return data == MAP_FAILED ? nullptr : data;
+#else
+  return nullptr;
+#endif
+}
+} // namespace
+
+namespace seissol::memory {
+
+HugePageArena::HugePageArena(std::size_t blockSize) : blockSize(roundUp(blockSize, HugePageSize)) {}
+
+HugePageArena::HugePageArena()
+    : HugePageArena(utils::Env::get<std::size_t>("SEISSOL_HUGE_PAGES_ARENA_SIZE", 1024) << 20) {}
+
+HugePageArena::~HugePageArena() { release(); }
+
+HugePageArena::HugePageArena(HugePageArena&& source) noexcept
+    : blockSize(source.blockSize), allocations(source.allocations),
+      blocks(std::move(source.blocks)) {
+  source.blocks.clear();
+  source.allocations = 0;
+}
+
+auto HugePageArena::operator=(HugePageArena&& source) noexcept -> HugePageArena& {
+  if (this != &source) {
+    release();
+    blockSize = source.blockSize;
+    allocations = source.allocations;
+    blocks = std::move(source.blocks);
+    source.blocks.clear();
+    source.allocations = 0;
+  }
+  return *this;
+}
+
+void HugePageArena::release() {
+  const std::lock_guard lock(mappedRangesMutex);
+  for (const auto& block : blocks) {
+    mappedRanges.erase(reinterpret_cast<std::uintptr_t>(block.data));
+    munmap(block.data, block.size);
+  }
+  blocks.clear();
+}
+
+HugePageArena::Block& HugePageArena::mapBlock(std::size_t size) {
+  size = roundUp(size, HugePageSize);
+  const auto insert = [&](void* data, PageKind kind) -> Block& {
+    const std::lock_guard lock(mappedRangesMutex);
+    const auto begin = reinterpret_cast<std::uintptr_t>(data);
+    mappedRanges[begin] = MappedRange{begin + size, pageSizeOfKind(kind)};
+    return blocks.emplace_back(Block{static_cast<char*>(data), size, 0, kind});
+  };
+
+  if (size % GiganticPageSize == 0) {
+    if (void* data = mapHugeTlb(size, MAP_HUGE_1GB)) {
+      return insert(data, PageKind::HugeTlb1G);
+    }
+  }
+  if (void* data = mapHugeTlb(size, MAP_HUGE_2MB)) {
+    return insert(data, PageKind::HugeTlb2M);
+  }
+
+  // transparent huge pages need a 2 MiB-aligned range; hence, we map one huge page more and trim
+  void* raw = mmap(nullptr,
+                   size + HugePageSize,
+                   PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS,
+                   -1,
+                   0);
+  if (raw == MAP_FAILED) {
+    logError() << "Could not map" << size << "bytes for the huge page arena.";
+  }
+  auto* begin = static_cast<char*>(raw);
+  auto* data = reinterpret_cast<char*>(
+      roundUp(reinterpret_cast<std::uintptr_t>(begin), HugePageSize));
+  if (data > begin) {
+    munmap(begin, data - begin);
+  }
+  munmap(data + size, begin + size + HugePageSize - (data + size));
+#ifdef MADV_HUGEPAGE
+  madvise(data, size, MADV_HUGEPAGE);
+#endif
+  return insert(data, PageKind::Transparent);
+}
+
+void HugePageArena::reserve(std::size_t size) {
+  if (size == 0) {
+    return;
+  }
+  for (const auto& block : blocks) {
+    if (block.size - block.used >= size) {
+      return;
+    }
+  }
+  mapBlock(size);
+}
+
+void* HugePageArena::allocate(std::size_t size, std::size_t alignment) {
+  if (size == 0) {
+    return nullptr;
+  }
+  alignment = std::max<std::size_t>(alignment, 1);
+
+  // first fit; there are only a few blocks
+  for (auto& block : blocks) {
+    const auto offset = roundUp(block.used, alignment);
+    if (offset + size <= block.size) {
+      block.used = offset + size;
+      ++allocations;
+      return block.data + offset;
+    }
+  }
+
+  // the blocks start at a huge page boundary which suffices for any alignment we use
+  auto& block = mapBlock(std::max(blockSize, size));
+  block.used = size;
+  ++allocations;
+  return block.data;
+}
+
+HugePageArena::Statistics HugePageArena::statistics() const {
+  Statistics statistics;
+  statistics.allocations = allocations;
+  statistics.blocks = blocks.size();
+  for (const auto& block : blocks) {
+    statistics.usedBytes += block.used;
+    statistics.mappedBytes += block.size;
+    statistics.mappedBytesPerKind[static_cast<int>(block.kind)] += block.size;
+  }
+  return statistics;
+}
+
+std::size_t HugePageArena::pageSizeOf(const void* pointer) {
+  const auto address = reinterpret_cast<std::uintptr_t>(pointer);
+  const std::lock_guard lock(mappedRangesMutex);
+  auto range = mappedRanges.upper_bound(address);
+  if (range == mappedRanges.begin()) {
+    return 0;
+  }
+  --range;
+  return address < range->second.end ? range->second.pageSize : 0;
+}
+
+} // namespace seissol::memory
@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_INITIALIZER_HUGEPAGEARENA_H_
+#define SEISSOL_SRC_INITIALIZER_HUGEPAGEARENA_H_
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace seissol::memory {
+
+/**
+ * Carves allocations from a few large blocks of memory which are backed by huge pages.
+ *
+ * Each block is mapped with explicit huge pages (MAP_HUGETLB; 1 GiB pages if the block size is a
+ * multiple of 1 GiB, 2 MiB pages otherwise) if the system provides enough of them; otherwise, it
+ * falls back to transparent huge pages (madvise(MADV_HUGEPAGE)).
+ *
+ * Unless reserved beforehand, a block has at least the size given at construction.
+ * Allocations are never freed individually; all blocks are unmapped together when the arena is
+ * destroyed.
+ */
+class HugePageArena {
+  public:
+  enum class PageKind { HugeTlb1G = 0, HugeTlb2M = 1, Transparent = 2 };
+
+  static constexpr std::size_t HugePageSize = std::size_t{1} << 21;
+  static constexpr std::size_t GiganticPageSize = std::size_t{1} << 30;
+
+  struct Statistics {
+    std::size_t allocations{0};
+    std::size_t usedBytes{0};
+    std::size_t mappedBytes{0};
+    std::size_t blocks{0};
+    std::array<std::size_t, 3> mappedBytesPerKind{}; //!< indexed by PageKind
+  };
+
+  /**
+   * @param blockSize minimum size of a block in bytes; larger allocations get a block of their own
+   */
+  explicit HugePageArena(std::size_t blockSize);
+  HugePageArena();
+  ~HugePageArena();
+
+  HugePageArena(const HugePageArena&) = delete;
+  auto operator=(const HugePageArena&) = delete;
+
+  HugePageArena(HugePageArena&& source) noexcept;
+  auto operator=(HugePageArena&& source) noexcept -> HugePageArena&;
+
+  /**
+   * Makes sure that the next allocations of (in total) size bytes fit into the mapped blocks;
+   * otherwise, maps a block of exactly that size (rounded up to huge pages).
+   */
+  void reserve(std::size_t size);
+
+  void* allocate(std::size_t size, std::size_t alignment);
+
+  [[nodiscard]] Statistics statistics() const;
+
+  /**
+   * Returns the size of the pages backing the given address, if it lies in a block of any arena;
+   * 0 otherwise.
+   */
+  static std::size_t pageSizeOf(const void* pointer);
+
+  private:
+  struct Block {
+    char* data;
+    std::size_t size;
+    std::size_t used;
+    PageKind kind;
+  };
+
+  Block& mapBlock(std::size_t size);
+  void release();
+
+  std::size_t blockSize;
+  std::size_t allocations{0};
+  std::vector<Block> blocks;
+};
+
+} // namespace seissol::memory
+
+#endif // SEISSOL_SRC_INITIALIZER_HUGEPAGEARENA_H_
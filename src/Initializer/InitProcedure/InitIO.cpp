@@ -5,10 +5,14 @@
 #include "IO/Writer/Writer.h"
 #include "Init.h"
 #include "Numerical/Transformation.h"
+#include "Parallel/Helper.h"
 #include "SeisSol.h"
 #include <Common/Constants.h>
 #include <Geometry/MeshDefinition.h>
+#include <IO/Datatype/Datatype.h>
+#include <IO/Writer/Instructions/Hdf5.h>
 #include <Initializer/DynamicRupture.h>
+#include <Initializer/Parameters/OutputParameters.h>
 #include <Initializer/Tree/Layer.h>
 #include <Kernels/Common.h>
 #include <Kernels/Precision.h>
@@ -17,6 +21,7 @@
 #include <cstring>
 #include <init.h>
 #include <kernel.h>
+#include <memory>
 #include <string>
 #include <tensor.h>
 #include <utils/logger.h>
@@ -26,13 +31,29 @@
 
 namespace {
 
+seissol::io::instance::mesh::PointDataFormat
+    pointDataFormat(seissol::initializer::parameters::OutputEncoding encoding, int compress) {
+  using seissol::initializer::parameters::OutputEncoding;
+  seissol::io::instance::mesh::PointDataFormat format;
+  format.compress = compress;
+  if (encoding == OutputEncoding::Float32) {
+    format.targetType = std::make_shared<seissol::io::datatype::F32Datatype>();
+  } else if (encoding == OutputEncoding::Float16) {
+    format.targetType = std::make_shared<seissol::io::datatype::F16Datatype>();
+  } else if (encoding == OutputEncoding::Int16) {
+    format.encoding = seissol::io::writer::instructions::Hdf5Encoding::ScaledInt16;
+  }
+  return format;
+}
+
 void setupCheckpointing(seissol::SeisSol& seissolInstance) {
   auto& checkpoint = seissolInstance.getOutputManager().getCheckpointManager();
 
+  // (also needed by the rebalancer)
+  auto* ltsTree = seissolInstance.getMemoryManager().getLtsTree();
+  std::vector<std::size_t> globalIds(
+      ltsTree->getNumberOfCells(seissol::initializer::LayerMask(Ghost)));
   {
-    auto* tree = seissolInstance.getMemoryManager().getLtsTree();
-    std::vector<std::size_t> globalIds(
-        tree->getNumberOfCells(seissol::initializer::LayerMask(Ghost)));
     const auto* ltsToMesh = seissolInstance.getMemoryManager().getLtsLut()->getLtsToMeshLut(
         seissol::initializer::LayerMask(Ghost));
 #ifdef _OPENMP
@@ -41,8 +62,8 @@ void setupCheckpointing(seissol::SeisSol& seissolInstance) {
     for (std::size_t i = 0; i < globalIds.size(); ++i) {
       globalIds[i] = seissolInstance.meshReader().getElements()[ltsToMesh[i]].globalId;
     }
-    checkpoint.registerTree("lts", tree, globalIds);
-    seissolInstance.getMemoryManager().getLts()->registerCheckpointVariables(checkpoint, tree);
+    checkpoint.registerTree("lts", ltsTree, globalIds);
+    seissolInstance.getMemoryManager().getLts()->registerCheckpointVariables(checkpoint, ltsTree);
   }
 
   {
@@ -66,17 +87,197 @@ void setupCheckpointing(seissol::SeisSol& seissolInstance) {
     dynrup->registerCheckpointVariables(checkpoint, tree);
   }
 
+  const auto& checkpointParameters =
+      seissolInstance.getSeisSolParameters().output.checkpointParameters;
+  // (set before loading, since the local checkpoint directory is needed for that as well)
+  checkpoint.setWriteOptions(seissol::io::instance::checkpoint::CheckpointWriteOptions{
+      checkpointParameters.compression,
+      checkpointParameters.lossy,
+      checkpointParameters.incremental,
+      checkpointParameters.localDirectory});
+
   if (seissolInstance.getCheckpointLoadFile().has_value()) {
     const double time = seissolInstance.getOutputManager().loadCheckpoint(
         seissolInstance.getCheckpointLoadFile().value());
     seissolInstance.simulator().setCurrentTime(time);
   }
 
-  if (seissolInstance.getSeisSolParameters().output.checkpointParameters.enabled) {
+  if (checkpointParameters.enabled) {
+    if (checkpointParameters.rebalanceImbalance > 0) {
+      // (registers its data with the checkpoint; hence, before the checkpoint writer is set up)
+      seissolInstance.rebalancer().setup(checkpoint,
+                                         ltsTree,
+                                         globalIds,
+                                         checkpointParameters.interval,
+                                         checkpointParameters.rebalanceImbalance);
+    }
     // FIXME: for now, we allow only _one_ checkpoint interval which checkpoints everything existent
-    seissolInstance.getOutputManager().setupCheckpoint(
-        seissolInstance.getSeisSolParameters().output.checkpointParameters.interval);
+    seissolInstance.getOutputManager().setupCheckpoint(checkpointParameters.interval);
+  }
+}
+
+// sets up the high-order (VTK-HDF) wave field output for one region
+void setupWaveFieldOutput(
+    seissol::SeisSol& seissolInstance,
+    const seissol::initializer::parameters::WaveFieldOutputParameters& parameters,
+    const std::string& name) {
+  const auto& seissolParams = seissolInstance.getSeisSolParameters();
+  auto& memoryManager = seissolInstance.getMemoryManager();
+  auto* lts = memoryManager.getLts();
+  auto* ltsLut = memoryManager.getLtsLut();
+
+  // Effectively temporary code for now. To be refactored.
+  if (parameters.vtkorder == 0) {
+    logError() << "VTK order 0 is currently not supported for the wavefield output.";
+  }
+
+  auto order = parameters.vtkorder;
+  auto& meshReader = seissolInstance.meshReader();
+
+  // TODO: store somewhere
+  std::vector<std::size_t> celllist;
+  celllist.reserve(meshReader.getElements().size());
+  if (parameters.bounds.enabled || !parameters.groups.empty()) {
+    const auto& vertexArray = meshReader.getVertices();
+    for (std::size_t i = 0; i < meshReader.getElements().size(); ++i) {
+      const auto& element = meshReader.getElements()[i];
+      const auto& vertex0 = vertexArray[element.vertices[0]].coords;
+      const auto& vertex1 = vertexArray[element.vertices[1]].coords;
+      const auto& vertex2 = vertexArray[element.vertices[2]].coords;
+      const auto& vertex3 = vertexArray[element.vertices[3]].coords;
+      const bool inGroup = parameters.groups.empty() ||
+                           parameters.groups.find(element.group) != parameters.groups.end();
+      const bool inRegion = !parameters.bounds.enabled ||
+                            (parameters.bounds.contains(vertex0[0], vertex0[1], vertex0[2]) ||
+                             parameters.bounds.contains(vertex1[0], vertex1[1], vertex1[2]) ||
+                             parameters.bounds.contains(vertex2[0], vertex2[1], vertex2[2]) ||
+                             parameters.bounds.contains(vertex3[0], vertex3[1], vertex3[2]));
+      if (inGroup && inRegion) {
+        celllist.push_back(i);
+      }
+    }
+  } else {
+    for (std::size_t i = 0; i < meshReader.getElements().size(); ++i) {
+      celllist.push_back(i);
+    }
+  }
+  // write the cells in the order in which their DOFs are stored
+  const auto dofsMask = lts->dofs.mask;
+  std::sort(celllist.begin(), celllist.end(), [&](std::size_t a, std::size_t b) {
+    return ltsLut->ltsId(dofsMask, a) < ltsLut->ltsId(dofsMask, b);
+  });
+  auto* cellIndices = new std::size_t[celllist.size()];
+  std::copy(celllist.begin(), celllist.end(), cellIndices);
+
+  io::writer::ScheduledWriter schedWriter;
+  schedWriter.name = name;
+  schedWriter.interval = parameters.interval;
+  auto writer = io::instance::mesh::VtkHdfWriter(name, celllist.size(), 3, order);
+
+  writer.addPointProjector([=](double* target, std::size_t index) {
+    const auto& element = meshReader.getElements()[cellIndices[index]];
+    const auto& vertexArray = meshReader.getVertices();
+
+    // for the very time being, circumvent the bounding box mechanism of Yateto as follows.
+    const double zero[3] = {0, 0, 0};
+    seissol::transformations::tetrahedronReferenceToGlobal(
+        vertexArray[element.vertices[0]].coords,
+        vertexArray[element.vertices[1]].coords,
+        vertexArray[element.vertices[2]].coords,
+        vertexArray[element.vertices[3]].coords,
+        zero,
+        &target[0]);
+    for (std::size_t i = 1; i < tensor::vtk3d::Shape[order][1]; ++i) {
+      double point[3] = {init::vtk3d::Values[order][i * 3 - 3 + 0],
+                         init::vtk3d::Values[order][i * 3 - 3 + 1],
+                         init::vtk3d::Values[order][i * 3 - 3 + 2]};
+      seissol::transformations::tetrahedronReferenceToGlobal(
+          vertexArray[element.vertices[0]].coords,
+          vertexArray[element.vertices[1]].coords,
+          vertexArray[element.vertices[2]].coords,
+          vertexArray[element.vertices[3]].coords,
+          point,
+          &target[i * 3]);
+    }
+  });
+
+  // TODO: make those being read from the material class
+  std::vector<std::string> quantityLabels = {
+      "sigma_xx",
+      "sigma_yy",
+      "sigma_zz",
+      "sigma_xy",
+      "sigma_yz",
+      "sigma_xz",
+      "u",
+      "v",
+      "w",
+#ifdef USE_POROELASTIC
+      "p",
+      "u_f",
+      "v_f",
+      "w_f",
+#endif
+  };
+  std::vector<std::string> plasticityLabels = {
+      "ep_xx", "ep_yy", "ep_zz", "ep_xy", "ep_yz", "ep_xz", "eta"};
+  // project all quantities of a cell with one kernel call, and write only the selected ones
+  const auto compress = parameters.vtkCompression;
+  std::vector<std::string> selectedLabels;
+  std::vector<std::size_t> selectedQuantities;
+  std::vector<io::instance::mesh::PointDataFormat> selectedFormats;
+  for (std::size_t quantity = 0; quantity < seissol::model::MaterialT::NumQuantities; ++quantity) {
+    if (parameters.outputMask[quantity]) {
+      selectedLabels.push_back(quantityLabels[quantity]);
+      selectedQuantities.push_back(quantity);
+      selectedFormats.push_back(pointDataFormat(parameters.outputEncoding[quantity], compress));
+    }
   }
+  if (!selectedQuantities.empty()) {
+    writer.addPointDataBatch<real>(
+        selectedLabels,
+        selectedQuantities,
+        selectedFormats,
+        tensor::xvq::Shape[order][1],
+        [=](real* target, std::size_t index) {
+          kernel::projectQuantitiesToVtkVolume vtkproj;
+          vtkproj.qv = ltsLut->lookup(lts->dofs, cellIndices[index]);
+          vtkproj.xvq(order) = target;
+          vtkproj.collvv(ConvergenceOrder, order) =
+              init::collvv::Values[ConvergenceOrder + (ConvergenceOrder + 1) * order];
+          vtkproj.execute(order);
+        });
+  }
+  if (seissolParams.model.plasticity) {
+    std::vector<std::string> selectedPlasticityLabels;
+    std::vector<std::size_t> selectedPlasticityQuantities;
+    std::vector<io::instance::mesh::PointDataFormat> selectedPlasticityFormats;
+    for (std::size_t quantity = 0; quantity < 7; ++quantity) {
+      if (parameters.plasticityMask[quantity]) {
+        selectedPlasticityLabels.push_back(plasticityLabels[quantity]);
+        selectedPlasticityQuantities.push_back(quantity);
+        selectedPlasticityFormats.push_back(
+            pointDataFormat(parameters.plasticityEncoding[quantity], compress));
+      }
+    }
+    if (!selectedPlasticityQuantities.empty()) {
+      writer.addPointDataBatch<real>(
+          selectedPlasticityLabels,
+          selectedPlasticityQuantities,
+          selectedPlasticityFormats,
+          tensor::xvp::Shape[order][1],
+          [=](real* target, std::size_t index) {
+            kernel::projectPstrainToVtkVolume vtkproj;
+            vtkproj.pv = ltsLut->lookup(lts->pstrain, cellIndices[index]);
+            vtkproj.xvp(order) = target;
+            vtkproj.collvv(ConvergenceOrder, order) =
+                init::collvv::Values[ConvergenceOrder + (ConvergenceOrder + 1) * order];
+            vtkproj.execute(order);
+          });
+    }
+  }
+  schedWriter.planWrite = writer.makeWriter();
+  seissolInstance.getOutputManager().addOutput(schedWriter);
 }
 
 void setupOutput(seissol::SeisSol& seissolInstance) {
@@ -119,6 +320,16 @@ void setupOutput(seissol::SeisSol& seissolInstance) {
         seissolParams.output.waveFieldParameters,
         seissolParams.output.xdmfWriterBackend,
         backupTimeStamp);
+
+    if (seissol::useSyncFreeOutput()) {
+      const auto& variableSizes = ltsTree->getVariableSizes();
+      auto* outputSampler = seissolInstance.waveFieldWriter().enableSampling(
+          variableSizes[lts->dofs.index] / sizeof(real),
+          variableSizes[lts->pstrain.index] / sizeof(real));
+      if (outputSampler != nullptr) {
+        seissolInstance.timeManager().setOutputSampler(outputSampler);
+      }
+    }
   }
 
   // TODO(David): change Yateto/TensorForge interface to make padded sizes more accessible
@@ -128,138 +339,10 @@ void setupOutput(seissol::SeisSol& seissolInstance) {
 
   if (seissolParams.output.waveFieldParameters.enabled &&
       seissolParams.output.waveFieldParameters.vtkorder >= 0) {
-
-    // Effectively temporary code for now. To be refactored.
-    if (seissolParams.output.waveFieldParameters.vtkorder == 0) {
-      logError() << "VTK order 0 is currently not supported for the wavefield output.";
-    }
-
-    auto order = seissolParams.output.waveFieldParameters.vtkorder;
-    auto& meshReader = seissolInstance.meshReader();
-
-    // TODO: store somewhere
-    std::vector<std::size_t> celllist;
-    celllist.reserve(meshReader.getElements().size());
-    if (seissolParams.output.waveFieldParameters.bounds.enabled ||
-        !seissolParams.output.waveFieldParameters.groups.empty()) {
-      const auto& vertexArray = meshReader.getVertices();
-      for (std::size_t i = 0; i < meshReader.getElements().size(); ++i) {
-        const auto& element = meshReader.getElements()[i];
-        const auto& vertex0 = vertexArray[element.vertices[0]].coords;
-        const auto& vertex1 = vertexArray[element.vertices[1]].coords;
-        const auto& vertex2 = vertexArray[element.vertices[2]].coords;
-        const auto& vertex3 = vertexArray[element.vertices[3]].coords;
-        const bool inGroup = seissolParams.output.waveFieldParameters.groups.empty() ||
-                             seissolParams.output.waveFieldParameters.groups.find(element.group) !=
-                                 seissolParams.output.waveFieldParameters.groups.end();
-        const bool inRegion = !seissolParams.output.waveFieldParameters.bounds.enabled ||
-                              (seissolParams.output.waveFieldParameters.bounds.contains(
-                                   vertex0[0], vertex0[1], vertex0[2]) ||
-                               seissolParams.output.waveFieldParameters.bounds.contains(
-                                   vertex1[0], vertex1[1], vertex1[2]) ||
-                               seissolParams.output.waveFieldParameters.bounds.contains(
-                                   vertex2[0], vertex2[1], vertex2[2]) ||
-                               seissolParams.output.waveFieldParameters.bounds.contains(
-                                   vertex3[0], vertex3[1], vertex3[2]));
-        if (inGroup && inRegion) {
-          celllist.push_back(i);
-        }
-      }
-    } else {
-      for (std::size_t i = 0; i < meshReader.getElements().size(); ++i) {
-        celllist.push_back(i);
-      }
-    }
-    auto* cellIndices = new std::size_t[celllist.size()];
-    std::copy(celllist.begin(), celllist.end(), cellIndices);
-
-    io::writer::ScheduledWriter schedWriter;
-    schedWriter.name = "wavefield";
-    schedWriter.interval = seissolParams.output.waveFieldParameters.interval;
-    auto writer = io::instance::mesh::VtkHdfWriter("wavefield", celllist.size(), 3, order);
-
-    writer.addPointProjector([=](double* target, std::size_t index) {
-      const auto& element = meshReader.getElements()[cellIndices[index]];
-      const auto& vertexArray = meshReader.getVertices();
-
-      // for the very time being, circumvent the bounding box mechanism of Yateto as follows.
-      const double zero[3] = {0, 0, 0};
-      seissol::transformations::tetrahedronReferenceToGlobal(
-          vertexArray[element.vertices[0]].coords,
-          vertexArray[element.vertices[1]].coords,
-          vertexArray[element.vertices[2]].coords,
-          vertexArray[element.vertices[3]].coords,
-          zero,
-          &target[0]);
-      for (std::size_t i = 1; i < tensor::vtk3d::Shape[order][1]; ++i) {
-        double point[3] = {init::vtk3d::Values[order][i * 3 - 3 + 0],
-                           init::vtk3d::Values[order][i * 3 - 3 + 1],
-                           init::vtk3d::Values[order][i * 3 - 3 + 2]};
-        seissol::transformations::tetrahedronReferenceToGlobal(
-            vertexArray[element.vertices[0]].coords,
-            vertexArray[element.vertices[1]].coords,
-            vertexArray[element.vertices[2]].coords,
-            vertexArray[element.vertices[3]].coords,
-            point,
-            &target[i * 3]);
-      }
-    });
-
-    // TODO: make those being read from the material class
-    std::vector<std::string> quantityLabels = {
-        "sigma_xx",
-        "sigma_yy",
-        "sigma_zz",
-        "sigma_xy",
-        "sigma_yz",
-        "sigma_xz",
-        "u",
-        "v",
-        "w",
-#ifdef USE_POROELASTIC
-        "p",
-        "u_f",
-        "v_f",
-        "w_f",
-#endif
-    };
-    std::vector<std::string> plasticityLabels = {
-        "ep_xx", "ep_yy", "ep_zz", "ep_xy", "ep_yz", "ep_xz", "eta"};
-    for (std::size_t quantity = 0; quantity < seissol::model::MaterialT::NumQuantities;
-         ++quantity) {
-      if (seissolParams.output.waveFieldParameters.outputMask[quantity]) {
-        writer.addPointData<real>(
-            quantityLabels[quantity], {}, [=](real* target, std::size_t index) {
-              const auto* dofsAllQuantities = ltsLut->lookup(lts->dofs, cellIndices[index]);
-              const auto* dofsSingleQuantity = dofsAllQuantities + QDofSizePadded * quantity;
-              kernel::projectBasisToVtkVolume vtkproj;
-              vtkproj.qb = dofsSingleQuantity;
-              vtkproj.xv(order) = target;
-              vtkproj.collvv(ConvergenceOrder, order) =
-                  init::collvv::Values[ConvergenceOrder + (ConvergenceOrder + 1) * order];
-              vtkproj.execute(order);
-            });
-      }
-    }
-    if (seissolParams.model.plasticity) {
-      for (std::size_t quantity = 0; quantity < 7; ++quantity) {
-        if (seissolParams.output.waveFieldParameters.plasticityMask[quantity]) {
-          writer.addPointData<real>(
-              plasticityLabels[quantity], {}, [=](real* target, std::size_t index) {
-                const auto* dofsAllQuantities = ltsLut->lookup(lts->pstrain, cellIndices[index]);
-                const auto* dofsSingleQuantity = dofsAllQuantities + QDofSizePadded * quantity;
-                kernel::projectBasisToVtkVolume vtkproj;
-                vtkproj.qb = dofsSingleQuantity;
-                vtkproj.xv(order) = target;
-                vtkproj.collvv(ConvergenceOrder, order) =
-                    init::collvv::Values[ConvergenceOrder + (ConvergenceOrder + 1) * order];
-                vtkproj.execute(order);
-              });
-        }
-      }
-    }
-    schedWriter.planWrite = writer.makeWriter();
-    seissolInstance.getOutputManager().addOutput(schedWriter);
+    setupWaveFieldOutput(seissolInstance, seissolParams.output.waveFieldParameters, "wavefield");
+  }
+  for (const auto& region : seissolParams.output.waveFieldRegions) {
+    setupWaveFieldOutput(seissolInstance, region, "wavefield-" + region.name);
   }
 
   if (seissolParams.output.freeSurfaceParameters.enabled &&
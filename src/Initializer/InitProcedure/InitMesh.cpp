@@ -4,7 +4,12 @@
 #include <Initializer/Parameters/MeshParameters.h>
 #include <Initializer/Parameters/SeisSolParameters.h>
 #include <Initializer/TimeStepping/LtsWeights/LtsWeights.h>
+#include <cstdint>
 #include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <system_error>
 
 #include "utils/env.h"
 #include "utils/logger.h"
@@ -18,8 +23,12 @@
 #endif // USE_NETCDF
 #if defined(USE_HDF) && defined(USE_MPI)
 #include "Geometry/PUMLReader.h"
+#include "Geometry/PreparedMeshReader.h"
 #include <hdf5.h>
 #endif // defined(USE_HDF) && defined(USE_MPI)
+#include "Common/Constants.h"
+#include "Common/Filesystem.h"
+#include "Equations/Datastructures.h"
 #include "Initializer/TimeStepping/LtsWeights/WeightsFactory.h"
 #include "Modules/Modules.h"
 #include "Monitoring/Instrumentation.h"
@@ -71,10 +80,93 @@ void postMeshread(seissol::geometry::MeshReader& meshReader,
   seissolInstance.getLtsLayout().setMesh(meshReader);
 }
 
+#if defined(USE_HDF) && defined(USE_MPI)
+/**
+ * Identifies everything the partitioned PUML mesh depends on, i.e. the mesh file, and all
+ * inputs of the LTS weights and the partitioning. The mesh file is identified by its size and
+ * modification time only, as hashing its content would take about as long as reading it.
+ */
+std::uint64_t
+    preparedMeshSignature(const seissol::initializer::parameters::SeisSolParameters& seissolParams,
+                          seissol::SeisSol& seissolInstance) {
+  std::ostringstream description;
+  description.precision(17);
+  const auto describeFile = [&](const std::string& name, bool content) {
+    std::error_code error;
+    const auto size = seissol::filesystem::file_size(name, error);
+    const auto time = seissol::filesystem::last_write_time(name, error);
+    description << name << ' ' << size << ' ' << time.time_since_epoch().count() << '\n';
+    if (content) {
+      std::ifstream file(name, std::ios::binary);
+      description << file.rdbuf() << '\n';
+    }
+  };
+
+  // (the version of the file layout and the build configuration)
+  description << "prepared-mesh-1 " << ConvergenceOrder << ' ' << seissol::model::MaterialT::Text
+              << ' ' << seissol::MPI::mpi.size() << '\n';
+
+  describeFile(seissolParams.mesh.meshFileName, false);
+  description << static_cast<int>(seissolParams.mesh.pumlBoundaryFormat) << ' '
+              << seissolParams.mesh.partitioningLib << '\n';
+
+  describeFile(seissolParams.model.materialFileName, true);
+  const auto& timeStepping = seissolParams.timeStepping;
+  const auto& lts = timeStepping.lts;
+  description << timeStepping.cfl << ' ' << timeStepping.maxTimestepWidth << ' ' << lts.getRate()
+              << ' ' << static_cast<int>(lts.getLtsWeightsType()) << ' '
+              << lts.getWiggleFactorMinimum() << ' ' << lts.getWiggleFactorStepsize() << ' '
+              << lts.getWiggleFactorEnforceMaximumDifference() << ' '
+              << lts.getMaxNumberOfClusters() << ' ' << lts.isAutoMergeUsed() << ' '
+              << lts.getAllowedPerformanceLossRatioAutoMerge() << ' '
+              << static_cast<int>(lts.getAutoMergeCostBaseline()) << '\n';
+  description << timeStepping.vertexWeight.weightElement << ' '
+              << timeStepping.vertexWeight.weightDynamicRupture << ' '
+              << timeStepping.vertexWeight.weightFreeSurfaceWithGravity << '\n';
+  if (!timeStepping.vertexWeight.costModelFile.empty()) {
+    describeFile(timeStepping.vertexWeight.costModelFile, true);
+  }
+
+  // a restart may rebalance the partition with the costs measured before
+  const auto& checkpointFile = seissolInstance.getCheckpointLoadFile();
+  if (checkpointFile.has_value() && seissolParams.output.checkpointParameters.enabled &&
+      seissolParams.output.checkpointParameters.rebalanceImbalance > 0) {
+    describeFile(checkpointFile.value(), false);
+  }
+
+  // FNV-1a
+  constexpr std::uint64_t Prime = 0x100000001b3ULL;
+  std::uint64_t hash = 0xcbf29ce484222325ULL;
+  for (const char c : description.str()) {
+    hash = (hash ^ static_cast<unsigned char>(c)) * Prime;
+  }
+  return hash;
+}
+#endif // defined(USE_HDF) && defined(USE_MPI)
+
 void readMeshPUML(const seissol::initializer::parameters::SeisSolParameters& seissolParams,
                   seissol::SeisSol& seissolInstance) {
 #if defined(USE_HDF) && defined(USE_MPI)
   const int rank = seissol::MPI::mpi.rank();
+
+  const auto& preparedMeshFile = seissolParams.mesh.preparedMeshFile;
+  std::uint64_t signature = 0;
+  if (!preparedMeshFile.empty()) {
+    signature = preparedMeshSignature(seissolParams, seissolInstance);
+    if (seissol::geometry::PreparedMeshReader::matches(preparedMeshFile, signature)) {
+      logInfo(rank) << "Reading the prepared mesh" << preparedMeshFile;
+      seissol::Stopwatch watch;
+      watch.start();
+      seissolInstance.setMeshReader(new seissol::geometry::PreparedMeshReader(preparedMeshFile));
+      watch.pause();
+      watch.printTime("Prepared mesh read in:");
+      return;
+    }
+    logInfo(rank) << "The prepared mesh" << preparedMeshFile
+                  << "does not exist or does not match the current setup. It is written after "
+                     "partitioning the mesh.";
+  }
+
   double nodeWeight = 1.0;
 
   if (utils::Env::get<bool>("SEISSOL_MINISEISSOL", true)) {
@@ -192,7 +284,8 @@ void readMeshPUML(const seissol::initializer::parameters::SeisSolParameters& sei
       seissolParams.timeStepping.lts.getRate(),
       seissolParams.timeStepping.vertexWeight.weightElement,
       seissolParams.timeStepping.vertexWeight.weightDynamicRupture,
-      seissolParams.timeStepping.vertexWeight.weightFreeSurfaceWithGravity};
+      seissolParams.timeStepping.vertexWeight.weightFreeSurfaceWithGravity,
+      seissolParams.timeStepping.vertexWeight.costModelFile};
 
   auto ltsWeights = getLtsWeightsImplementation(
       seissolParams.timeStepping.lts.getLtsWeightsType(), config, seissolInstance);
@@ -207,6 +300,11 @@ void readMeshPUML(const seissol::initializer::parameters::SeisSolParameters& sei
   watch.pause();
   watch.printTime("PUML mesh read in:");
 
+  if (!preparedMeshFile.empty()) {
+    logInfo(rank) << "Writing the prepared mesh" << preparedMeshFile;
+    seissol::geometry::PreparedMeshReader::write(*meshReader, preparedMeshFile, signature);
+  }
+
 #else // defined(USE_HDF) && defined(USE_MPI)
 #ifndef USE_MPI
   logError() << "Tried to load a PUML mesh. However, PUML is currently only supported with MPI "
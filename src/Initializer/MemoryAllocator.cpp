@@ -72,10 +72,12 @@
  **/
 #include "MemoryAllocator.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <cstring>
 #include <stdlib.h>
+#include <sys/mman.h>
 #include <utils/logger.h>
 #include <vector>
 
@@ -85,6 +87,21 @@
 
 namespace seissol::memory {
 
+namespace {
+void* allocateHugePages(size_t size, size_t alignment) {
+  // align to huge pages s.t. the kernel may back the whole allocation with them
+  void* ptrBuffer{nullptr};
+  if (posix_memalign(&ptrBuffer, std::max(alignment, HugePageArena::HugePageSize), size) != 0) {
+    logError() << "The malloc failed (bytes: " << size << ", alignment: " << alignment
+               << ", memkind: " << HugePages << ").";
+  }
+#ifdef MADV_HUGEPAGE
+  madvise(ptrBuffer, size, MADV_HUGEPAGE);
+#endif
+  return ptrBuffer;
+}
+} // namespace
+
 void* allocate(size_t size, size_t alignment, enum Memkind memkind) {
   void* ptrBuffer{nullptr};
   bool error = false;
@@ -97,6 +114,10 @@ void* allocate(size_t size, size_t alignment, enum Memkind memkind) {
     return ptrBuffer;
   }
 
+  if (memkind == HugePages) {
+    return allocateHugePages(size, alignment);
+  }
+
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if (memkind == 0) {
 #endif
@@ -141,6 +162,11 @@ void* allocate(size_t size, size_t alignment, enum Memkind memkind) {
 }
 
 void free(void* pointer, enum Memkind memkind) {
+  if (memkind == HugePages) {
+    ::free(pointer);
+    return;
+  }
+
 #if defined(USE_MEMKIND) || defined(ACL_DEVICE)
   if (memkind == Standard) {
 #endif
@@ -234,6 +260,10 @@ ManagedAllocator::~ManagedAllocator() {
 }
 
 void* ManagedAllocator::allocateMemory(size_t size, size_t alignment, enum Memkind memkind) {
+  if (memkind == HugePages) {
+    // freed together with the arena
+    return hugePageArena.allocate(size, alignment);
+  }
   void* ptrBuffer = allocate(size, alignment, memkind);
   dataMemoryAddresses.emplace_back(memkind, ptrBuffer);
   return ptrBuffer;
@@ -75,9 +75,11 @@
 #define MEMORYALLOCATOR_H_
 
 #include "Common/Constants.h"
+#include "HugePageArena.h"
 #include "Kernels/Precision.h"
 #include <cassert>
 #include <cstdlib>
+#include <utils/env.h>
 #include <vector>
 
 #ifdef USE_MEMKIND
@@ -118,8 +120,21 @@ enum Memkind {
   HighBandwidth = 1,
   DeviceGlobalMemory = 3,
   DeviceUnifiedMemory = 4,
-  PinnedMemory = 5
+  PinnedMemory = 5,
+  HugePages = 6
 };
+
+/**
+ * Returns true, if the host memory of the LTS and DR trees is taken from huge-page arenas.
+ */
+inline bool useHugePages() { return utils::Env::get<bool>("SEISSOL_HUGE_PAGES", false); }
+
+/**
+ * Allocates memory of the given kind.
+ *
+ * HugePages memory is aligned to (and advised for) transparent huge pages here; a
+ * ManagedAllocator instead carves it from its huge-page arena.
+ **/
 void* allocate(size_t size, size_t alignment = 1, enum Memkind memkind = Standard);
 
 template <typename T>
@@ -177,6 +192,9 @@ class ManagedAllocator {
   //! calling functions of the memory allocator.
   AddressVector dataMemoryAddresses;
 
+  //! holds all memory of kind HugePages
+  HugePageArena hugePageArena;
+
   public:
   ManagedAllocator() = default;
 
@@ -199,6 +217,16 @@ class ManagedAllocator {
    * @return pointer, which points to the aligned memory of the given size.
    **/
   void* allocateMemory(size_t size, size_t alignment = 1, enum Memkind memkind = Standard);
+
+  /**
+   * Maps the huge pages for the next HugePages allocations of (in total) size bytes at once,
+   * instead of a block of the default arena size.
+   **/
+  void reserveHugePages(size_t size) { hugePageArena.reserve(size); }
+
+  [[nodiscard]] HugePageArena::Statistics hugePageStatistics() const {
+    return hugePageArena.statistics();
+  }
 };
 
 template <typename T>
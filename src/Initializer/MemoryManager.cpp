@@ -86,6 +86,7 @@
 #include "Initializer/Parameters/SeisSolParameters.h"
 #include "Kernels/Common.h"
 #include "Kernels/Touch.h"
+#include "Monitoring/Unit.h"
 
 #include "Common/Iterator.h"
 
@@ -97,6 +98,26 @@
 #include "DynamicRupture/FrictionLaws/GpuImpl/FrictionSolverInterface.h"
 #endif // ACL_DEVICE
 
+namespace {
+void printHugePageStatistics(const char* treeName,
+                             const seissol::memory::HugePageArena::Statistics& statistics) {
+  using seissol::memory::HugePageArena;
+  const auto rank = seissol::MPI::mpi.rank();
+  const auto format = [](std::size_t bytes) { return seissol::UnitByte.formatPrefix(bytes); };
+  const auto& perKind = statistics.mappedBytesPerKind;
+  logInfo(rank) << "Huge-page arena of the" << treeName << "(rank 0):" << statistics.allocations
+                << "allocations," << format(statistics.usedBytes).c_str() << "used of"
+                << format(statistics.mappedBytes).c_str() << "in" << statistics.blocks
+                << "blocks (1 GiB pages:"
+                << format(perKind[static_cast<int>(HugePageArena::PageKind::HugeTlb1G)]).c_str()
+                << ", 2 MiB pages:"
+                << format(perKind[static_cast<int>(HugePageArena::PageKind::HugeTlb2M)]).c_str()
+                << ", transparent huge pages:"
+                << format(perKind[static_cast<int>(HugePageArena::PageKind::Transparent)]).c_str()
+                << ").";
+}
+} // namespace
+
 void seissol::initializer::MemoryManager::initialize()
 {
   // initialize global matrices
@@ -521,7 +542,7 @@ void seissol::initializer::MemoryManager::fixateLtsTree(struct TimeStepping& i_t
   }
 
   m_ltsTree.allocateVariables();
-  m_ltsTree.touchVariables();
+  m_ltsTree.touchVariables(&seissolInstance.getNumaPlacement());
 
   /// Dynamic rupture tree
   m_dynRup->addTo(m_dynRupTree);
@@ -542,7 +563,7 @@ void seissol::initializer::MemoryManager::fixateLtsTree(struct TimeStepping& i_t
   }
 
   m_dynRupTree.allocateVariables();
-  m_dynRupTree.touchVariables();
+  m_dynRupTree.touchVariables(&seissolInstance.getNumaPlacement());
 
 #ifdef ACL_DEVICE
   MemoryManager::deriveRequiredScratchpadMemoryForDr(m_dynRupTree, *m_dynRup.get());
@@ -585,7 +606,7 @@ void seissol::initializer::MemoryManager::fixateBoundaryLtsTree() {
     boundaryLayer.setNumberOfCells(numberOfBoundaryFaces);
   }
   m_boundaryTree.allocateVariables();
-  m_boundaryTree.touchVariables();
+  m_boundaryTree.touchVariables(&seissolInstance.getNumaPlacement());
 
   // The boundary tree is now allocated, now we only need to map from cell lts
   // to face lts.
@@ -831,7 +852,8 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
   for (auto& layer : m_ltsTree.leaves()) {
     real** buffers = layer.var(m_lts.buffers);
     real** derivatives = layer.var(m_lts.derivatives);
-    kernels::touchBuffersDerivatives(buffers, derivatives, layer.getNumberOfCells());
+    kernels::touchBuffersDerivatives(
+        buffers, derivatives, layer.getNumberOfCells(), &seissolInstance.getNumaPlacement());
   }
 
 #ifdef USE_MPI
@@ -845,6 +867,11 @@ void seissol::initializer::MemoryManager::initializeMemoryLayout()
   seissol::initializer::MemoryManager::deriveRequiredScratchpadMemoryForWp(m_ltsTree, m_lts);
   m_ltsTree.allocateScratchPads();
 #endif
+
+  if (seissol::memory::useHugePages()) {
+    printHugePageStatistics("LTS tree", m_ltsTree.getHugePageStatistics());
+    printHugePageStatistics("DR tree", m_dynRupTree.getHugePageStatistics());
+  }
 }
 
 std::pair<MeshStructure *, CompoundGlobalData>
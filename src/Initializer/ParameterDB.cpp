@@ -70,6 +70,7 @@
 
 #include "generated_code/kernel.h"
 #endif
+#include "EasiQueryCache.h"
 #include "ParameterDB.h"
 #include <algorithm>
 #include <cmath>
@@ -282,83 +283,149 @@ easi::Query FaultGPGenerator::generate() const {
 using namespace seissol::model;
 
 template <>
-void MaterialParameterDB<ElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<ElasticMaterial>& adapter) {
-  adapter.addBindingPoint("rho", &ElasticMaterial::rho);
-  adapter.addBindingPoint("mu", &ElasticMaterial::mu);
-  adapter.addBindingPoint("lambda", &ElasticMaterial::lambda);
+MaterialParameterDB<ElasticMaterial>::ParameterBindings
+    MaterialParameterDB<ElasticMaterial>::parameterBindings() {
+  return {
+      {"rho", &ElasticMaterial::rho},
+      {"mu", &ElasticMaterial::mu},
+      {"lambda", &ElasticMaterial::lambda},
+  };
 }
 
 template <>
-void MaterialParameterDB<ViscoElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<ViscoElasticMaterial>& adapter) {
-  adapter.addBindingPoint("rho", &ViscoElasticMaterial::rho);
-  adapter.addBindingPoint("mu", &ViscoElasticMaterial::mu);
-  adapter.addBindingPoint("lambda", &ViscoElasticMaterial::lambda);
-  adapter.addBindingPoint("Qp", &ViscoElasticMaterial::Qp);
-  adapter.addBindingPoint("Qs", &ViscoElasticMaterial::Qs);
+MaterialParameterDB<ViscoElasticMaterial>::ParameterBindings
+    MaterialParameterDB<ViscoElasticMaterial>::parameterBindings() {
+  return {
+      {"rho", &ViscoElasticMaterial::rho},
+      {"mu", &ViscoElasticMaterial::mu},
+      {"lambda", &ViscoElasticMaterial::lambda},
+      {"Qp", &ViscoElasticMaterial::Qp},
+      {"Qs", &ViscoElasticMaterial::Qs},
+  };
 }
 
 template <>
-void MaterialParameterDB<PoroElasticMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<PoroElasticMaterial>& adapter) {
-  adapter.addBindingPoint("bulk_solid", &PoroElasticMaterial::bulkSolid);
-  adapter.addBindingPoint("rho", &PoroElasticMaterial::rho);
-  adapter.addBindingPoint("lambda", &PoroElasticMaterial::lambda);
-  adapter.addBindingPoint("mu", &PoroElasticMaterial::mu);
-  adapter.addBindingPoint("porosity", &PoroElasticMaterial::porosity);
-  adapter.addBindingPoint("permeability", &PoroElasticMaterial::permeability);
-  adapter.addBindingPoint("tortuosity", &PoroElasticMaterial::tortuosity);
-  adapter.addBindingPoint("bulk_fluid", &PoroElasticMaterial::bulkFluid);
-  adapter.addBindingPoint("rho_fluid", &PoroElasticMaterial::rhoFluid);
-  adapter.addBindingPoint("viscosity", &PoroElasticMaterial::viscosity);
+MaterialParameterDB<PoroElasticMaterial>::ParameterBindings
+    MaterialParameterDB<PoroElasticMaterial>::parameterBindings() {
+  return {
+      {"bulk_solid", &PoroElasticMaterial::bulkSolid},
+      {"rho", &PoroElasticMaterial::rho},
+      {"lambda", &PoroElasticMaterial::lambda},
+      {"mu", &PoroElasticMaterial::mu},
+      {"porosity", &PoroElasticMaterial::porosity},
+      {"permeability", &PoroElasticMaterial::permeability},
+      {"tortuosity", &PoroElasticMaterial::tortuosity},
+      {"bulk_fluid", &PoroElasticMaterial::bulkFluid},
+      {"rho_fluid", &PoroElasticMaterial::rhoFluid},
+      {"viscosity", &PoroElasticMaterial::viscosity},
+  };
 }
 
 template <>
-void MaterialParameterDB<Plasticity>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<Plasticity>& adapter) {
-  adapter.addBindingPoint("bulkFriction", &Plasticity::bulkFriction);
-  adapter.addBindingPoint("plastCo", &Plasticity::plastCo);
-  adapter.addBindingPoint("s_xx", &Plasticity::sXX);
-  adapter.addBindingPoint("s_yy", &Plasticity::sYY);
-  adapter.addBindingPoint("s_zz", &Plasticity::sZZ);
-  adapter.addBindingPoint("s_xy", &Plasticity::sXY);
-  adapter.addBindingPoint("s_yz", &Plasticity::sYZ);
-  adapter.addBindingPoint("s_xz", &Plasticity::sXZ);
+MaterialParameterDB<Plasticity>::ParameterBindings
+    MaterialParameterDB<Plasticity>::parameterBindings() {
+  return {
+      {"bulkFriction", &Plasticity::bulkFriction},
+      {"plastCo", &Plasticity::plastCo},
+      {"s_xx", &Plasticity::sXX},
+      {"s_yy", &Plasticity::sYY},
+      {"s_zz", &Plasticity::sZZ},
+      {"s_xy", &Plasticity::sXY},
+      {"s_yz", &Plasticity::sYZ},
+      {"s_xz", &Plasticity::sXZ},
+  };
 }
 
 template <>
-void MaterialParameterDB<AnisotropicMaterial>::addBindingPoints(
-    easi::ArrayOfStructsAdapter<AnisotropicMaterial>& adapter) {
-  adapter.addBindingPoint("rho", &AnisotropicMaterial::rho);
-  adapter.addBindingPoint("c11", &AnisotropicMaterial::c11);
-  adapter.addBindingPoint("c12", &AnisotropicMaterial::c12);
-  adapter.addBindingPoint("c13", &AnisotropicMaterial::c13);
-  adapter.addBindingPoint("c14", &AnisotropicMaterial::c14);
-  adapter.addBindingPoint("c15", &AnisotropicMaterial::c15);
-  adapter.addBindingPoint("c16", &AnisotropicMaterial::c16);
-  adapter.addBindingPoint("c22", &AnisotropicMaterial::c22);
-  adapter.addBindingPoint("c23", &AnisotropicMaterial::c23);
-  adapter.addBindingPoint("c24", &AnisotropicMaterial::c24);
-  adapter.addBindingPoint("c25", &AnisotropicMaterial::c25);
-  adapter.addBindingPoint("c26", &AnisotropicMaterial::c26);
-  adapter.addBindingPoint("c33", &AnisotropicMaterial::c33);
-  adapter.addBindingPoint("c34", &AnisotropicMaterial::c34);
-  adapter.addBindingPoint("c35", &AnisotropicMaterial::c35);
-  adapter.addBindingPoint("c36", &AnisotropicMaterial::c36);
-  adapter.addBindingPoint("c44", &AnisotropicMaterial::c44);
-  adapter.addBindingPoint("c45", &AnisotropicMaterial::c45);
-  adapter.addBindingPoint("c46", &AnisotropicMaterial::c46);
-  adapter.addBindingPoint("c55", &AnisotropicMaterial::c55);
-  adapter.addBindingPoint("c56", &AnisotropicMaterial::c56);
-  adapter.addBindingPoint("c66", &AnisotropicMaterial::c66);
+MaterialParameterDB<AnisotropicMaterial>::ParameterBindings
+    MaterialParameterDB<AnisotropicMaterial>::parameterBindings() {
+  return {
+      {"rho", &AnisotropicMaterial::rho},
+      {"c11", &AnisotropicMaterial::c11},
+      {"c12", &AnisotropicMaterial::c12},
+      {"c13", &AnisotropicMaterial::c13},
+      {"c14", &AnisotropicMaterial::c14},
+      {"c15", &AnisotropicMaterial::c15},
+      {"c16", &AnisotropicMaterial::c16},
+      {"c22", &AnisotropicMaterial::c22},
+      {"c23", &AnisotropicMaterial::c23},
+      {"c24", &AnisotropicMaterial::c24},
+      {"c25", &AnisotropicMaterial::c25},
+      {"c26", &AnisotropicMaterial::c26},
+      {"c33", &AnisotropicMaterial::c33},
+      {"c34", &AnisotropicMaterial::c34},
+      {"c35", &AnisotropicMaterial::c35},
+      {"c36", &AnisotropicMaterial::c36},
+      {"c44", &AnisotropicMaterial::c44},
+      {"c45", &AnisotropicMaterial::c45},
+      {"c46", &AnisotropicMaterial::c46},
+      {"c55", &AnisotropicMaterial::c55},
+      {"c56", &AnisotropicMaterial::c56},
+      {"c66", &AnisotropicMaterial::c66},
+  };
+}
+
+template <class T>
+void MaterialParameterDB<T>::addBindingPoints(easi::ArrayOfStructsAdapter<T>& adapter) {
+  for (const auto& [name, member] : parameterBindings()) {
+    adapter.addBindingPoint(name, member);
+  }
 }
 
 template <class T>
 void MaterialParameterDB<T>::evaluateModel(const std::string& fileName,
                                            const QueryGenerator* const queryGen) {
-  easi::Component* model = loadEasiModel(fileName);
   easi::Query query = queryGen->generate();
+  const bool averaged = dynamic_cast<const ElementAverageGenerator*>(queryGen) != nullptr;
+  const std::size_t numCells = averaged ? query.numPoints() / NumQuadpoints : query.numPoints();
+
+  const EasiQueryCache cache;
+  if (!cache.enabled()) {
+    evaluateQuery(fileName, query, queryGen);
+    return;
+  }
+
+  // the cache entry holds the bound parameters of all cells, cell by cell
+  const auto bindings = parameterBindings();
+  std::vector<std::string> parameters{T::Text, averaged ? "averaged" : "sampled"};
+  for (const auto& binding : bindings) {
+    parameters.push_back(binding.first);
+  }
+  const auto key = EasiQueryCache::key(fileName, query, parameters);
+  const auto numValues = numCells * bindings.size();
+
+  const bool loaded = cache.load(key, numValues, [&](const double* values) {
+#pragma omp parallel for schedule(static)
+    for (std::size_t cell = 0; cell < numCells; ++cell) {
+      T material{};
+      for (std::size_t i = 0; i < bindings.size(); ++i) {
+        material.*(bindings[i].second) = values[cell * bindings.size() + i];
+      }
+      m_materials->at(cell) = material;
+    }
+  });
+  if (loaded) {
+    logInfo(MPI::mpi.rank()) << "Loaded the" << T::Text << "parameters from the easi cache.";
+    return;
+  }
+
+  evaluateQuery(fileName, query, queryGen);
+
+  std::vector<double> values(numValues);
+#pragma omp parallel for schedule(static)
+  for (std::size_t cell = 0; cell < numCells; ++cell) {
+    for (std::size_t i = 0; i < bindings.size(); ++i) {
+      values[cell * bindings.size() + i] = m_materials->at(cell).*(bindings[i].second);
+    }
+  }
+  cache.store(key, values);
+}
+
+template <class T>
+void MaterialParameterDB<T>::evaluateQuery(const std::string& fileName,
+                                           easi::Query& query,
+                                           const QueryGenerator* const queryGen) {
+  easi::Component* model = loadEasiModel(fileName);
   const unsigned numPoints = query.numPoints();
 
   std::vector<T> materialsFromQuery(numPoints);
@@ -499,10 +566,10 @@ ViscoElasticMaterial MaterialParameterDB<ViscoElasticMaterial>::computeAveragedM
 }
 
 template <>
-void MaterialParameterDB<AnisotropicMaterial>::evaluateModel(const std::string& fileName,
+void MaterialParameterDB<AnisotropicMaterial>::evaluateQuery(const std::string& fileName,
+                                                             easi::Query& query,
                                                              const QueryGenerator* const queryGen) {
   easi::Component* model = loadEasiModel(fileName);
-  easi::Query query = queryGen->generate();
   auto suppliedParameters = model->suppliedParameters();
   // TODO(Sebastian): inhomogeneous materials, where in some parts only mu and lambda are given
   //                  and in other parts the full elastic tensor is given
@@ -530,16 +597,55 @@ void MaterialParameterDB<AnisotropicMaterial>::evaluateModel(const std::string&
 
 void FaultParameterDB::evaluateModel(const std::string& fileName,
                                      const QueryGenerator* const queryGen) {
-  easi::Component* model = loadEasiModel(fileName);
   easi::Query query = queryGen->generate();
+  const std::size_t numPoints = query.numPoints();
+
+  // the cache entry holds the parameters in alphabetical order, each for all points
+  const EasiQueryCache cache;
+  std::vector<std::string> parameters;
+  std::uint64_t key = 0;
+  if (cache.enabled()) {
+    for (const auto& kv : m_parameters) {
+      parameters.push_back(kv.first);
+    }
+    std::sort(parameters.begin(), parameters.end());
+    parameters.insert(parameters.begin(), "fault");
+    key = EasiQueryCache::key(fileName, query, parameters);
+    parameters.erase(parameters.begin());
+
+    const bool loaded =
+        cache.load(key, numPoints * parameters.size(), [&](const double* values) {
+          for (std::size_t i = 0; i < parameters.size(); ++i) {
+            const auto& [memory, stride] = m_parameters.at(parameters[i]);
+            for (std::size_t point = 0; point < numPoints; ++point) {
+              memory[point * stride] = static_cast<real>(values[i * numPoints + point]);
+            }
+          }
+        });
+    if (loaded) {
+      logInfo(MPI::mpi.rank()) << "Loaded the fault parameters from the easi cache.";
+      return;
+    }
+  }
 
+  easi::Component* model = loadEasiModel(fileName);
   easi::ArraysAdapter<real> adapter;
   for (auto& kv : m_parameters) {
     adapter.addBindingPoint(kv.first, kv.second.first, kv.second.second);
   }
   model->evaluate(query, adapter);
-
   delete model;
+
+  if (cache.enabled()) {
+    std::vector<double> values(numPoints * parameters.size());
+    for (std::size_t i = 0; i < parameters.size(); ++i) {
+      const auto& [memory, stride] = m_parameters.at(parameters[i]);
+      for (std::size_t point = 0; point < numPoints; ++point) {
+        values[i * numPoints + point] = memory[point * stride];
+      }
+    }
+    cache.store(key, values);
+  }
 }
 
 std::set<std::string> FaultParameterDB::faultProvides(const std::string& fileName) {
@@ -48,6 +48,8 @@
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "Geometry/MeshReader.h"
 #include "Initializer/Typedefs.h"
@@ -168,14 +170,23 @@ class ParameterDB {
 template <class T>
 class MaterialParameterDB : ParameterDB {
   public:
+  using ParameterBindings = std::vector<std::pair<std::string, double T::*>>;
+
   T computeAveragedMaterial(unsigned elementIdx,
                             const std::array<double, NumQuadpoints>& quadratureWeights,
                             const std::vector<T>& materialsFromQuery);
+  // evaluates the model, or loads the materials from the easi query cache (cf. EasiQueryCache)
   void evaluateModel(const std::string& fileName, const QueryGenerator* queryGen) override;
   void setMaterialVector(std::vector<T>* materials) { m_materials = materials; }
-  void addBindingPoints(easi::ArrayOfStructsAdapter<T>& adapter) {};
+  void addBindingPoints(easi::ArrayOfStructsAdapter<T>& adapter);
+  // the material parameters read from easi, i.e. all parameters which are stored in the cache
+  static ParameterBindings parameterBindings();
 
   private:
+  void evaluateQuery(const std::string& fileName,
+                     easi::Query& query,
+                     const QueryGenerator* queryGen);
+
   std::vector<T>* m_materials{};
 };
 
@@ -185,6 +196,7 @@ class FaultParameterDB : ParameterDB {
   void addParameter(const std::string& parameter, real* memory, unsigned stride = 1) {
     m_parameters[parameter] = std::make_pair(memory, stride);
   }
+  // evaluates the model, or loads the parameters from the easi query cache (cf. EasiQueryCache)
   void evaluateModel(const std::string& fileName, const QueryGenerator* queryGen) override;
   static std::set<std::string> faultProvides(const std::string& fileName);
 
@@ -143,6 +143,11 @@ TimeSteppingParameters readTimeSteppingParameters(ParameterReader* baseReader) {
   const auto weightDynamicRupture = reader->readWithDefault("vertexweightdynamicrupture", 100);
   const auto weightFreeSurfaceWithGravity =
       reader->readWithDefault("vertexweightfreesurfacewithgravity", 100);
+  const auto costModelFile = reader->readWithDefault("ltscostmodelfile", std::string(""));
+  const auto calibrateCostModel = reader->readWithDefault("ltscalibratecostmodel", false);
+  if (calibrateCostModel && costModelFile.empty()) {
+    logError() << "LtsCalibrateCostModel requires a file name in LtsCostModelFile.";
+  }
   const double cfl = reader->readWithDefault("cfl", 0.5);
   double maxTimestepWidth = std::numeric_limits<double>::max();
 
@@ -184,7 +189,11 @@ TimeSteppingParameters readTimeSteppingParameters(ParameterReader* baseReader) {
                           "material",
                           "npolymap"});
 
-  return TimeSteppingParameters({weightElement, weightDynamicRupture, weightFreeSurfaceWithGravity},
+  return TimeSteppingParameters({weightElement,
+                                 weightDynamicRupture,
+                                 weightFreeSurfaceWithGravity,
+                                 costModelFile,
+                                 calibrateCostModel},
                                 cfl,
                                 maxTimestepWidth,
                                 endTime,
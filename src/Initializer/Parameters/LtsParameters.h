@@ -3,6 +3,8 @@
 
 #include "ParameterReader.h"
 
+#include <string>
+
 namespace seissol::initializer::parameters {
 
 enum class LtsWeightsTypes : int {
@@ -16,6 +18,10 @@ struct VertexWeightParameters {
   int weightElement;
   int weightDynamicRupture;
   int weightFreeSurfaceWithGravity;
+  // measured costs which replace the weights above, if the file exists (cf. CostModel.h)
+  std::string costModelFile{};
+  // write the measured costs to costModelFile at the end of the simulation
+  bool calibrateCostModel{false};
 };
 
 enum class AutoMergeCostBaseline {
@@ -41,6 +41,16 @@ MeshParameters readMeshParameters(ParameterReader* baseReader) {
 
   const bool showEdgeCutStatistics = reader->readWithDefault("showedgecutstatistics", false);
 
+  const auto cellOrdering =
+      reader->readWithDefaultStringEnum<CellOrdering>("cellordering",
+                                                      "none",
+                                                      {{"none", CellOrdering::None},
+                                                       {"morton", CellOrdering::Morton},
+                                                       {"hilbert", CellOrdering::Hilbert}});
+
+  const std::string preparedMeshFile =
+      reader->readWithDefault("preparedmeshfile", std::string(""));
+
   reader->warnDeprecated({"periodic", "periodic_direction"});
 
   return MeshParameters{showEdgeCutStatistics,
@@ -49,6 +59,8 @@ MeshParameters readMeshParameters(ParameterReader* baseReader) {
                         meshFileName,
                         partitioningLib,
                         displacement,
-                        scaling};
+                        scaling,
+                        cellOrdering,
+                        preparedMeshFile};
 }
 } // namespace seissol::initializer::parameters
@@ -13,6 +13,8 @@ enum class MeshFormat : int { Netcdf, PUML, CubeGenerator };
 
 enum class BoundaryFormat : int { Auto, I32, I64, I32x4 };
 
+enum class CellOrdering : int { None, Morton, Hilbert };
+
 struct MeshParameters {
   bool showEdgeCutStatistics;
   BoundaryFormat pumlBoundaryFormat;
@@ -21,6 +23,9 @@ struct MeshParameters {
   std::string partitioningLib;
   Eigen::Vector3d displacement;
   Eigen::Matrix3d scaling;
+  CellOrdering cellOrdering;
+  // partitioned mesh of a previous run with the same setup; written if it does not match
+  std::string preparedMeshFile;
 };
 
 MeshParameters readMeshParameters(ParameterReader* baseReader);
@@ -4,8 +4,10 @@
 #include <Initializer/Parameters/ParameterReader.h>
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <limits>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utils/logger.h>
 #include <vector>
@@ -34,16 +36,40 @@ CheckpointParameters readCheckpointParameters(ParameterReader* baseReader) {
 
   auto enabled = reader->readWithDefault("checkpoint", true);
   double interval = 0.0;
+  int compression = 0;
+  bool lossy = false;
+  bool incremental = false;
+  std::string localDirectory;
+  double rebalanceImbalance = 0.0;
   if (enabled) {
     interval = reader->readWithDefault("checkpointinterval", 0.0);
     warnIntervalAndDisable(enabled, interval, "checkpoint", "checkpointinterval");
+    compression = reader->readWithDefault("checkpointcompression", 0);
+    if (compression < 0 || compression > 9) {
+      logError() << "The checkpoint compression level needs to be between 0 and 9, but is"
+                 << compression;
+    }
+    lossy = reader->readWithDefault("checkpointlossy", false);
+    incremental = reader->readWithDefault("checkpointincremental", false);
+    localDirectory = reader->readWithDefault("checkpointlocaldirectory", std::string(""));
+    rebalanceImbalance = reader->readWithDefault("checkpointrebalanceimbalance", 0.0);
+    if (rebalanceImbalance < 0.0 || rebalanceImbalance >= 1.0) {
+      logError() << "The load imbalance for rebalancing needs to be in [0, 1), but is"
+                 << rebalanceImbalance;
+    }
   } else {
-    reader->markUnused({"checkpointinterval"});
+    reader->markUnused({"checkpointinterval",
+                        "checkpointcompression",
+                        "checkpointlossy",
+                        "checkpointincremental",
+                        "checkpointlocaldirectory",
+                        "checkpointrebalanceimbalance"});
   }
 
   reader->warnDeprecated({"checkpointbackend", "checkpointfile"});
 
-  return CheckpointParameters{enabled, interval};
+  return CheckpointParameters{
+      enabled, interval, compression, lossy, incremental, localDirectory, rebalanceImbalance};
 }
 
 ElementwiseFaultParameters readElementwiseParameters(ParameterReader* baseReader) {
@@ -141,8 +167,69 @@ ReceiverOutputParameters readReceiverParameters(ParameterReader* baseReader) {
 
   const auto collectiveio = reader->readWithDefault("receivercollectiveio", false);
 
-  return ReceiverOutputParameters{
-      enabled, computeRotation, computeStrain, interval, samplingInterval, fileName, collectiveio};
+  const auto format = reader->readWithDefaultStringEnum<ReceiverOutputFormat>(
+      "receiveroutputformat",
+      "text",
+      {
+          {"text", ReceiverOutputFormat::Text},
+          {"binary", ReceiverOutputFormat::Binary},
+          {"hdf5", ReceiverOutputFormat::Hdf5},
+      });
+
+  return ReceiverOutputParameters{enabled,
+                                  computeRotation,
+                                  computeStrain,
+                                  interval,
+                                  samplingInterval,
+                                  fileName,
+                                  collectiveio,
+                                  format};
+}
+
+OutputBounds readOutputBounds(ParameterReader* reader) {
+  const auto boundsString =
+      reader->readWithDefault("outputregionbounds", std::string("0.0 0.0 0.0 0.0 0.0 0.0"));
+  const auto boundsRaw = convertStringToArray<double, 6>(boundsString);
+  const auto boundsEnabled =
+      std::none_of(boundsRaw.begin(), boundsRaw.end(), [](double d) { return d == 0; });
+  const OutputInterval intervalX = {boundsRaw[0], boundsRaw[1]};
+  const OutputInterval intervalY = {boundsRaw[2], boundsRaw[3]};
+  const OutputInterval intervalZ = {boundsRaw[4], boundsRaw[5]};
+  return OutputBounds(boundsEnabled, intervalX, intervalY, intervalZ);
+}
+
+// reads either one encoding for all N entries, or one encoding per entry
+template <std::size_t N>
+std::array<OutputEncoding, N> readOutputEncodings(ParameterReader* reader,
+                                                  const std::string& field,
+                                                  const std::array<OutputEncoding, N>& defaults) {
+  const std::unordered_map<std::string, OutputEncoding> validValues = {
+      {"native", OutputEncoding::Native},
+      {"float32", OutputEncoding::Float32},
+      {"float16", OutputEncoding::Float16},
+      {"int16", OutputEncoding::Int16}};
+
+  const auto encodingString = reader->read<std::string>(field);
+  if (!encodingString.has_value()) {
+    return defaults;
+  }
+  auto words = convertStringToArray<std::string, N>(encodingString.value(), false);
+  const auto given = static_cast<std::size_t>(
+      std::find(words.begin(), words.end(), std::string()) - words.begin());
+  if (given != 1 && given != N) {
+    logError() << "The field" << field << "needs either one or" << N << "values, but has" << given;
+  }
+
+  std::array<OutputEncoding, N> encodings{};
+  for (std::size_t i = 0; i < N; ++i) {
+    auto& word = words[given == 1 ? 0 : i];
+    sanitize(word);
+    if (validValues.find(word) == validValues.end()) {
+      logError() << "The field" << field << "had an invalid value:" << word;
+    }
+    encodings[i] = validValues.at(word);
+  }
+  return encodings;
 }
 
 WaveFieldOutputParameters readWaveFieldParameters(ParameterReader* baseReader) {
@@ -159,15 +246,7 @@ WaveFieldOutputParameters readWaveFieldParameters(ParameterReader* baseReader) {
                                                      VolumeRefinement::Refine8,
                                                      VolumeRefinement::Refine32});
 
-  const auto boundsString =
-      reader->readWithDefault("outputregionbounds", std::string("0.0 0.0 0.0 0.0 0.0 0.0"));
-  const auto boundsRaw = convertStringToArray<double, 6>(boundsString);
-  const auto boundsEnabled =
-      std::none_of(boundsRaw.begin(), boundsRaw.end(), [](double d) { return d == 0; });
-  const OutputInterval intervalX = {boundsRaw[0], boundsRaw[1]};
-  const OutputInterval intervalY = {boundsRaw[2], boundsRaw[3]};
-  const OutputInterval intervalZ = {boundsRaw[4], boundsRaw[5]};
-  const OutputBounds bounds(boundsEnabled, intervalX, intervalY, intervalZ);
+  const auto bounds = readOutputBounds(reader);
 
   const auto format = reader->readWithDefaultEnum<OutputFormat>(
       "format", OutputFormat::None, {OutputFormat::None, OutputFormat::Xdmf});
@@ -201,6 +280,17 @@ WaveFieldOutputParameters readWaveFieldParameters(ParameterReader* baseReader) {
 
   const auto vtkorder = reader->readWithDefault("wavefieldvtkorder", -1);
 
+  // (defaults to native)
+  const auto outputEncoding = readOutputEncodings<seissol::model::MaterialT::NumQuantities>(
+      reader, "wavefieldvtkencoding", {});
+  const auto plasticityEncoding =
+      readOutputEncodings<7>(reader, "wavefieldvtkplasticityencoding", {});
+  const auto vtkCompression = reader->readWithDefault("wavefieldvtkcompression", 0);
+  if (vtkCompression < 0 || vtkCompression > 9) {
+    logError() << "The wave field compression level needs to be between 0 and 9, but is"
+               << vtkCompression;
+  }
+
   return WaveFieldOutputParameters{enabled,
                                    vtkorder,
                                    interval,
@@ -209,7 +299,66 @@ WaveFieldOutputParameters readWaveFieldParameters(ParameterReader* baseReader) {
                                    outputMask,
                                    plasticityMask,
                                    integrationMask,
-                                   groups};
+                                   groups,
+                                   outputEncoding,
+                                   plasticityEncoding,
+                                   vtkCompression};
+}
+
+std::vector<WaveFieldOutputParameters>
+    readWaveFieldRegions(ParameterReader* baseReader, const WaveFieldOutputParameters& defaults) {
+  // the regions are given as the sections WaveFieldRegion1, WaveFieldRegion2, ...; the quantities
+  // and their encoding default to the ones of the wave field output, the cells to all cells
+  std::vector<WaveFieldOutputParameters> regions;
+  std::unordered_set<std::string> names;
+  for (std::size_t index = 1; baseReader->hasField("wavefieldregion" + std::to_string(index));
+       ++index) {
+    auto* reader = baseReader->readSubNode("wavefieldregion" + std::to_string(index));
+
+    auto region = defaults;
+    region.enabled = true;
+    region.name = reader->readWithDefault("name", "region" + std::to_string(index));
+    region.interval = reader->readWithDefault("timeinterval", defaults.interval);
+    region.vtkorder = reader->readWithDefault("vtkorder", defaults.vtkorder);
+    if (region.vtkorder <= 0) {
+      logError() << "The wave field region" << region.name
+                 << "needs a positive vtkorder, but has" << region.vtkorder;
+    }
+    if (region.interval <= 0) {
+      logError() << "The wave field region" << region.name
+                 << "needs a positive time interval, but has" << region.interval;
+    }
+    if (!names.insert(region.name).second) {
+      logError() << "There is more than one wave field region named" << region.name;
+    }
+
+    region.bounds = readOutputBounds(reader);
+    const auto groupsRaw = reader->readWithDefault("outputgroups", std::vector<int>());
+    region.groups = std::unordered_set<int>(groupsRaw.begin(), groupsRaw.end());
+
+    const auto outputMaskString = reader->read<std::string>("ioutputmask");
+    if (outputMaskString.has_value()) {
+      region.outputMask = convertStringToArray<bool, seissol::model::MaterialT::NumQuantities>(
+          outputMaskString.value(), false);
+    }
+    const auto plasticityMaskString = reader->read<std::string>("iplasticitymask");
+    if (plasticityMaskString.has_value()) {
+      region.plasticityMask = convertStringToArray<bool, 7>(plasticityMaskString.value(), false);
+    }
+
+    region.outputEncoding = readOutputEncodings<seissol::model::MaterialT::NumQuantities>(
+        reader, "vtkencoding", defaults.outputEncoding);
+    region.plasticityEncoding =
+        readOutputEncodings<7>(reader, "vtkplasticityencoding", defaults.plasticityEncoding);
+    region.vtkCompression = reader->readWithDefault("vtkcompression", defaults.vtkCompression);
+    if (region.vtkCompression < 0 || region.vtkCompression > 9) {
+      logError() << "The compression level of the wave field region" << region.name
+                 << "needs to be between 0 and 9, but is" << region.vtkCompression;
+    }
+
+    regions.push_back(region);
+  }
+  return regions;
 }
 
 OutputParameters readOutputParameters(ParameterReader* baseReader) {
@@ -238,6 +387,7 @@ OutputParameters readOutputParameters(ParameterReader* baseReader) {
   const auto pickpointParameters = readPickpointParameters(baseReader);
   const auto receiverParameters = readReceiverParameters(baseReader);
   const auto waveFieldParameters = readWaveFieldParameters(baseReader);
+  const auto waveFieldRegions = readWaveFieldRegions(baseReader, waveFieldParameters);
 
   reader->warnDeprecated({"rotation",
                           "interval",
@@ -257,6 +407,7 @@ OutputParameters readOutputParameters(ParameterReader* baseReader) {
                           freeSurfaceParameters,
                           pickpointParameters,
                           receiverParameters,
-                          waveFieldParameters);
+                          waveFieldParameters,
+                          waveFieldRegions);
 }
 } // namespace seissol::initializer::parameters
@@ -4,6 +4,7 @@
 #include <list>
 #include <string>
 #include <unordered_set>
+#include <vector>
 
 #include <xdmfwriter/backends/Backend.h>
 
@@ -21,9 +22,21 @@ enum class OutputFormat : int { None = 10, Xdmf = 6 };
 
 enum class VolumeRefinement : int { NoRefine = 0, Refine4 = 1, Refine8 = 2, Refine32 = 3 };
 
+enum class ReceiverOutputFormat : int { Text, Binary, Hdf5 };
+
+// storage of the wave field (VTK-HDF) output; Int16 stores scaled 16-bit integers
+enum class OutputEncoding { Native, Float32, Float16, Int16 };
+
 struct CheckpointParameters {
   bool enabled;
   double interval;
+  int compression{0};
+  bool lossy{false};
+  bool incremental{false};
+  std::string localDirectory;
+  // stop at a checkpoint whose load imbalance exceeds this ratio, to restart with a rebalanced
+  // partition from it (0: never)
+  double rebalanceImbalance{0.0};
 };
 
 struct ElementwiseFaultParameters {
@@ -67,6 +80,7 @@ struct ReceiverOutputParameters {
   double samplingInterval;
   std::string fileName;
   bool collectiveio{false};
+  ReceiverOutputFormat format{ReceiverOutputFormat::Text};
 };
 
 struct OutputInterval {
@@ -106,6 +120,11 @@ struct WaveFieldOutputParameters {
   std::array<bool, 7> plasticityMask;
   std::array<bool, 9> integrationMask;
   std::unordered_set<int> groups;
+  std::array<OutputEncoding, seissol::model::MaterialT::NumQuantities> outputEncoding;
+  std::array<OutputEncoding, 7> plasticityEncoding;
+  int vtkCompression{0};
+  // only set for the additional output regions
+  std::string name;
 };
 
 struct OutputParameters {
@@ -120,6 +139,8 @@ struct OutputParameters {
   PickpointParameters pickpointParameters;
   ReceiverOutputParameters receiverParameters;
   WaveFieldOutputParameters waveFieldParameters;
+  // additional (high-order) wave field outputs, each with its own region, interval, and order
+  std::vector<WaveFieldOutputParameters> waveFieldRegions;
 
   OutputParameters() = default;
   OutputParameters(bool loopStatisticsNetcdfOutput,
@@ -132,13 +153,14 @@ struct OutputParameters {
                    const FreeSurfaceOutputParameters& freeSurfaceParameters,
                    const PickpointParameters& pickpointParameters,
                    const ReceiverOutputParameters& receiverParameters,
-                   const WaveFieldOutputParameters& waveFieldParameters)
+                   const WaveFieldOutputParameters& waveFieldParameters,
+                   const std::vector<WaveFieldOutputParameters>& waveFieldRegions)
       : loopStatisticsNetcdfOutput(loopStatisticsNetcdfOutput), format(format),
         xdmfWriterBackend(xdmfWriterBackend), prefix(prefix),
         checkpointParameters(checkpointParameters), elementwiseParameters(elementwiseParameters),
         energyParameters(energyParameters), freeSurfaceParameters(freeSurfaceParameters),
         pickpointParameters(pickpointParameters), receiverParameters(receiverParameters),
-        waveFieldParameters(waveFieldParameters) {}
+        waveFieldParameters(waveFieldParameters), waveFieldRegions(waveFieldRegions) {}
 };
 
 void warnIntervalAndDisable(bool& enabled,
@@ -152,6 +174,8 @@ FreeSurfaceOutputParameters readFreeSurfaceParameters(ParameterReader* baseReade
 PickpointParameters readPickpointParameters(ParameterReader* baseReader);
 ReceiverOutputParameters readReceiverParameters(ParameterReader* baseReader);
 WaveFieldOutputParameters readWaveFieldParameters(ParameterReader* baseReader);
+std::vector<WaveFieldOutputParameters>
+    readWaveFieldRegions(ParameterReader* baseReader, const WaveFieldOutputParameters& defaults);
 OutputParameters readOutputParameters(ParameterReader* baseReader);
 } // namespace seissol::initializer::parameters
 #endif
@@ -72,11 +72,8 @@
 
 #include "PointMapper.h"
 #include "Parallel/MPI.h"
-#include <Geometry/MeshDefinition.h>
 #include <Geometry/MeshReader.h>
-#include <Geometry/MeshTools.h>
-#include <array>
-#include <cstring>
+#include <Geometry/TetrahedronBvh.h>
 #include <mpi.h>
 #include <utils/logger.h>
 #include <vector>
@@ -88,7 +85,7 @@ void findMeshIds(const Eigen::Vector3d* points,
                  std::size_t numPoints,
                  short* contained,
                  unsigned* meshIds) {
-  findMeshIds(points, mesh.getVertices(), mesh.getElements(), numPoints, contained, meshIds);
+  findMeshIds(points, mesh.getBvh(), numPoints, contained, meshIds);
 }
 
 void findMeshIds(const Eigen::Vector3d* points,
@@ -97,69 +94,30 @@ void findMeshIds(const Eigen::Vector3d* points,
                  std::size_t numPoints,
                  short* contained,
                  unsigned* meshIds) {
-
-  memset(contained, 0, numPoints * sizeof(short));
-
-  auto points1 = std::vector<std::array<double, 4>>(numPoints);
-  for (std::size_t point = 0; point < numPoints; ++point) {
-    points1[point][0] = points[point](0);
-    points1[point][1] = points[point](1);
-    points1[point][2] = points[point](2);
-    points1[point][3] = 1.0;
+  if (numPoints == 0) {
+    return;
   }
+  const seissol::geometry::TetrahedronBvh bvh(vertices, elements);
+  findMeshIds(points, bvh, numPoints, contained, meshIds);
+}
 
-/// @TODO Could use the code generator for the following
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-  for (std::size_t elem = 0; elem < elements.size(); ++elem) {
-    auto planeEquations = std::array<std::array<double, 4>, 4>();
-    for (int face = 0; face < 4; ++face) {
-      VrtxCoords n{};
-      VrtxCoords p{};
-      MeshTools::pointOnPlane(elements[elem], face, vertices, p);
-      MeshTools::normal(elements[elem], face, vertices, n);
+void findMeshIds(const Eigen::Vector3d* points,
+                 const seissol::geometry::TetrahedronBvh& bvh,
+                 std::size_t numPoints,
+                 short* contained,
+                 unsigned* meshIds) {
+  const auto& elements = bvh.elements();
 
-      for (int i = 0; i < 3; ++i) {
-        planeEquations[i][face] = n[i];
-      }
-      planeEquations[3][face] = -MeshTools::dot(n, p);
-    }
-    for (std::size_t point = 0; point < numPoints; ++point) {
-      // NOLINTNEXTLINE
-      int notInside = 0;
 #ifdef _OPENMP
-#pragma omp simd reduction(+ : notInside)
+#pragma omp parallel for schedule(dynamic, 64)
 #endif
-      for (unsigned face = 0; face < 4; ++face) {
-        double resultFace = 0;
-        for (unsigned dim = 0; dim < 4; ++dim) {
-          resultFace += planeEquations[dim][face] * points1[point][dim];
-        }
-        notInside += (resultFace > 0.0) ? 1 : 0;
-      }
-      if (notInside == 0) {
-#ifdef _OPENMP
-#pragma omp critical
-        {
-#endif
-          /* It might actually happen that a point is found in two tetrahedrons
-           * if it lies on the boundary. In this case we arbitrarily assign
-           * it to the one with the higher meshId.
-           * @todo Check if this is a problem with the numerical scheme. */
-          /*if (contained[point] != 0) {
-             logError() << "point with id " << point << " was already found in a different
-          element!";
-          }*/
-          const auto localId = static_cast<unsigned>(elements[elem].localId);
-          if ((contained[point] == 0) || (meshIds[point] > localId)) {
-            contained[point] = 1;
-            meshIds[point] = localId;
-          }
-#ifdef _OPENMP
-        }
-#endif
-      }
+  for (std::size_t point = 0; point < numPoints; ++point) {
+    const auto elem = bvh.locate(points[point]);
+    if (elem == seissol::geometry::TetrahedronBvh::NotFound) {
+      contained[point] = 0;
+    } else {
+      contained[point] = 1;
+      meshIds[point] = static_cast<unsigned>(elements[elem].localId);
     }
   }
 }
@@ -169,25 +127,19 @@ void cleanDoubles(short* contained, std::size_t numPoints) {
   const auto myrank = seissol::MPI::mpi.rank();
   const auto size = seissol::MPI::mpi.size();
 
-  auto globalContained = std::vector<short>(size * numPoints);
-  MPI_Allgather(contained,
-                numPoints,
-                MPI_SHORT,
-                globalContained.data(),
-                numPoints,
-                MPI_SHORT,
-                seissol::MPI::mpi.comm());
+  // the point is kept by the lowest rank which contains it
+  auto owner = std::vector<int>(numPoints);
+  for (std::size_t point = 0; point < numPoints; ++point) {
+    owner[point] = contained[point] == 1 ? myrank : size;
+  }
+  MPI_Allreduce(
+      MPI_IN_PLACE, owner.data(), numPoints, MPI_INT, MPI_MIN, seissol::MPI::mpi.comm());
 
   std::size_t cleaned = 0;
   for (std::size_t point = 0; point < numPoints; ++point) {
-    if (contained[point] == 1) {
-      for (int rank = 0; rank < myrank; ++rank) {
-        if (globalContained[rank * numPoints + point] == 1) {
-          contained[point] = 0;
-          ++cleaned;
-          break;
-        }
-      }
+    if (contained[point] == 1 && owner[point] != myrank) {
+      contained[point] = 0;
+      ++cleaned;
     }
   }
 
@@ -42,12 +42,14 @@
 #define INITIALIZER_POINTMAPPER_H_
 
 #include "Geometry/MeshReader.h"
+#include "Geometry/TetrahedronBvh.h"
 #include <Eigen/Dense>
 
 namespace seissol::initializer {
 /** Finds the tetrahedrons that contain the points.
  *  In "contained" we save if the point source is contained in the mesh.
  *  We use short here as bool. For MPI use cleanDoubles afterwards.
+ *  The points are located with the bounding volume hierarchy of the mesh (cf. MeshReader::getBvh).
  */
 void findMeshIds(const Eigen::Vector3d* points,
                  const seissol::geometry::MeshReader& mesh,
@@ -61,6 +63,13 @@ void findMeshIds(const Eigen::Vector3d* points,
                  std::size_t numPoints,
                  short* contained,
                  unsigned* meshIds);
+
+//! locates the points in the elements the hierarchy has been built over
+void findMeshIds(const Eigen::Vector3d* points,
+                 const seissol::geometry::TetrahedronBvh& bvh,
+                 std::size_t numPoints,
+                 short* contained,
+                 unsigned* meshIds);
 #ifdef USE_MPI
 void cleanDoubles(short* contained, std::size_t numPoints);
 #endif
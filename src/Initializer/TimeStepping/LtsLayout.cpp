@@ -47,6 +47,9 @@
 #include "LtsLayout.h"
 #include "MultiRate.h"
 #include "GlobalTimestep.h"
+#include "Geometry/SpaceFillingCurve.h"
+#include "Numerical/Statistics.h"
+#include <cstdlib>
 #include <iterator>
 
 #include "Initializer/ParameterDB.h"
@@ -98,6 +101,19 @@ void seissol::initializer::time_stepping::LtsLayout::setMesh( const seissol::geo
       seissolParams);
   
   m_cellTimeStepWidths = std::move(timesteps.cellTimeStepWidths);
+
+  if (seissolParams.mesh.cellOrdering != seissol::initializer::parameters::CellOrdering::None) {
+    const auto& vertices = i_mesh.getVertices();
+    m_cellBarycenters.resize(m_cells.size());
+    for (unsigned int l_cell = 0; l_cell < m_cells.size(); ++l_cell) {
+      m_cellBarycenters[l_cell] = {0, 0, 0};
+      for (unsigned int l_vertex = 0; l_vertex < 4; ++l_vertex) {
+        for (unsigned int l_dim = 0; l_dim < 3; ++l_dim) {
+          m_cellBarycenters[l_cell][l_dim] += 0.25 * vertices[m_cells[l_cell].vertices[l_vertex]].coords[l_dim];
+        }
+      }
+    }
+  }
 }
 
 FaceType seissol::initializer::time_stepping::LtsLayout::getFaceType(int i_meshFaceType) {
@@ -1204,11 +1220,91 @@ void seissol::initializer::time_stepping::LtsLayout::deriveLayout( TimeClusterin
 
   // derive the region sizes of the ghost layer
   deriveClusteredGhost();
+
+  // derive the memory order of the interior cells
+  deriveInteriorOrdering();
   
   // derive dynamic rupture layers
   deriveDynamicRupturePlainCopyInterior();
 }
 
+void seissol::initializer::time_stepping::LtsLayout::deriveInteriorOrdering() {
+  const int rank = seissol::MPI::mpi.rank();
+
+  m_interiorOrder.clear();
+  m_interiorPosition.clear();
+
+  const auto cellOrdering = seissolParams.mesh.cellOrdering;
+  if( cellOrdering == seissol::initializer::parameters::CellOrdering::None ) return;
+
+  const auto curve = cellOrdering == seissol::initializer::parameters::CellOrdering::Hilbert ?
+                     seissol::geometry::SpaceFillingCurve::Hilbert : seissol::geometry::SpaceFillingCurve::Morton;
+
+  const double l_distanceBefore = getAverageInteriorNeighborDistance( m_interiorPosition );
+
+  m_interiorOrder.resize( m_clusteredInterior.size() );
+  m_interiorPosition.resize( m_clusteredInterior.size() );
+  for( unsigned int l_cluster = 0; l_cluster < m_clusteredInterior.size(); l_cluster++ ) {
+    std::vector< std::array< double, 3 > > l_barycenters( m_clusteredInterior[l_cluster].size() );
+    for( unsigned int l_cell = 0; l_cell < m_clusteredInterior[l_cluster].size(); l_cell++ ) {
+      l_barycenters[l_cell] = m_cellBarycenters[ m_clusteredInterior[l_cluster][l_cell] ];
+    }
+
+    const auto l_order = seissol::geometry::spaceFillingCurveOrder( l_barycenters, curve );
+
+    m_interiorOrder[l_cluster].assign( l_order.begin(), l_order.end() );
+    m_interiorPosition[l_cluster].resize( l_order.size() );
+    for( unsigned int l_position = 0; l_position < l_order.size(); l_position++ ) {
+      m_interiorPosition[l_cluster][ l_order[l_position] ] = l_position;
+    }
+  }
+
+  const double l_distanceAfter = getAverageInteriorNeighborDistance( m_interiorPosition );
+
+  const auto l_summaryBefore = seissol::statistics::parallelSummary( l_distanceBefore );
+  const auto l_summaryAfter = seissol::statistics::parallelSummary( l_distanceAfter );
+  logInfo(rank) << "Ordered the interior cells along the"
+                << (curve == seissol::geometry::SpaceFillingCurve::Hilbert ? "Hilbert" : "Morton") << "curve.";
+  logInfo(rank) << "Average index distance of neighboring interior cells before: mean =" << l_summaryBefore.mean
+                << "min =" << l_summaryBefore.min << "max =" << l_summaryBefore.max;
+  logInfo(rank) << "Average index distance of neighboring interior cells after: mean =" << l_summaryAfter.mean
+                << "min =" << l_summaryAfter.min << "max =" << l_summaryAfter.max;
+}
+
+double seissol::initializer::time_stepping::LtsLayout::getAverageInteriorNeighborDistance( const std::vector< std::vector< unsigned int > > &i_position ) {
+  const int rank = seissol::MPI::mpi.rank();
+
+  double l_totalDistance = 0;
+  unsigned long l_numberOfPairs = 0;
+
+  for( unsigned int l_cluster = 0; l_cluster < m_clusteredInterior.size(); l_cluster++ ) {
+    const auto& l_interior = m_clusteredInterior[l_cluster];
+    for( unsigned int l_cell = 0; l_cell < l_interior.size(); l_cell++ ) {
+      const unsigned int l_meshId = l_interior[l_cell];
+      const long l_position = i_position.empty() ? l_cell : i_position[l_cluster][l_cell];
+
+      for( unsigned int l_face = 0; l_face < 4; l_face++ ) {
+        const FaceType l_faceType = getFaceType( m_cells[l_meshId].boundaries[l_face] );
+        if( m_cells[l_meshId].neighborRanks[l_face] != rank ||
+            ( l_faceType != FaceType::Regular && l_faceType != FaceType::Periodic && l_faceType != FaceType::DynamicRupture ) ) continue;
+
+        // only neighbors in the interior of the same cluster
+        const unsigned int l_neighboringMeshId = m_cells[l_meshId].neighbors[l_face];
+        const auto l_searchResult = std::lower_bound( l_interior.begin(), l_interior.end(), l_neighboringMeshId );
+        if( l_searchResult == l_interior.end() || *l_searchResult != l_neighboringMeshId ) continue;
+
+        const unsigned int l_neighboringCell = l_searchResult - l_interior.begin();
+        const long l_neighboringPosition = i_position.empty() ? l_neighboringCell : i_position[l_cluster][l_neighboringCell];
+
+        l_totalDistance += std::labs( l_position - l_neighboringPosition );
+        l_numberOfPairs++;
+      }
+    }
+  }
+
+  return l_numberOfPairs > 0 ? l_totalDistance / l_numberOfPairs : 0.0;
+}
+
 void seissol::initializer::time_stepping::LtsLayout::getCrossClusterTimeStepping( struct TimeStepping &o_timeStepping ) {
   // set number of global clusters
   o_timeStepping.numberOfGlobalClusters = m_numberOfGlobalClusters;
@@ -1427,7 +1523,8 @@ void seissol::initializer::time_stepping::LtsLayout::getCellInformation( CellLoc
     for( unsigned int l_interiorCell = 0; l_interiorCell <  m_clusteredInterior[l_cluster].size(); l_interiorCell++ ) {
       // get values
       unsigned int l_clusterId  = m_localClusters[l_cluster];
-      unsigned int l_meshId     = m_clusteredInterior[l_cluster][l_interiorCell];
+      unsigned int l_meshId     = m_interiorOrder.empty() ? m_clusteredInterior[l_cluster][l_interiorCell]
+                                                          : m_clusteredInterior[l_cluster][ m_interiorOrder[l_cluster][l_interiorCell] ];
 
       // store face independent information
       io_cellLocalInformation[l_ltsCell].clusterId = l_clusterId;
@@ -161,6 +161,20 @@ class seissol::initializer::time_stepping::LtsLayout {
      **/
     std::vector< std::vector< clusterCell > > m_clusteredInterior;
 
+    /**
+     * memory order of the interior cells (m_clusteredInterior is kept sorted for the searches)
+     * [*][ ]        : cluster
+     * [ ][*]        : position in memory -> index in m_clusteredInterior
+     * empty if the interior cells are stored in the order of m_clusteredInterior.
+     **/
+    std::vector< std::vector< unsigned int > > m_interiorOrder;
+
+    //! inverse of m_interiorOrder: index in m_clusteredInterior -> position in memory
+    std::vector< std::vector< unsigned int > > m_interiorPosition;
+
+    //! barycenters of the cells, used for the cell ordering
+    std::vector< std::array< double, 3 > > m_cellBarycenters;
+
     /**
      * copy region of a time stepping cluster.
      * first[0]: mpi rank of the neighboring cluster
@@ -293,6 +307,20 @@ class seissol::initializer::time_stepping::LtsLayout {
      **/
     void normalizeClustering();
 
+    /**
+     * Orders the interior cells of each cluster along a space-filling curve through their barycenters,
+     * if requested in the parameter file.
+     * The copy regions keep their order, as it needs to match the ghost regions of the neighboring ranks.
+     **/
+    void deriveInteriorOrdering();
+
+    /**
+     * Gets the average distance of the memory positions of face-neighboring interior cells.
+     *
+     * @param i_position position of the interior cells in memory per cluster; identity if empty.
+     **/
+    double getAverageInteriorNeighborDistance( const std::vector< std::vector< unsigned int > > &i_position );
+
     /**
      * Gets the maximum possible speedups.
      *
@@ -456,6 +484,11 @@ class seissol::initializer::time_stepping::LtsLayout {
       // ensure a valid value
       if( o_localCellId > m_clusteredInterior[o_localClusterId].size() - 1 ||
           *l_searchResult != i_meshId ) logError() << "no matching neighboring interior cell";
+
+      // translate to the memory position
+      if( !m_interiorPosition.empty() ) {
+        o_localCellId = m_interiorPosition[o_localClusterId][o_localCellId];
+      }
     }
 
   public:
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "CostFactors.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace seissol::initializer::time_stepping {
+
+double measuredCostFactor(const CostMeasurement& local, const CostMeasurement& global) {
+  if (local.updates > 0 && local.time > 0 && global.updates > 0 && global.time > 0) {
+    return (local.time / local.updates) / (global.time / global.updates);
+  }
+  return 1.0;
+}
+
+void composeCostFactors(std::vector<double>& factors,
+                        const std::vector<double>& loadedFactors,
+                        const std::vector<std::size_t>& cellGroups,
+                        const std::vector<CostMeasurement>& local,
+                        const std::vector<CostMeasurement>& global) {
+  assert(loadedFactors.size() == cellGroups.size());
+  assert(local.size() == global.size());
+
+  std::vector<double> groupFactors(local.size());
+  for (std::size_t group = 0; group < local.size(); ++group) {
+    groupFactors[group] = measuredCostFactor(local[group], global[group]);
+  }
+
+  factors.resize(cellGroups.size());
+  for (std::size_t cell = 0; cell < cellGroups.size(); ++cell) {
+    factors[cell] = loadedFactors[cell] * groupFactors[cellGroups[cell]];
+  }
+}
+
+void applyCostFactors(std::vector<int>& cellCosts, const std::vector<double>& factors) {
+  assert(cellCosts.size() == factors.size());
+  for (std::size_t cell = 0; cell < cellCosts.size(); ++cell) {
+    cellCosts[cell] = std::max(1, static_cast<int>(std::lround(cellCosts[cell] * factors[cell])));
+  }
+}
+
+} // namespace seissol::initializer::time_stepping
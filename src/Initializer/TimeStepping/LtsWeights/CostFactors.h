@@ -0,0 +1,52 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_INITIALIZER_TIMESTEPPING_LTSWEIGHTS_COSTFACTORS_H_
+#define SEISSOL_SRC_INITIALIZER_TIMESTEPPING_LTSWEIGHTS_COSTFACTORS_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace seissol::initializer::time_stepping {
+
+/**
+ * Measured compute time of a group of cells (e.g. one layer of a time cluster), in seconds.
+ */
+struct CostMeasurement {
+  double time{};
+  //! number of element updates during that time
+  double updates{};
+};
+
+/**
+ * The cost factor of a group of cells: its time per element update relative to the one of the
+ * same group, summed over all ranks. Returns 1 if there is nothing to compare.
+ */
+double measuredCostFactor(const CostMeasurement& local, const CostMeasurement& global);
+
+/**
+ * Computes the cost factors of the cells from the measurements of their groups.
+ *
+ * The measurements were taken with a partition which already used the loaded factors; hence, the
+ * measured factors are multiplied with them. Otherwise, a restart would undo the previous
+ * correction and the partition would oscillate.
+ *
+ * @param loadedFactors the factors of the cells which the current partition was computed with
+ * @param cellGroups the measurement group of each cell
+ */
+void composeCostFactors(std::vector<double>& factors,
+                        const std::vector<double>& loadedFactors,
+                        const std::vector<std::size_t>& cellGroups,
+                        const std::vector<CostMeasurement>& local,
+                        const std::vector<CostMeasurement>& global);
+
+/**
+ * Scales the cell costs (i.e. the vertex weights of the partitioning) by the cost factors.
+ * A cell keeps a cost of at least 1.
+ */
+void applyCostFactors(std::vector<int>& cellCosts, const std::vector<double>& factors);
+
+} // namespace seissol::initializer::time_stepping
+
+#endif // SEISSOL_SRC_INITIALIZER_TIMESTEPPING_LTSWEIGHTS_COSTFACTORS_H_
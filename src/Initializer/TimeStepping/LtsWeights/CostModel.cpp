@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "CostModel.h"
+
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utils/logger.h>
+
+namespace seissol::initializer::time_stepping {
+
+CostModel deriveCostModel(double elementTime,
+                          double elementUpdates,
+                          double dynamicRuptureTime,
+                          double dynamicRuptureUpdates,
+                          const parameters::VertexWeightParameters& vertexWeights) {
+  CostModel costModel{};
+  if (elementUpdates > 0) {
+    costModel.element = elementTime / elementUpdates;
+  }
+  if (dynamicRuptureUpdates > 0) {
+    costModel.dynamicRupture = dynamicRuptureTime / dynamicRuptureUpdates;
+  } else if (vertexWeights.weightElement > 0) {
+    // without dynamic rupture faces, there is nothing to measure
+    // (the vertex weight is charged to both elements of a face)
+    costModel.dynamicRupture =
+        2 * costModel.element * vertexWeights.weightDynamicRupture / vertexWeights.weightElement;
+  }
+  if (vertexWeights.weightElement > 0) {
+    costModel.freeSurfaceWithGravity = costModel.element *
+                                       vertexWeights.weightFreeSurfaceWithGravity /
+                                       vertexWeights.weightElement;
+  }
+  return costModel;
+}
+
+std::optional<CostModel> readCostModel(const std::string& fileName) {
+  std::ifstream file(fileName);
+  if (!file) {
+    return std::nullopt;
+  }
+
+  CostModel costModel{};
+  bool hasElement = false;
+  std::string line;
+  while (std::getline(file, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream entry(line);
+    std::string key;
+    double value = 0;
+    if (!(entry >> key >> value)) {
+      logWarning() << "Ignoring the line" << line << "of the cost model" << fileName;
+      continue;
+    }
+    if (key == "element") {
+      costModel.element = value;
+      hasElement = true;
+    } else if (key == "dynamicRupture") {
+      costModel.dynamicRupture = value;
+    } else if (key == "freeSurfaceWithGravity") {
+      costModel.freeSurfaceWithGravity = value;
+    } else {
+      logWarning() << "Ignoring the unknown cost" << key << "of the cost model" << fileName;
+    }
+  }
+  if (!hasElement || !(costModel.element > 0)) {
+    logWarning() << "The cost model" << fileName << "has no positive element cost.";
+    return std::nullopt;
+  }
+  return costModel;
+}
+
+void writeCostModel(const std::string& fileName, const CostModel& costModel) {
+  std::ofstream file(fileName);
+  if (!file) {
+    logWarning() << "Could not write the cost model to" << fileName;
+    return;
+  }
+  file << "# measured cost per update in seconds" << std::endl;
+  file << std::setprecision(std::numeric_limits<double>::max_digits10);
+  file << "element " << costModel.element << std::endl;
+  file << "dynamicRupture " << costModel.dynamicRupture << std::endl;
+  file << "freeSurfaceWithGravity " << costModel.freeSurfaceWithGravity << std::endl;
+}
+
+parameters::VertexWeightParameters
+    toVertexWeights(const CostModel& costModel,
+                    const parameters::VertexWeightParameters& vertexWeights) {
+  auto weights = vertexWeights;
+  const double scale = vertexWeights.weightElement / costModel.element;
+  weights.weightDynamicRupture =
+      static_cast<int>(std::lround(0.5 * scale * costModel.dynamicRupture));
+  weights.weightFreeSurfaceWithGravity =
+      static_cast<int>(std::lround(scale * costModel.freeSurfaceWithGravity));
+  return weights;
+}
+
+} // namespace seissol::initializer::time_stepping
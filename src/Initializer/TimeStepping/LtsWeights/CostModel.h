@@ -0,0 +1,65 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_INITIALIZER_TIMESTEPPING_LTSWEIGHTS_COSTMODEL_H_
+#define SEISSOL_SRC_INITIALIZER_TIMESTEPPING_LTSWEIGHTS_COSTMODEL_H_
+
+#include <optional>
+#include <string>
+
+#include "Initializer/Parameters/LtsParameters.h"
+
+namespace seissol::initializer::time_stepping {
+
+/**
+ * Measured costs of a time step, in seconds.
+ *
+ * A cost model is written by a calibration run (cf. TimeManager::writeCostModel) and replaces the
+ * vertex weights of the parameter file in later runs.
+ */
+struct CostModel {
+  //! update of an element (local and neighbor integration)
+  double element{};
+  //! update of a dynamic rupture face
+  double dynamicRupture{};
+  //! additional cost of a free surface face with gravity
+  double freeSurfaceWithGravity{};
+};
+
+/**
+ * Derives the cost model from the measured kernel times.
+ *
+ * The costs of free surfaces with gravity are not measured separately; they keep their ratio to
+ * the element weight from the parameter file.
+ *
+ * @param elementTime time spent in the local and neighbor integration
+ * @param elementUpdates number of element updates during that time
+ * @param dynamicRuptureTime time spent in the dynamic rupture kernels
+ * @param dynamicRuptureUpdates number of dynamic rupture face updates during that time
+ */
+CostModel deriveCostModel(double elementTime,
+                          double elementUpdates,
+                          double dynamicRuptureTime,
+                          double dynamicRuptureUpdates,
+                          const parameters::VertexWeightParameters& vertexWeights);
+
+//! returns std::nullopt, if the file cannot be read
+std::optional<CostModel> readCostModel(const std::string& fileName);
+
+void writeCostModel(const std::string& fileName, const CostModel& costModel);
+
+/**
+ * Converts the cost model to integer vertex weights.
+ *
+ * The element weight of the parameter file is kept, s.t. the weights stay in the same range.
+ * A dynamic rupture face is counted for both adjacent elements; hence, each of them is charged
+ * half of its cost.
+ */
+parameters::VertexWeightParameters
+    toVertexWeights(const CostModel& costModel,
+                    const parameters::VertexWeightParameters& vertexWeights);
+
+} // namespace seissol::initializer::time_stepping
+
+#endif // SEISSOL_SRC_INITIALIZER_TIMESTEPPING_LTSWEIGHTS_COSTMODEL_H_
@@ -41,6 +41,8 @@
 #include "LtsWeights.h"
 
 #include <Eigen/Eigenvalues>
+#include <algorithm>
+#include <cmath>
 #include "Geometry/PUMLReader.h"
 #include "Kernels/Precision.h"
 #include "Initializer/Typedefs.h"
@@ -50,6 +52,10 @@
 #include "PUML/Upward.h"
 
 #include "Initializer/TimeStepping/GlobalTimestep.h"
+#include "Initializer/TimeStepping/LtsWeights/CostFactors.h"
+#include "Initializer/TimeStepping/LtsWeights/CostModel.h"
+#include "IO/Instance/Checkpoint/CheckpointManager.h"
+#include "Solver/Rebalancer.h"
 #include "Parallel/MPI.h"
 #include "SeisSol.h"
 #include "generated_code/init.h"
@@ -148,7 +154,27 @@ LtsWeights::LtsWeights(const LtsWeightsConfig& config, seissol::SeisSol& seissol
       m_vertexWeightElement(config.vertexWeightElement),
       m_vertexWeightDynamicRupture(config.vertexWeightDynamicRupture),
       m_vertexWeightFreeSurfaceWithGravity(config.vertexWeightFreeSurfaceWithGravity),
-      boundaryFormat(config.boundaryFormat) { }
+      boundaryFormat(config.boundaryFormat) {
+  if (!config.costModelFile.empty()) {
+    const auto costModel = readCostModel(config.costModelFile);
+    const auto rank = seissol::MPI::mpi.rank();
+    if (costModel.has_value()) {
+      const auto weights = toVertexWeights(*costModel,
+                                           {m_vertexWeightElement,
+                                            m_vertexWeightDynamicRupture,
+                                            m_vertexWeightFreeSurfaceWithGravity});
+      m_vertexWeightDynamicRupture = weights.weightDynamicRupture;
+      m_vertexWeightFreeSurfaceWithGravity = weights.weightFreeSurfaceWithGravity;
+      logInfo(rank) << "Using the measured costs from" << config.costModelFile
+                    << "for the LTS weights: element =" << m_vertexWeightElement
+                    << ", dynamic rupture =" << m_vertexWeightDynamicRupture
+                    << ", free surface with gravity =" << m_vertexWeightFreeSurfaceWithGravity;
+    } else {
+      logInfo(rank) << "No cost model found in" << config.costModelFile
+                    << "; using the vertex weights of the parameter file.";
+    }
+  }
+}
 
 void LtsWeights::computeWeights(PUML::TETPUML const& mesh, double maximumAllowedTimeStep) {
   const auto rank = seissol::MPI::mpi.rank();
@@ -158,6 +184,7 @@ void LtsWeights::computeWeights(PUML::TETPUML const& mesh, double maximumAllowed
   m_mesh = &mesh;
   m_details = collectGlobalTimeStepDetails(maximumAllowedTimeStep);
   m_cellCosts = computeCostsPerTimestep();
+  applyRebalancingCosts();
 
   auto& ltsParameters = seissolInstance.getSeisSolParameters().timeStepping.lts;
   auto maxClusterIdToEnforce = ltsParameters.getMaxNumberOfClusters() - 1;
@@ -465,6 +492,30 @@ std::vector<int> LtsWeights::computeCostsPerTimestep() {
   return cellCosts;
 }
 
+void LtsWeights::applyRebalancingCosts() {
+  const auto& checkpointFile = seissolInstance.getCheckpointLoadFile();
+  const auto& checkpointParameters =
+      seissolInstance.getSeisSolParameters().output.checkpointParameters;
+  if (!checkpointFile.has_value() || !checkpointParameters.enabled ||
+      checkpointParameters.rebalanceImbalance <= 0) {
+    return;
+  }
+
+  const auto cells = m_mesh->cells().size();
+  const auto* cellIdsAsInFile = reinterpret_cast<const std::size_t*>(m_mesh->cellData(2));
+  const std::vector<std::size_t> globalIds(cellIdsAsInFile, cellIdsAsInFile + cells);
+  const auto costFactors = io::instance::checkpoint::CheckpointManager::readWriteOnlyData(
+      checkpointFile.value(), "lts", solver::Rebalancer::CheckpointVariable, globalIds);
+  const auto rank = seissol::MPI::mpi.rank();
+  if (!costFactors.has_value()) {
+    logInfo(rank) << "The checkpoint contains no measured costs; the partition is not rebalanced.";
+    return;
+  }
+
+  logInfo(rank) << "Rebalancing the partition with the measured costs of the checkpoint.";
+  applyCostFactors(m_cellCosts, costFactors.value());
+}
+
 int LtsWeights::enforceMaximumDifference() {
   int totalNumberOfReductions = 0;
   int globalNumberOfReductions;
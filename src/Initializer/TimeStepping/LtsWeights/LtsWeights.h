@@ -66,6 +66,8 @@ struct LtsWeightsConfig {
   int vertexWeightElement{};
   int vertexWeightDynamicRupture{};
   int vertexWeightFreeSurfaceWithGravity{};
+  // replaces the vertex weights above by measured costs, if the file exists
+  std::string costModelFile{};
 };
 
 double computeLocalCostOfClustering(const std::vector<int>& clusterIds,
@@ -116,6 +118,8 @@ protected:
   int enforceMaximumDifference();
   int enforceMaximumDifferenceLocal(int maxDifference = 1);
   std::vector<int> computeCostsPerTimestep();
+  // scales the cell costs by the cost factors of a rebalancing checkpoint (cf. Rebalancer)
+  void applyRebalancingCosts();
 
   static int ipow(int x, int y);
 
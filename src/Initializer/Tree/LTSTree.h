@@ -174,6 +174,14 @@ class LTSTree : public LTSInternalNode {
       leaf.addVariableSizes(varInfo, variableSizes);
     }
 
+    // map the huge pages for all variables at once, sized to what they actually need
+    std::size_t hugePageBytes = 0;
+    for (unsigned var = 0; var < varInfo.size(); ++var) {
+      hugePageBytes += DualMemoryContainer::hugePageBytes(
+          variableSizes[var], varInfo[var].alignment, varInfo[var].allocMode);
+    }
+    m_allocator.reserveHugePages(hugePageBytes);
+
     for (unsigned var = 0; var < varInfo.size(); ++var) {
       m_vars[var].allocate(
           m_allocator, variableSizes[var], varInfo[var].alignment, varInfo[var].allocMode);
@@ -195,6 +203,13 @@ class LTSTree : public LTSInternalNode {
       leaf.addBucketSizes(bucketSizes);
     }
 
+    std::size_t hugePageBytes = 0;
+    for (unsigned bucket = 0; bucket < bucketInfo.size(); ++bucket) {
+      hugePageBytes += DualMemoryContainer::hugePageBytes(
+          bucketSizes[bucket], bucketInfo[bucket].alignment, bucketInfo[bucket].allocMode);
+    }
+    m_allocator.reserveHugePages(hugePageBytes);
+
     for (unsigned bucket = 0; bucket < bucketInfo.size(); ++bucket) {
       m_buckets[bucket].allocate(m_allocator,
                                  bucketSizes[bucket],
@@ -239,12 +254,16 @@ class LTSTree : public LTSInternalNode {
   }
 #endif
 
-  void touchVariables() {
+  void touchVariables(parallel::NumaPlacement* placement = nullptr) {
     for (auto& leaf : leaves()) {
-      leaf.touchVariables(varInfo);
+      leaf.touchVariables(varInfo, placement);
     }
   }
 
+  [[nodiscard]] seissol::memory::HugePageArena::Statistics getHugePageStatistics() const {
+    return m_allocator.hugePageStatistics();
+  }
+
   [[nodiscard]] const std::vector<size_t>& getVariableSizes() const { return variableSizes; }
 
   [[nodiscard]] const std::vector<size_t>& getBucketSizes() const { return bucketSizes; }
@@ -45,6 +45,8 @@
 #include "Initializer/DeviceGraph.h"
 #include "Initializer/MemoryAllocator.h"
 #include "Node.h"
+#include "Parallel/NumaPlacement.h"
+#include "Parallel/Runtime/ParallelFor.h"
 #include <bitset>
 #include <cstring>
 #include <limits>
@@ -86,12 +88,20 @@ struct DualMemoryContainer {
     }
   }
 
+  /// bytes which allocate takes from the huge-page arena (including the padding for the alignment)
+  static std::size_t hugePageBytes(std::size_t size, std::size_t alignment, AllocationMode mode) {
+    const bool hugePages = seissol::memory::useHugePages() && mode == AllocationMode::HostOnly;
+    return hugePages && size > 0 ? size + alignment : 0;
+  }
+
   void allocate(seissol::memory::ManagedAllocator& allocator,
                 std::size_t size,
                 std::size_t alignment,
                 AllocationMode mode) {
     if (mode == AllocationMode::HostOnly) {
-      host = allocator.allocateMemory(size, alignment, seissol::memory::Memkind::Standard);
+      const auto memkind = seissol::memory::useHugePages() ? seissol::memory::Memkind::HugePages
+                                                           : seissol::memory::Memkind::Standard;
+      host = allocator.allocateMemory(size, alignment, memkind);
       device = nullptr;
     }
     if (mode == AllocationMode::HostOnlyHBM) {
@@ -366,18 +376,21 @@ class Layer : public Node {
   }
 #endif
 
-  void touchVariables(const std::vector<MemoryInfo>& vars) {
+  /// touches the variables in the same chunks as the cell loops; with a placement, the pages
+  /// of plain host memory are bound to the NUMA nodes of these chunks beforehand
+  void touchVariables(const std::vector<MemoryInfo>& vars,
+                      parallel::NumaPlacement* placement = nullptr) {
     for (unsigned var = 0; var < vars.size(); ++var) {
 
       // NOTE: we don't touch device global memory because it is in a different address space
       // we will do deep-copy from the host to a device later on
       if (!isMasked(vars[var].mask) && (m_vars[var].host != nullptr)) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-        for (unsigned cell = 0; cell < m_numberOfCells; ++cell) {
-          memset(static_cast<char*>(m_vars[var].host) + cell * vars[var].bytes, 0, vars[var].bytes);
+        if (placement != nullptr && m_vars[var].allocationMode == AllocationMode::HostOnly) {
+          placement->place(m_vars[var].host, m_numberOfCells, vars[var].bytes);
         }
+        parallel::runtime::parallelFor(m_numberOfCells, [&](std::size_t cell) {
+          memset(static_cast<char*>(m_vars[var].host) + cell * vars[var].bytes, 0, vars[var].bytes);
+        });
       }
     }
   }
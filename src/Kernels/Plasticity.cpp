@@ -55,7 +55,9 @@
 #include <cassert>
 #include <cmath>
 #include <cstring>
+#include <limits>
 #include <tensor.h>
+#include <vector>
 
 #include "utils/logger.h"
 
@@ -67,9 +69,7 @@
 using namespace device;
 #endif
 
-#ifndef NDEBUG
 #include <cstdint>
-#endif
 
 namespace seissol::kernels {
 unsigned Plasticity::computePlasticity(double oneMinusIntegratingFactor,
@@ -266,6 +266,314 @@ unsigned Plasticity::computePlasticity(double oneMinusIntegratingFactor,
   return 0;
 }
 
+Plasticity::Screening Plasticity::computeScreening(const GlobalData* global) {
+  alignas(Alignment) real qStress[tensor::QStress::size()] = {};
+  alignas(Alignment) real qStressNodal[tensor::QStressNodal::size()];
+  auto qStressView = init::QStress::view::create(qStress);
+  auto qStressNodalView = init::QStressNodal::view::create(qStressNodal);
+  const unsigned numBasisFunctions = qStressView.shape(0);
+  const unsigned numNodes = qStressNodalView.shape(0);
+
+  kernel::plConvertToNodalNoLoading m2nKrnl;
+  m2nKrnl.v = global->vandermondeMatrix;
+  m2nKrnl.QStress = qStress;
+  m2nKrnl.QStressNodal = qStressNodal;
+
+  // evaluate one basis function after the other at the nodes
+  Screening screening;
+  std::vector<real> squaredNorms(numNodes, 0.0);
+  for (unsigned basis = 0; basis < numBasisFunctions; ++basis) {
+    qStressView(basis, 0) = 1.0;
+    m2nKrnl.execute();
+    qStressView(basis, 0) = 0.0;
+    if (basis == 0) {
+      screening.constantBasis = qStressNodalView(0, 0);
+    } else {
+      for (unsigned i = 0; i < numNodes; ++i) {
+        squaredNorms[i] += qStressNodalView(i, 0) * qStressNodalView(i, 0);
+      }
+    }
+  }
+  screening.nonConstantBound =
+      std::sqrt(*std::max_element(squaredNorms.begin(), squaredNorms.end()));
+  return screening;
+}
+
+bool Plasticity::isElastic(const Screening& screening,
+                           const seissol::model::PlasticityData* plasticityData,
+                           const real degreesOfFreedom[tensor::Q::size()]) {
+  // the nodal kernel is subject to rounding errors; hence, we leave a safety margin
+  constexpr real Tolerance = 1000 * std::numeric_limits<real>::epsilon();
+
+  // @todo multiple sims
+  auto qStressView = init::QStress::view::create(const_cast<real*>(degreesOfFreedom));
+  const unsigned numBasisFunctions = qStressView.shape(0);
+
+  // per stress component (xx, yy, zz, xy, yz, xz): the cell average including sigma0, and
+  // the bound of the deviation from it at any node
+  real average[6];
+  real deviation[6];
+  real magnitude = std::abs(plasticityData->cohesionTimesCosAngularFriction);
+  for (unsigned c = 0; c < 6; ++c) {
+    average[c] = screening.constantBasis * qStressView(0, c) + plasticityData->initialLoading[c];
+    real squaredNorm = 0.0;
+    for (unsigned basis = 1; basis < numBasisFunctions; ++basis) {
+      squaredNorm += qStressView(basis, c) * qStressView(basis, c);
+    }
+    deviation[c] = screening.nonConstantBound * std::sqrt(squaredNorm);
+    magnitude += std::abs(average[c]) + deviation[c];
+  }
+
+  /* sqrt(I_2) is a seminorm; thus, tau <= sqrt(I_2(average)) + sqrt(I_2(deviation)).
+   * Subtracting the mean does not increase the norm of the deviation. */
+  const real averageMean = (average[0] + average[1] + average[2]) / 3.0;
+  const real deviationMean = (deviation[0] + deviation[1] + deviation[2]) / 3.0;
+  real averageInvariant = 0.0;
+  real deviationInvariant = 0.0;
+  for (unsigned c = 0; c < 3; ++c) {
+    averageInvariant += 0.5 * (average[c] - averageMean) * (average[c] - averageMean);
+    deviationInvariant += 0.5 * deviation[c] * deviation[c];
+  }
+  for (unsigned c = 3; c < 6; ++c) {
+    averageInvariant += average[c] * average[c];
+    deviationInvariant += deviation[c] * deviation[c];
+  }
+  const real tauUpper = std::sqrt(averageInvariant) + std::sqrt(deviationInvariant);
+
+  const real taulimLower = plasticityData->cohesionTimesCosAngularFriction -
+                           averageMean * plasticityData->sinAngularFriction -
+                           deviationMean * std::abs(plasticityData->sinAngularFriction);
+
+  return tauUpper + Tolerance * magnitude <= taulimLower;
+}
+
+namespace {
+constexpr std::size_t BlockSize = Plasticity::BlockSize;
+constexpr unsigned NumNodes = tensor::yieldFactor::size();
+
+// per-cell data for the nodal conversions
+struct CellScratch {
+  alignas(Alignment) real qStressNodal[tensor::QStressNodal::size()];
+  alignas(Alignment) real qEtaNodal[tensor::QEtaNodal::size()];
+  alignas(Alignment) real qEtaModal[tensor::QEtaModal::size()];
+  alignas(Alignment) real meanStress[tensor::meanStress::size()];
+  alignas(Alignment) real secondInvariant[tensor::secondInvariant::size()];
+  alignas(Alignment) real yieldFactor[tensor::yieldFactor::size()];
+  alignas(Alignment) real dudtPstrain[tensor::QStress::size()];
+  real prevDegreesOfFreedom[tensor::QStress::size()];
+};
+
+// node-wise data of all cells in a block, the cells being the innermost dimension
+struct BlockScratch {
+  alignas(Alignment) real meanStress[NumNodes][BlockSize];
+  alignas(Alignment) real tau[NumNodes][BlockSize];
+  alignas(Alignment) real taulim[NumNodes][BlockSize];
+  alignas(Alignment) real yieldFactor[NumNodes][BlockSize];
+  alignas(Alignment) real qEtaNodal[NumNodes][BlockSize];
+  alignas(Alignment) real dudtPstrainNodal[6][NumNodes][BlockSize];
+  alignas(Alignment) real cohesionTimesCosAngularFriction[BlockSize];
+  alignas(Alignment) real sinAngularFriction[BlockSize];
+  unsigned adjust[BlockSize];
+};
+} // namespace
+
+unsigned Plasticity::computePlasticityBlock(
+    double oneMinusIntegratingFactor,
+    double timeStepWidth,
+    double tV,
+    const GlobalData* global,
+    std::size_t numCells,
+    const seissol::model::PlasticityData* const plasticityData[],
+    real* const degreesOfFreedom[],
+    real* const pstrain[],
+    unsigned yielded[]) {
+  assert(numCells <= BlockSize);
+  assert(reinterpret_cast<uintptr_t>(global->vandermondeMatrix) % Alignment == 0);
+  assert(reinterpret_cast<uintptr_t>(global->vandermondeMatrixInverse) % Alignment == 0);
+
+  static_assert(tensor::secondInvariant::size() == tensor::meanStress::size(),
+                "Second invariant tensor and mean stress tensor must be of the same size().");
+  static_assert(tensor::yieldFactor::size() <= tensor::meanStress::size(),
+                "Yield factor tensor must be smaller than mean stress tensor.");
+  static_assert(tensor::yieldFactor::size() <= tensor::QEtaNodal::size(),
+                "Yield factor tensor must not be larger than the nodal eta tensor.");
+
+  CellScratch cells[BlockSize];
+  BlockScratch block;
+
+  // nodal stresses, mean stress, and second invariant; cf. computePlasticity
+  // @todo multiple sims
+  for (std::size_t cell = 0; cell < numCells; ++cell) {
+    assert(reinterpret_cast<uintptr_t>(degreesOfFreedom[cell]) % Alignment == 0);
+    auto& scratch = cells[cell];
+    std::copy_n(degreesOfFreedom[cell], tensor::QStress::size(), scratch.prevDegreesOfFreedom);
+
+    kernel::plConvertToNodal m2nKrnl;
+    m2nKrnl.v = global->vandermondeMatrix;
+    m2nKrnl.QStress = degreesOfFreedom[cell];
+    m2nKrnl.QStressNodal = scratch.qStressNodal;
+    m2nKrnl.replicateInitialLoading = init::replicateInitialLoading::Values;
+    m2nKrnl.initialLoading = plasticityData[cell]->initialLoading;
+    m2nKrnl.execute();
+
+    kernel::plComputeMean cmKrnl;
+    cmKrnl.meanStress = scratch.meanStress;
+    cmKrnl.QStressNodal = scratch.qStressNodal;
+    cmKrnl.selectBulkAverage = init::selectBulkAverage::Values;
+    cmKrnl.execute();
+
+    kernel::plSubtractMean smKrnl;
+    smKrnl.meanStress = scratch.meanStress;
+    smKrnl.QStressNodal = scratch.qStressNodal;
+    smKrnl.selectBulkNegative = init::selectBulkNegative::Values;
+    smKrnl.execute();
+
+    kernel::plComputeSecondInvariant siKrnl;
+    siKrnl.secondInvariant = scratch.secondInvariant;
+    siKrnl.QStressNodal = scratch.qStressNodal;
+    siKrnl.weightSecondInvariant = init::weightSecondInvariant::Values;
+    siKrnl.execute();
+
+    for (unsigned ip = 0; ip < NumNodes; ++ip) {
+      block.meanStress[ip][cell] = scratch.meanStress[ip];
+      block.tau[ip][cell] = scratch.secondInvariant[ip];
+    }
+    block.cohesionTimesCosAngularFriction[cell] =
+        plasticityData[cell]->cohesionTimesCosAngularFriction;
+    block.sinAngularFriction[cell] = plasticityData[cell]->sinAngularFriction;
+  }
+  // unused lanes never yield (tau = taulim = 0)
+  for (std::size_t cell = numCells; cell < BlockSize; ++cell) {
+    for (unsigned ip = 0; ip < NumNodes; ++ip) {
+      block.meanStress[ip][cell] = 0.0;
+      block.tau[ip][cell] = 0.0;
+    }
+    block.cohesionTimesCosAngularFriction[cell] = 0.0;
+    block.sinAngularFriction[cell] = 0.0;
+  }
+
+  // tau, tau_c, and the yield factor for every node of every cell
+  std::fill_n(block.adjust, BlockSize, 0U);
+  for (unsigned ip = 0; ip < NumNodes; ++ip) {
+#pragma omp simd
+    for (std::size_t cell = 0; cell < BlockSize; ++cell) {
+      const real tau = sqrt(block.tau[ip][cell]);
+      const real taulim = std::max((real)0.0,
+                                   block.cohesionTimesCosAngularFriction[cell] -
+                                       block.meanStress[ip][cell] * block.sinAngularFriction[cell]);
+      const bool yields = tau > taulim;
+      // (keeps the division in non-yielding lanes finite)
+      const real divisor = yields ? tau : (real)1.0;
+      block.tau[ip][cell] = tau;
+      block.taulim[ip][cell] = taulim;
+      block.yieldFactor[ip][cell] =
+          yields ? (taulim / divisor - 1.0) * oneMinusIntegratingFactor : 0.0;
+      block.adjust[cell] |= yields ? 1U : 0U;
+    }
+  }
+
+  // stress adjustment and plastic strain rate; cf. computePlasticity
+  unsigned numYielded = 0;
+  for (std::size_t cell = 0; cell < numCells; ++cell) {
+    yielded[cell] = block.adjust[cell];
+    if (block.adjust[cell] == 0) {
+      continue;
+    }
+    ++numYielded;
+    auto& scratch = cells[cell];
+    for (unsigned ip = 0; ip < NumNodes; ++ip) {
+      scratch.yieldFactor[ip] = block.yieldFactor[ip][cell];
+    }
+
+    kernel::plAdjustStresses adjKrnl;
+    adjKrnl.QStress = degreesOfFreedom[cell];
+    adjKrnl.vInv = global->vandermondeMatrixInverse;
+    adjKrnl.QStressNodal = scratch.qStressNodal;
+    adjKrnl.yieldFactor = scratch.yieldFactor;
+    adjKrnl.execute();
+
+    const real factor = plasticityData[cell]->mufactor / (tV * oneMinusIntegratingFactor);
+    for (unsigned q = 0; q < tensor::QStress::size(); ++q) {
+      scratch.dudtPstrain[q] =
+          factor * (scratch.prevDegreesOfFreedom[q] - degreesOfFreedom[cell][q]);
+      pstrain[cell][q] += timeStepWidth * scratch.dudtPstrain[q];
+    }
+
+    kernel::plConvertToNodalNoLoading m2nKrnlDudtPstrain;
+    m2nKrnlDudtPstrain.v = global->vandermondeMatrix;
+    m2nKrnlDudtPstrain.QStress = scratch.dudtPstrain;
+    m2nKrnlDudtPstrain.QStressNodal = scratch.qStressNodal;
+    m2nKrnlDudtPstrain.execute();
+
+    for (unsigned q = 0; q < tensor::QEtaModal::size(); ++q) {
+      scratch.qEtaModal[q] = pstrain[cell][tensor::QStress::size() + q];
+    }
+
+    kernel::plConvertEtaModal2Nodal m2nEtaKrnl;
+    m2nEtaKrnl.v = global->vandermondeMatrix;
+    m2nEtaKrnl.QEtaModal = scratch.qEtaModal;
+    m2nEtaKrnl.QEtaNodal = scratch.qEtaNodal;
+    m2nEtaKrnl.execute();
+
+    auto qStressNodalView = init::QStressNodal::view::create(scratch.qStressNodal);
+    for (unsigned ip = 0; ip < NumNodes; ++ip) {
+      block.qEtaNodal[ip][cell] = scratch.qEtaNodal[ip];
+      for (unsigned s = 0; s < 6; ++s) {
+        block.dudtPstrainNodal[s][ip][cell] = qStressNodalView(ip, s);
+      }
+    }
+  }
+  if (numYielded == 0) {
+    return 0;
+  }
+  for (std::size_t cell = 0; cell < BlockSize; ++cell) {
+    if (cell >= numCells || block.adjust[cell] == 0) {
+      for (unsigned ip = 0; ip < NumNodes; ++ip) {
+        block.qEtaNodal[ip][cell] = 0.0;
+        for (unsigned s = 0; s < 6; ++s) {
+          block.dudtPstrainNodal[s][ip][cell] = 0.0;
+        }
+      }
+    }
+  }
+
+  // eta += timeStepWidth * sqrt(0.5 dstrain_{ij}/dt dstrain_{ij}/dt) for every node of every cell
+  const auto& dudt = block.dudtPstrainNodal;
+  for (unsigned ip = 0; ip < NumNodes; ++ip) {
+#pragma omp simd
+    for (std::size_t cell = 0; cell < BlockSize; ++cell) {
+      block.qEtaNodal[ip][cell] =
+          std::max((real)0.0, block.qEtaNodal[ip][cell]) +
+          timeStepWidth * sqrt(0.5 * (dudt[0][ip][cell] * dudt[0][ip][cell] +
+                                      dudt[1][ip][cell] * dudt[1][ip][cell] +
+                                      dudt[2][ip][cell] * dudt[2][ip][cell] +
+                                      dudt[3][ip][cell] * dudt[3][ip][cell] +
+                                      dudt[4][ip][cell] * dudt[4][ip][cell] +
+                                      dudt[5][ip][cell] * dudt[5][ip][cell]));
+    }
+  }
+
+  for (std::size_t cell = 0; cell < numCells; ++cell) {
+    if (block.adjust[cell] == 0) {
+      continue;
+    }
+    auto& scratch = cells[cell];
+    for (unsigned ip = 0; ip < NumNodes; ++ip) {
+      scratch.qEtaNodal[ip] = block.qEtaNodal[ip][cell];
+    }
+
+    kernel::plConvertEtaNodal2Modal n2mEtaKrnl;
+    n2mEtaKrnl.vInv = global->vandermondeMatrixInverse;
+    n2mEtaKrnl.QEtaNodal = scratch.qEtaNodal;
+    n2mEtaKrnl.QEtaModal = scratch.qEtaModal;
+    n2mEtaKrnl.execute();
+    for (unsigned q = 0; q < tensor::QEtaModal::size(); ++q) {
+      pstrain[cell][tensor::QStress::size() + q] = scratch.qEtaModal[q];
+    }
+  }
+  return numYielded;
+}
+
 unsigned Plasticity::computePlasticityBatched(
     double oneMinusIntegratingFactor,
     double timeStepWidth,
@@ -457,10 +765,17 @@ unsigned Plasticity::computePlasticityBatched(
 #endif // ACL_DEVICE
 }
 
-void Plasticity::flopsPlasticity(long long& nonZeroFlopsCheck,
+void Plasticity::flopsPlasticity(long long& nonZeroFlopsScreen,
+                                 long long& hardwareFlopsScreen,
+                                 long long& nonZeroFlopsCheck,
                                  long long& hardwareFlopsCheck,
                                  long long& nonZeroFlopsYield,
                                  long long& hardwareFlopsYield) {
+  // flops from screening: the norms of the higher modes (1 add, 1 mul per coefficient),
+  // and the bounds of tau and taulim (counted roughly)
+  nonZeroFlopsScreen = 2 * 6 * (tensor::QStress::Shape[0] - 1) + 60;
+  hardwareFlopsScreen = nonZeroFlopsScreen;
+
   // reset flops
   nonZeroFlopsCheck = 0;
   hardwareFlopsCheck = 0;
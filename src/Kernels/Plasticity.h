@@ -49,12 +49,36 @@
 #include "Model/Plasticity.h"
 #include "Parallel/Runtime/Stream.h"
 #include "generated_code/tensor.h"
+#include <cstddef>
 #include <limits>
 
 namespace seissol::kernels {
 
 class Plasticity {
   public:
+  /**
+   * Bounds of the nodal basis, used to screen cells for plastic yielding without the nodal
+   * conversion (cf. isElastic).
+   */
+  struct Screening {
+    //! value of the constant basis function
+    real constantBasis{0.0};
+    //! maximum over all nodes of the 2-norm of the non-constant basis functions
+    real nonConstantBound{0.0};
+  };
+
+  static Screening computeScreening(const GlobalData* global);
+
+  /** Returns true if no node of the cell can reach the yield criterion.
+   *
+   * Conservative modal bound: the nodal stresses deviate from the cell average at most by the
+   * 2-norm of the higher modes times Screening::nonConstantBound. If the resulting upper bound of
+   * tau stays below the lower bound of taulim, computePlasticity would not change the cell.
+   */
+  static bool isElastic(const Screening& screening,
+                        const seissol::model::PlasticityData* plasticityData,
+                        const real degreesOfFreedom[tensor::Q::size()]);
+
   /** Returns 1 if there was plastic yielding otherwise 0.
    */
   static unsigned computePlasticity(double oneMinusIntegratingFactor,
@@ -65,6 +89,28 @@ class Plasticity {
                                     real degreesOfFreedom[tensor::Q::size()],
                                     real* pstrain);
 
+  //! number of cells processed together by computePlasticityBlock
+  static constexpr std::size_t BlockSize = 8;
+
+  /** Same as computePlasticity, but for up to BlockSize cells at once. Gives the same results.
+   *
+   * The nodal conversions run per cell; the node-wise computations (tau, taulim, the yield
+   * factors, and the update of eta) run on all cells of the block together, with the cells as the
+   * innermost (i.e. SIMD) dimension.
+   * Returns the number of cells with plastic yielding; yielded[i] is set to 1 if cell i yielded,
+   * and to 0 otherwise.
+   */
+  static unsigned
+      computePlasticityBlock(double oneMinusIntegratingFactor,
+                             double timeStepWidth,
+                             double tV,
+                             const GlobalData* global,
+                             std::size_t numCells,
+                             const seissol::model::PlasticityData* const plasticityData[],
+                             real* const degreesOfFreedom[],
+                             real* const pstrain[],
+                             unsigned yielded[]);
+
   static unsigned
       computePlasticityBatched(double oneMinusIntegratingFactor,
                                double timeStepWidth,
@@ -74,7 +120,9 @@ class Plasticity {
                                seissol::model::PlasticityData* plasticityData,
                                seissol::parallel::runtime::StreamRuntime& runtime);
 
-  static void flopsPlasticity(long long& nonZeroFlopsCheck,
+  static void flopsPlasticity(long long& nonZeroFlopsScreen,
+                              long long& hardwareFlopsScreen,
+                              long long& nonZeroFlopsCheck,
                               long long& hardwareFlopsCheck,
                               long long& nonZeroFlopsYield,
                               long long& hardwareFlopsYield);
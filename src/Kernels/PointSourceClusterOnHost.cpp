@@ -9,8 +9,10 @@
 
 #include <Kernels/PointSourceCluster.h>
 #include <Kernels/Precision.h>
+#include <Parallel/Runtime/ParallelFor.h>
 #include <Parallel/Runtime/Stream.h>
 #include <SourceTerm/Typedefs.h>
+#include <cstddef>
 #include <memory>
 #include <tensor.h>
 #include <utility>
@@ -26,10 +28,7 @@ void PointSourceClusterOnHost::addTimeIntegratedPointSources(
     double from, double to, seissol::parallel::runtime::StreamRuntime& runtime) {
   auto& mapping = clusterMapping_->cellToSources;
   if (mapping.size() > 0) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-    for (unsigned m = 0; m < mapping.size(); ++m) {
+    seissol::parallel::runtime::parallelFor(mapping.size(), [&](std::size_t m) {
       const unsigned startSource = mapping[m].pointSourcesOffset;
       const unsigned endSource = mapping[m].pointSourcesOffset + mapping[m].numberOfPointSources;
       if (sources_->mode == sourceterm::PointSourceMode::Nrf) {
@@ -41,7 +40,7 @@ void PointSourceClusterOnHost::addTimeIntegratedPointSources(
           addTimeIntegratedPointSourceFSRM(source, from, to, *mapping[m].dofs);
         }
       }
-    }
+    });
   }
 }
 
@@ -6,6 +6,7 @@
 
 #include "generated_code/tensor.h"
 #include <Kernels/Precision.h>
+#include <Parallel/Runtime/ParallelFor.h>
 #include <yateto.h>
 
 #ifdef ACL_DEVICE
@@ -14,11 +15,20 @@
 
 namespace seissol::kernels {
 
-void touchBuffersDerivatives(real** buffers, real** derivatives, unsigned numberOfCells) {
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static)
-#endif
-  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+void touchBuffersDerivatives(real** buffers,
+                             real** derivatives,
+                             unsigned numberOfCells,
+                             parallel::NumaPlacement* placement) {
+  if (placement != nullptr) {
+    placement->place(reinterpret_cast<void* const*>(buffers),
+                     numberOfCells,
+                     tensor::Q::size() * sizeof(real));
+    placement->place(reinterpret_cast<void* const*>(derivatives),
+                     numberOfCells,
+                     yateto::computeFamilySize<tensor::dQ>() * sizeof(real));
+  }
+
+  parallel::runtime::parallelFor(numberOfCells, [&](std::size_t cell) {
     // touch buffers
     real* buffer = buffers[cell];
     if (buffer != nullptr) {
@@ -35,7 +45,7 @@ void touchBuffersDerivatives(real** buffers, real** derivatives, unsigned number
         derivative[dof] = (real)0;
       }
     }
-  }
+  });
 }
 
 void fillWithStuff(real* buffer, unsigned nValues, [[maybe_unused]] bool onDevice) {
@@ -5,10 +5,18 @@
 #define KERNELS_TOUCH_H_
 
 #include "Kernels/Precision.h"
+#include "Parallel/NumaPlacement.h"
 
 namespace seissol::kernels {
 
-void touchBuffersDerivatives(real** buffers, real** derivatives, unsigned numberOfCells);
+/**
+ * Zeros the buffers and derivatives in the same chunks as the cell loops. With a placement, their
+ * pages are bound to the NUMA nodes of these chunks beforehand.
+ */
+void touchBuffersDerivatives(real** buffers,
+                             real** derivatives,
+                             unsigned numberOfCells,
+                             parallel::NumaPlacement* placement = nullptr);
 void fillWithStuff(real* buffer, unsigned nValues, bool onDevice);
 
 } // namespace seissol::kernels
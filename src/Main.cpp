@@ -57,6 +57,7 @@
 #include "Initializer/InitProcedure/Init.h"
 #include "Initializer/Parameters/SeisSolParameters.h"
 #include "SeisSol.h"
+#include "Solver/Rebalancer.h"
 
 #include "Common/Constants.h"
 #include "Parallel/MPI.h"
@@ -219,5 +220,9 @@ int main(int argc, char* argv[]) {
 #ifdef ACL_DEVICE
   device.api->finalize();
 #endif
+  if (seissolInstance.rebalancer().restartRequested()) {
+    // stopped early; to be restarted from a checkpoint with a rebalanced partition
+    return seissol::solver::Rebalancer::RestartExitCode;
+  }
   return 0;
 }
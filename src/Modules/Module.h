@@ -142,6 +142,8 @@ class Module {
   protected:
   [[nodiscard]] double syncInterval() const { return isyncInterval; }
 
+  [[nodiscard]] double nextSynchronizationPoint() const { return nextSyncPoint; }
+
   /**
    * Set the synchronization interval for this module
    *
@@ -48,8 +48,10 @@
 #include <ctime>
 #include <iterator>
 #include <mpi.h>
+#include <mutex>
 #include <string>
 #include <time.h>
+#include <utility>
 #include <utils/logger.h>
 #include <vector>
 #ifdef USE_NETCDF
@@ -115,18 +117,24 @@ unsigned LoopStatistics::getRegion(const std::string& name) const {
   return std::distance(first, it);
 }
 
-void LoopStatistics::begin(unsigned region) {
-  clock_gettime(CLOCK_MONOTONIC, &regions[region].begin);
+timespec LoopStatistics::begin() {
+  timespec beginTime{};
+  clock_gettime(CLOCK_MONOTONIC, &beginTime);
+  return beginTime;
 }
 
-void LoopStatistics::end(unsigned region, unsigned numIterations, unsigned subRegion) {
+void LoopStatistics::end(unsigned region,
+                         timespec begin,
+                         unsigned numIterations,
+                         unsigned subRegion) {
   timespec endTime{};
   clock_gettime(CLOCK_MONOTONIC, &endTime);
-  addSample(region, numIterations, subRegion, regions[region].begin, endTime);
+  addSample(region, numIterations, subRegion, begin, endTime);
 }
 
 void LoopStatistics::addSample(
     unsigned region, unsigned numIterations, unsigned subRegion, timespec begin, timespec end) {
+  const std::lock_guard lock(sampleMutex);
   if (outputSamples) {
     Sample sample{};
     sample.begin = begin;
@@ -144,14 +152,37 @@ void LoopStatistics::addSample(
     vars.y += time;
     vars.y2 += time * time;
     ++vars.n;
+
+    auto& subRegionTotals = regions[region].subRegionTotals;
+    if (subRegion >= subRegionTotals.size()) {
+      subRegionTotals.resize(subRegion + 1);
+    }
+    subRegionTotals[subRegion].first += time;
+    subRegionTotals[subRegion].second += numIterations;
   }
 }
 
+double LoopStatistics::getTotalTime(unsigned region) const { return regions[region].variables.y; }
+
+double LoopStatistics::getTotalIterations(unsigned region) const {
+  return regions[region].variables.x;
+}
+
+double LoopStatistics::getTotalTime(unsigned region, unsigned subRegion) const {
+  const auto& subRegionTotals = regions[region].subRegionTotals;
+  return subRegion < subRegionTotals.size() ? subRegionTotals[subRegion].first : 0.0;
+}
+
+double LoopStatistics::getTotalIterations(unsigned region, unsigned subRegion) const {
+  const auto& subRegionTotals = regions[region].subRegionTotals;
+  return subRegion < subRegionTotals.size() ? subRegionTotals[subRegion].second : 0.0;
+}
+
 void LoopStatistics::reset() {
   for (auto& region : regions) {
     region.times.resize(0);
     region.variables = StatisticVariables();
-    // (region.begin is not reset)
+    region.subRegionTotals.clear();
   }
 }
 
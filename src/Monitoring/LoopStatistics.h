@@ -46,8 +46,10 @@
 #include <cassert>
 #include <fstream>
 #include <iomanip>
+#include <mutex>
 #include <time.h>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace seissol {
@@ -59,9 +61,11 @@ class LoopStatistics {
 
   [[nodiscard]] unsigned getRegion(const std::string& name) const;
 
-  void begin(unsigned region);
+  // returns the start time, to be passed to end(); s.t. concurrently advanced clusters (and
+  // tasks of other clusters run by the same thread) do not overwrite each other
+  [[nodiscard]] static timespec begin();
 
-  void end(unsigned region, unsigned numIterations, unsigned subRegion);
+  void end(unsigned region, timespec begin, unsigned numIterations, unsigned subRegion);
 
   void addSample(
       unsigned region, unsigned numIterations, unsigned subRegion, timespec begin, timespec end);
@@ -70,6 +74,15 @@ class LoopStatistics {
 
   void printSummary(MPI_Comm comm);
 
+  [[nodiscard]] double getTotalTime(unsigned region) const;
+
+  [[nodiscard]] double getTotalIterations(unsigned region) const;
+
+  // totals restricted to one sub region (i.e. the profiling id of a cluster)
+  [[nodiscard]] double getTotalTime(unsigned region, unsigned subRegion) const;
+
+  [[nodiscard]] double getTotalIterations(unsigned region, unsigned subRegion) const;
+
   void writeSamples(const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn);
 
   private:
@@ -93,13 +106,15 @@ class LoopStatistics {
     std::string name;
     std::vector<Sample> times;
     bool includeInSummary;
-    timespec begin{};
     StatisticVariables variables;
+    // (time, iterations) per sub region
+    std::vector<std::pair<double, double>> subRegionTotals;
 
     Region(const std::string& name, bool includeInSummary);
   };
 
   std::vector<Region> regions;
+  std::mutex sampleMutex;
   bool outputSamples = false;
 };
 } // namespace seissol
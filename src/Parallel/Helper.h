@@ -1,6 +1,7 @@
 #ifndef SEISSOL_PARALLEL_HELPER_HPP_
 #define SEISSOL_PARALLEL_HELPER_HPP_
 
+#include "Kernels/Precision.h"
 #include "utils/env.h"
 
 #ifdef ACL_DEVICE
@@ -38,6 +39,176 @@ void printPersistentMpiInfo(const T& mpiBasic) {
   }
 }
 
+inline bool useSinglePrecisionMpi() {
+#ifdef ACL_DEVICE
+  // the regions are converted on the host
+  return false;
+#else
+  return sizeof(real) > sizeof(float) &&
+         utils::Env::get<bool>("SEISSOL_MPI_SINGLE_PRECISION", false);
+#endif
+}
+
+template <typename T>
+void printSinglePrecisionMpiInfo(const T& mpiBasic) {
+  if (useSinglePrecisionMpi()) {
+    logInfo(mpiBasic.rank()) << "Transferring the ghost and copy regions in single precision.";
+  }
+}
+
+inline bool useMessageAggregation() {
+#ifdef ACL_DEVICE
+  // the regions are packed on the host
+  return false;
+#else
+  return utils::Env::get<bool>("SEISSOL_MPI_AGGREGATE", false);
+#endif
+}
+
+template <typename T>
+void printMessageAggregationInfo(const T& mpiBasic) {
+  if (useMessageAggregation()) {
+    logInfo(mpiBasic.rank()) << "Packing the messages of all time clusters to the same rank.";
+  }
+}
+
+// The task-based scheduler, the fused sweep and the early integration of copy regions only drive
+// host clusters; hence, they are disabled for GPUs.
+
+inline bool useTaskScheduler() {
+#ifdef ACL_DEVICE
+  return false;
+#else
+  return utils::Env::get<bool>("SEISSOL_TASK_SCHEDULER", false);
+#endif
+}
+
+inline int taskGrainSize() { return utils::Env::get<int>("SEISSOL_TASK_GRAINSIZE", 0); }
+
+template <typename T>
+void printTaskSchedulerInfo(const T& mpiBasic) {
+  if (useTaskScheduler()) {
+    logInfo(mpiBasic.rank()) << "Using the task-based scheduler for advancing the time clusters.";
+  } else {
+    logInfo(mpiBasic.rank()) << "Using the actor loop for advancing the time clusters.";
+  }
+}
+
+inline bool useFusedSweep() {
+#ifdef ACL_DEVICE
+  return false;
+#else
+  return utils::Env::get<bool>("SEISSOL_FUSED_SWEEP", false);
+#endif
+}
+
+inline int fusedSweepBlockCells() { return utils::Env::get<int>("SEISSOL_FUSED_BLOCK_CELLS", 0); }
+
+template <typename T>
+void printFusedSweepInfo(const T& mpiBasic) {
+  if (useFusedSweep()) {
+    logInfo(mpiBasic.rank()) << "Fusing the local and neighbor integration sweeps where possible.";
+  }
+}
+
+inline bool useFrictionFaceBatches() {
+  return utils::Env::get<bool>("SEISSOL_DR_FACE_BATCHES", false);
+}
+
+template <typename T>
+void printFrictionFaceBatchesInfo(const T& mpiBasic) {
+  if (useFrictionFaceBatches()) {
+    logInfo(mpiBasic.rank())
+        << "Solving the rate-and-state friction laws for batches of faces on the CPU.";
+  }
+}
+
+inline bool usePlasticityCellBlocks() {
+#ifdef ACL_DEVICE
+  // the device kernel handles all cells of a layer at once already
+  return false;
+#else
+  return utils::Env::get<bool>("SEISSOL_PLASTICITY_BLOCKS", false);
+#endif
+}
+
+template <typename T>
+void printPlasticityCellBlocksInfo(const T& mpiBasic) {
+  if (usePlasticityCellBlocks()) {
+    logInfo(mpiBasic.rank()) << "Checking the plastic yield criterion for blocks of cells.";
+  }
+}
+
+inline bool useCopyRegionIntegration() {
+#ifdef ACL_DEVICE
+  return false;
+#else
+  return utils::Env::get<bool>("SEISSOL_COPY_REGIONS", false);
+#endif
+}
+
+template <typename T>
+void printCopyRegionIntegrationInfo(const T& mpiBasic) {
+  if (useCopyRegionIntegration()) {
+    logInfo(mpiBasic.rank())
+        << "Integrating the copy regions as soon as their ghost regions have been received.";
+  }
+}
+
+inline bool useNumaPlacement() {
+#if defined(USE_NUMA_AWARE_PINNING) && !defined(ACL_DEVICE)
+  // the placement follows the static chunks of the cell loops; the task-based scheduler and the
+  // fused sweep distribute the cells differently
+  return utils::Env::get<bool>("SEISSOL_NUMA_PLACEMENT", false) && !useTaskScheduler() &&
+         !useFusedSweep();
+#else
+  // needs libnuma; on GPUs, the cell data lives on the device
+  return false;
+#endif
+}
+
+template <typename T>
+void printNumaPlacementInfo(const T& mpiBasic) {
+  if (useNumaPlacement()) {
+    logInfo(mpiBasic.rank())
+        << "Binding the cell data to the NUMA nodes of the OpenMP threads processing it.";
+  } else if (utils::Env::get<bool>("SEISSOL_NUMA_PLACEMENT", false) &&
+             (useTaskScheduler() || useFusedSweep())) {
+    logWarning(mpiBasic.rank())
+        << "The NUMA placement is disabled: the task-based scheduler and the fused sweep do not "
+           "process the cells in the static chunks the placement is based on.";
+  }
+}
+
+inline bool useAsyncEnergyOutput() {
+  return utils::Env::get<bool>("SEISSOL_ENERGY_OUTPUT_ASYNC", false);
+}
+
+template <typename T>
+void printAsyncEnergyOutputInfo(const T& mpiBasic) {
+  if (useAsyncEnergyOutput()) {
+    logInfo(mpiBasic.rank())
+        << "Reducing the energies in the background; they are reported one output interval late.";
+  }
+}
+
+inline bool useSyncFreeOutput() {
+#if defined(ACL_DEVICE) || defined(USE_STP)
+  // the clusters sample the output with the host Taylor expansion of the time derivatives
+  return false;
+#else
+  return utils::Env::get<bool>("SEISSOL_SYNC_FREE_OUTPUT", false);
+#endif
+}
+
+template <typename T>
+void printSyncFreeOutputInfo(const T& mpiBasic) {
+  if (useSyncFreeOutput()) {
+    logInfo(mpiBasic.rank())
+        << "Sampling the wave field output in the time clusters, without synchronizing them.";
+  }
+}
+
 #ifdef ACL_DEVICE
 inline bool useUSM() {
   return utils::Env::get<bool>("SEISSOL_USM",
@@ -0,0 +1,257 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "NumaPlacement.h"
+
+#include "Initializer/MemoryAllocator.h"
+#include "Numerical/Statistics.h"
+#include "Parallel/MPI.h"
+#include "Parallel/Runtime/ParallelFor.h"
+#include "utils/logger.h"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#ifdef USE_NUMA_AWARE_PINNING
+#include <numa.h>
+#include <numaif.h>
+#include <sched.h>
+#endif
+
+namespace {
+#ifdef USE_NUMA_AWARE_PINNING
+// numa_hit, numa_miss, local_node, other_node (in pages), summed over all nodes of this machine
+std::array<std::uint64_t, 4> readNodeCounters() {
+  std::array<std::uint64_t, 4> counters{};
+  for (int node = 0; node <= numa_max_node(); ++node) {
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/numastat");
+    std::string name;
+    std::uint64_t value = 0;
+    while (file >> name >> value) {
+      if (name == "numa_hit") {
+        counters[0] += value;
+      } else if (name == "numa_miss") {
+        counters[1] += value;
+      } else if (name == "local_node") {
+        counters[2] += value;
+      } else if (name == "other_node") {
+        counters[3] += value;
+      }
+    }
+  }
+  return counters;
+}
+#endif
+} // namespace
+
+namespace seissol::parallel {
+
+void NumaPlacement::init() {
+#if defined(USE_NUMA_AWARE_PINNING) && defined(_OPENMP)
+  const auto rank = MPI::mpi.rank();
+  if (numa_available() < 0) {
+    logWarning(rank) << "NUMA is not available; the cell data is placed by first touch.";
+    return;
+  }
+
+  std::vector<int> nodes(omp_get_max_threads(), -1);
+#pragma omp parallel default(none) shared(nodes)
+  {
+    cpu_set_t worker;
+    CPU_ZERO(&worker);
+    sched_getaffinity(0, sizeof(cpu_set_t), &worker);
+    int node = -1;
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &worker)) {
+        const int cpuNode = numa_node_of_cpu(cpu);
+        // -2 marks threads which may run on more than one node
+        node = (node == -1 || node == cpuNode) ? cpuNode : -2;
+      }
+    }
+    nodes[omp_get_thread_num()] = node;
+  }
+
+  if (std::any_of(nodes.begin(), nodes.end(), [](int node) { return node < 0; })) {
+    logWarning(rank) << "Not all OpenMP threads are pinned to a single NUMA node; the cell data "
+                        "is placed by first touch.";
+    return;
+  }
+
+  threadNodes = nodes;
+  pageSize = numa_pagesize();
+  const auto numNodes = std::set<int>(nodes.begin(), nodes.end()).size();
+  logInfo(rank) << "Placing the cell data on the" << numNodes
+                << "NUMA node(s) of the OpenMP threads.";
+#endif
+}
+
+void NumaPlacement::place(void* data, std::size_t count, std::size_t elementSize) {
+  if (!enabled() || data == nullptr || count == 0) {
+    return;
+  }
+
+  // neighboring threads on the same node share one slice
+  auto* begin = static_cast<char*>(data);
+  std::size_t sliceBegin = 0;
+  int sliceNode = threadNodes[0];
+  for (std::size_t thread = 1; thread < threadNodes.size(); ++thread) {
+    if (threadNodes[thread] != sliceNode) {
+      const auto chunk = runtime::staticChunk(count, thread, threadNodes.size());
+      bind(begin + sliceBegin * elementSize, begin + chunk.begin * elementSize, sliceNode);
+      sliceBegin = chunk.begin;
+      sliceNode = threadNodes[thread];
+    }
+  }
+  bind(begin + sliceBegin * elementSize, begin + count * elementSize, sliceNode);
+}
+
+void NumaPlacement::place(void* const* elements, std::size_t count, std::size_t elementSize) {
+  if (!enabled() || elements == nullptr || count == 0) {
+    return;
+  }
+
+  // the elements of consecutive cells are mostly adjacent in memory; we bind them in runs
+  char* runBegin = nullptr;
+  char* runEnd = nullptr;
+  int runNode = -1;
+  for (std::size_t thread = 0; thread < threadNodes.size(); ++thread) {
+    const auto chunk = runtime::staticChunk(count, thread, threadNodes.size());
+    const int node = threadNodes[thread];
+    for (std::size_t i = chunk.begin; i < chunk.end; ++i) {
+      auto* element = static_cast<char*>(elements[i]);
+      if (element == nullptr) {
+        continue;
+      }
+      if (element != runEnd || node != runNode) {
+        if (runBegin != nullptr) {
+          bind(runBegin, runEnd, runNode);
+        }
+        runBegin = element;
+        runNode = node;
+      }
+      runEnd = element + elementSize;
+    }
+  }
+  if (runBegin != nullptr) {
+    bind(runBegin, runEnd, runNode);
+  }
+}
+
+void NumaPlacement::bind(char* begin, char* end, int node) {
+#ifdef USE_NUMA_AWARE_PINNING
+  // bind whole pages of the memory at hand (e.g. the huge pages of an arena block); binding parts of
+  // a huge page would split it up again. A page shared by two ranges stays with the first one.
+  const auto rangePageSize = std::max(pageSize, memory::HugePageArena::pageSizeOf(begin));
+  const auto alignUp = [&](char* pointer) {
+    const auto address = reinterpret_cast<std::uintptr_t>(pointer);
+    return reinterpret_cast<char*>((address + rangePageSize - 1) / rangePageSize * rangePageSize);
+  };
+  auto* pageBegin = alignUp(begin);
+  auto* pageEnd = alignUp(end);
+  if (pageBegin >= pageEnd) {
+    return;
+  }
+
+  // MPOL_MF_MOVE also moves pages which have been touched already (e.g. reused heap memory)
+  bitmask* nodeMask = numa_allocate_nodemask();
+  numa_bitmask_setbit(nodeMask, node);
+  const long result = mbind(pageBegin,
+                            pageEnd - pageBegin,
+                            MPOL_PREFERRED,
+                            nodeMask->maskp,
+                            nodeMask->size + 1,
+                            MPOL_MF_MOVE);
+  const int error = errno;
+  numa_bitmask_free(nodeMask);
+  if (result != 0) {
+    if (!bindFailed) {
+      logWarning() << "Could not bind" << (pageEnd - pageBegin) << "bytes to NUMA node" << node
+                   << ":" << std::strerror(error)
+                   << "; the pages stay where they are (further failures are not reported).";
+      bindFailed = true;
+    }
+    return;
+  }
+
+  if (!ranges.empty() && ranges.back().end == pageBegin && ranges.back().node == node &&
+      ranges.back().pageSize == rangePageSize) {
+    ranges.back().end = pageEnd;
+  } else {
+    ranges.push_back(Range{pageBegin, pageEnd, node, rangePageSize});
+  }
+#endif
+}
+
+void NumaPlacement::startCounters() {
+#ifdef USE_NUMA_AWARE_PINNING
+  if (numa_available() >= 0) {
+    counters = readNodeCounters();
+  }
+#endif
+}
+
+void NumaPlacement::printSummary() const {
+#ifdef USE_NUMA_AWARE_PINNING
+  const auto rank = MPI::mpi.rank();
+
+  // sample the placed pages and ask the kernel where they actually reside
+  constexpr std::size_t MaxSamples = 1 << 16;
+  std::size_t numPages = 0;
+  for (const auto& range : ranges) {
+    numPages += (range.end - range.begin) / range.pageSize;
+  }
+  const auto pageStride = std::max<std::size_t>(1, numPages / MaxSamples);
+  std::vector<void*> pages;
+  std::vector<int> expected;
+  for (const auto& range : ranges) {
+    const auto stride = pageStride * range.pageSize;
+    for (char* page = range.begin; page < range.end; page += stride) {
+      pages.push_back(page);
+      expected.push_back(range.node);
+    }
+  }
+  std::vector<int> status(pages.size(), -1);
+  std::size_t localPages = 0;
+  if (!pages.empty() &&
+      numa_move_pages(0, pages.size(), pages.data(), nullptr, status.data(), 0) == 0) {
+    for (std::size_t i = 0; i < pages.size(); ++i) {
+      localPages += status[i] == expected[i] ? 1 : 0;
+    }
+  }
+  const double localShare = pages.empty() ? 0.0 : 100.0 * localPages / pages.size();
+
+  std::array<std::uint64_t, 4> delta{};
+  if (numa_available() >= 0) {
+    const auto current = readNodeCounters();
+    for (std::size_t i = 0; i < delta.size(); ++i) {
+      delta[i] = current[i] - counters[i];
+    }
+  }
+  const auto share = [](std::uint64_t part, std::uint64_t rest) {
+    return part + rest == 0 ? 0.0 : 100.0 * part / (part + rest);
+  };
+
+  const auto placed = statistics::parallelSummary(localShare);
+  const auto misses = statistics::parallelSummary(share(delta[1], delta[0]));
+  const auto remote = statistics::parallelSummary(share(delta[3], delta[2]));
+  logInfo(rank) << "Placed cell data on the NUMA node of its threads (% of the pages): mean ="
+                << placed.mean << " min =" << placed.min << " max =" << placed.max;
+  logInfo(rank) << "NUMA node counters during the simulation (% of the allocated pages):"
+                << "misses: mean =" << misses.mean << " max =" << misses.max
+                << "; from other nodes: mean =" << remote.mean << " max =" << remote.max;
+#endif
+}
+
+} // namespace seissol::parallel
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_PARALLEL_NUMAPLACEMENT_H_
+#define SEISSOL_SRC_PARALLEL_NUMAPLACEMENT_H_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace seissol::parallel {
+
+/**
+ * Places the pages of the cell data on the NUMA nodes of the OpenMP threads which process them.
+ *
+ * The cell loops outside of the task-based scheduler run in static chunks (cf.
+ * runtime::parallelFor), i.e. thread t always processes the cells staticChunk(count, t, threads)
+ * of a layer. Hence, the data of a layer is split into one slice per NUMA node, and each slice is
+ * bound to the node of the threads working on it, independent of which thread touches it first.
+ * The task-based scheduler and the fused sweep do not follow these chunks; hence, the placement is
+ * disabled with them (cf. useNumaPlacement).
+ *
+ * Requires the OpenMP threads to be pinned to one NUMA node each; otherwise (and without
+ * libnuma support) all functions do nothing.
+ */
+class NumaPlacement {
+  public:
+  /**
+   * Determines the NUMA node of each OpenMP thread. Needs to be called outside of any parallel
+   * region, with the same number of threads as the cell loops.
+   */
+  void init();
+
+  [[nodiscard]] bool enabled() const { return !threadNodes.empty(); }
+
+  /**
+   * Binds count consecutive elements of elementSize bytes each, starting at data.
+   */
+  void place(void* data, std::size_t count, std::size_t elementSize);
+
+  /**
+   * Same as above, but for elements which are given by a pointer each (or nullptr, if absent),
+   * e.g. the buffers and derivatives of the cells.
+   */
+  void place(void* const* elements, std::size_t count, std::size_t elementSize);
+
+  /**
+   * Starts the NUMA node counters for the summary.
+   */
+  void startCounters();
+
+  /**
+   * Prints the share of the placed pages which reside on their node, and the node counters
+   * since startCounters(). (collective)
+   */
+  void printSummary() const;
+
+  private:
+  struct Range {
+    char* begin;
+    char* end;
+    int node;
+    std::size_t pageSize;
+  };
+
+  void bind(char* begin, char* end, int node);
+
+  std::vector<int> threadNodes;
+  std::vector<Range> ranges;
+  //! base page size; the huge pages of the arenas are bound as a whole (cf. bind)
+  std::size_t pageSize{4096};
+  bool bindFailed{false};
+
+  // numa_hit, numa_miss, local_node, other_node; summed over all nodes
+  std::array<std::uint64_t, 4> counters{};
+};
+
+} // namespace seissol::parallel
+
+#endif // SEISSOL_SRC_PARALLEL_NUMAPLACEMENT_H_
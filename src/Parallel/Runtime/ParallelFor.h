@@ -0,0 +1,149 @@
+#ifndef SEISSOL_PARALLEL_RUNTIME_PARALLELFOR_HPP
+#define SEISSOL_PARALLEL_RUNTIME_PARALLELFOR_HPP
+
+#include "Parallel/Helper.h"
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+namespace seissol::parallel::runtime {
+
+struct StaticChunk {
+  std::size_t begin;
+  std::size_t end;
+};
+
+/**
+ * Returns the iterations [begin, end) which thread `thread` out of `numThreads` runs in a
+ * statically scheduled loop over count iterations.
+ *
+ * The first count % numThreads threads run one iteration more than the others. The cell data is
+ * placed on the NUMA nodes according to these chunks (cf. NumaPlacement).
+ */
+inline StaticChunk staticChunk(std::size_t count, std::size_t thread, std::size_t numThreads) {
+  const auto quotient = count / numThreads;
+  const auto remainder = count % numThreads;
+  const auto begin = thread * quotient + std::min(thread, remainder);
+  return StaticChunk{begin, begin + quotient + (thread < remainder ? 1 : 0)};
+}
+
+#ifdef _OPENMP
+inline std::size_t taskGrainSize(std::size_t count) {
+  const int userGrainSize = seissol::taskGrainSize();
+  if (userGrainSize > 0) {
+    return static_cast<std::size_t>(userGrainSize);
+  }
+  // a few tasks per thread, s.t. idle threads have something to steal
+  const auto numTasks = static_cast<std::size_t>(4 * omp_get_num_threads());
+  return std::max<std::size_t>(1, count / numTasks);
+}
+#endif
+
+/**
+ * Calls handler(i) for all i in [0, count).
+ *
+ * Outside of a parallel region, this is a statically scheduled OpenMP loop, with the chunks given
+ * by staticChunk.
+ * Inside a parallel region (i.e. when called from the task-based time cluster scheduler),
+ * the range is split into tasks instead; idle threads of the team may then steal them.
+ */
+template <typename F>
+void parallelFor(std::size_t count, F&& handler) {
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+    const auto grainSize = taskGrainSize(count);
+#pragma omp taskloop default(shared) grainsize(grainSize)
+    for (std::size_t i = 0; i < count; ++i) {
+      handler(i);
+    }
+  } else {
+#pragma omp parallel
+    {
+      const auto chunk = staticChunk(count, omp_get_thread_num(), omp_get_num_threads());
+      for (std::size_t i = chunk.begin; i < chunk.end; ++i) {
+        handler(i);
+      }
+    }
+  }
+#else
+  for (std::size_t i = 0; i < count; ++i) {
+    handler(i);
+  }
+#endif
+}
+
+/**
+ * Same as parallelFor, but sums up the values returned by handler(i).
+ *
+ * Arithmetic types are summed with an OpenMP reduction. Other types (e.g. a struct of several
+ * sums) only need a default constructor for zero and +=; their partial sums per thread or task are
+ * added up in a fixed order.
+ */
+template <typename T, typename F>
+T parallelForSum(std::size_t count, F&& handler) {
+  T sum{};
+#ifdef _OPENMP
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (omp_in_parallel()) {
+      const auto grainSize = taskGrainSize(count);
+#pragma omp taskloop default(shared) grainsize(grainSize) reduction(+ : sum)
+      for (std::size_t i = 0; i < count; ++i) {
+        sum += handler(i);
+      }
+    } else {
+#pragma omp parallel reduction(+ : sum)
+      {
+        const auto chunk = staticChunk(count, omp_get_thread_num(), omp_get_num_threads());
+        for (std::size_t i = chunk.begin; i < chunk.end; ++i) {
+          sum += handler(i);
+        }
+      }
+    }
+  } else {
+    std::vector<T> partialSums;
+    if (omp_in_parallel()) {
+      const auto grainSize = taskGrainSize(count);
+      const auto numTasks = (count + grainSize - 1) / grainSize;
+      partialSums.resize(numTasks);
+      for (std::size_t task = 0; task < numTasks; ++task) {
+#pragma omp task default(shared) firstprivate(task)
+        {
+          const auto end = std::min(count, (task + 1) * grainSize);
+          for (std::size_t i = task * grainSize; i < end; ++i) {
+            partialSums[task] += handler(i);
+          }
+        }
+      }
+#pragma omp taskwait
+    } else {
+      partialSums.resize(omp_get_max_threads());
+#pragma omp parallel
+      {
+        const auto chunk = staticChunk(count, omp_get_thread_num(), omp_get_num_threads());
+        T partialSum{};
+        for (std::size_t i = chunk.begin; i < chunk.end; ++i) {
+          partialSum += handler(i);
+        }
+        partialSums[omp_get_thread_num()] = partialSum;
+      }
+    }
+    for (const auto& partialSum : partialSums) {
+      sum += partialSum;
+    }
+  }
+#else
+  for (std::size_t i = 0; i < count; ++i) {
+    sum += handler(i);
+  }
+#endif
+  return sum;
+}
+
+} // namespace seissol::parallel::runtime
+
+#endif
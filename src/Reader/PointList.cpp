@@ -0,0 +1,78 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "PointList.h"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+#include "Parallel/MPI.h"
+#include "utils/logger.h"
+
+namespace {
+constexpr std::array<char, 8> Magic = {'S', 'S', 'P', 'N', 'T', 'S', '0', '1'};
+
+// the points are read and written as one block of coordinates
+static_assert(sizeof(Eigen::Vector3d) == 3 * sizeof(double));
+} // namespace
+
+namespace seissol::reader {
+
+void writeBinaryPointList(std::ostream& stream, const std::vector<Eigen::Vector3d>& points) {
+  stream.write(Magic.data(), Magic.size());
+  const auto count = static_cast<std::uint64_t>(points.size());
+  stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+  stream.write(reinterpret_cast<const char*>(points.data()),
+               static_cast<std::streamsize>(sizeof(Eigen::Vector3d) * points.size()));
+}
+
+std::optional<std::vector<Eigen::Vector3d>> readBinaryPointList(std::istream& stream) {
+  std::array<char, Magic.size()> magic{};
+  stream.read(magic.data(), magic.size());
+  if (!stream || magic != Magic) {
+    return std::nullopt;
+  }
+  std::uint64_t count = 0;
+  stream.read(reinterpret_cast<char*>(&count), sizeof(count));
+  std::vector<Eigen::Vector3d> points(count);
+  stream.read(reinterpret_cast<char*>(points.data()),
+              static_cast<std::streamsize>(sizeof(Eigen::Vector3d) * count));
+  if (!stream) {
+    logError() << "The binary point list is truncated; expected" << count << "points.";
+  }
+  return points;
+}
+
+std::vector<Eigen::Vector3d> readPointList(const std::string& fileName,
+                                           const TextPointListReader& readText) {
+  const auto rank = seissol::MPI::mpi.rank();
+
+  // flat coordinates, for the broadcast
+  std::vector<double> coordinates;
+  if (rank == 0) {
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file) {
+      logError() << "Could not open the point list" << fileName;
+    }
+    auto points = readBinaryPointList(file);
+    if (!points.has_value()) {
+      file.close();
+      points = readText(fileName);
+    }
+    coordinates.resize(3 * points->size());
+    std::memcpy(coordinates.data(), points->data(), sizeof(double) * coordinates.size());
+  }
+
+#ifdef USE_MPI
+  seissol::MPI::mpi.broadcastContainer(coordinates, 0);
+#endif
+
+  std::vector<Eigen::Vector3d> points(coordinates.size() / 3);
+  std::memcpy(points.data(), coordinates.data(), sizeof(double) * coordinates.size());
+  return points;
+}
+
+} // namespace seissol::reader
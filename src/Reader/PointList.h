@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_READER_POINTLIST_H_
+#define SEISSOL_SRC_READER_POINTLIST_H_
+
+#include <Eigen/Dense>
+#include <functional>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace seissol::reader {
+
+/**
+ * Binary point list, e.g. for receivers or fault pick points.
+ *
+ * Layout (native byte order):
+ * - the magic string "SSPNTS01"
+ * - the number of points as 64 bit unsigned integer
+ * - the three coordinates (as double) of each point
+ */
+void writeBinaryPointList(std::ostream& stream, const std::vector<Eigen::Vector3d>& points);
+
+/**
+ * Returns std::nullopt if the stream does not start with the magic string of a binary point list.
+ */
+std::optional<std::vector<Eigen::Vector3d>> readBinaryPointList(std::istream& stream);
+
+using TextPointListReader = std::function<std::vector<Eigen::Vector3d>(const std::string&)>;
+
+/**
+ * Reads a point list on rank 0, and broadcasts it to all other ranks; collective.
+ *
+ * Binary point lists are recognized by their magic string; other files are read with readText.
+ */
+std::vector<Eigen::Vector3d> readPointList(const std::string& fileName,
+                                           const TextPointListReader& readText);
+
+} // namespace seissol::reader
+
+#endif // SEISSOL_SRC_READER_POINTLIST_H_
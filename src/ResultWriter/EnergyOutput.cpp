@@ -3,7 +3,9 @@
 #include "DynamicRupture/Misc.h"
 #include "Kernels/DynamicRupture.h"
 #include "Numerical/Quadrature.h"
+#include "Parallel/Helper.h"
 #include "Parallel/MPI.h"
+#include "Parallel/Runtime/ParallelFor.h"
 #include "SeisSol.h"
 #include <Common/Constants.h>
 #include <Geometry/MeshDefinition.h>
@@ -32,6 +34,7 @@
 #include <kernel.h>
 #include <limits>
 #include <mpi.h>
+#include <mutex>
 #include <ostream>
 #include <string>
 #include <tensor.h>
@@ -69,6 +72,26 @@ double& EnergiesStorage::totalMomentumX() { return energies[10]; }
 double& EnergiesStorage::totalMomentumY() { return energies[11]; }
 double& EnergiesStorage::totalMomentumZ() { return energies[12]; }
 
+EnergiesStorage& EnergiesStorage::operator+=(const EnergiesStorage& other) {
+  for (std::size_t i = 0; i < energies.size(); ++i) {
+    energies[i] += other.energies[i];
+  }
+  return *this;
+}
+
+std::vector<unsigned> computePrimaryMeshIds(const unsigned* ltsToMesh,
+                                            std::size_t numberOfCells,
+                                            const unsigned* meshToLts) {
+  std::vector<unsigned> primaryMeshIds(numberOfCells);
+  for (std::size_t ltsId = 0; ltsId < numberOfCells; ++ltsId) {
+    const auto meshId = ltsToMesh[ltsId];
+    const bool isPrimary =
+        meshId != std::numeric_limits<unsigned>::max() && meshToLts[meshId] == ltsId;
+    primaryMeshIds[ltsId] = isPrimary ? meshId : std::numeric_limits<unsigned>::max();
+  }
+  return primaryMeshIds;
+}
+
 void EnergyOutput::init(
     GlobalData* newGlobal,
     seissol::initializer::DynamicRupture* newDynRup,
@@ -107,6 +130,14 @@ void EnergyOutput::init(
   ltsLut = newLtsLut;
 
   isPlasticityEnabled = newIsPlasticityEnabled;
+  isAsync = useAsyncEnergyOutput();
+
+#ifndef ACL_DEVICE
+  const auto mask = lts->dofs.mask;
+  primaryMeshIds = computePrimaryMeshIds(ltsLut->getLtsToMeshLut(mask),
+                                         ltsTree->getNumberOfCells(mask),
+                                         ltsLut->getMeshToLtsLut(mask)[0].data());
+#endif
 
 #ifdef ACL_DEVICE
   const auto maxCells = ltsTree->getMaxClusterSize();
@@ -126,6 +157,7 @@ void EnergyOutput::init(
 
   Modules::registerHook(*this, ModuleHook::SimulationStart);
   Modules::registerHook(*this, ModuleHook::SynchronizationPoint);
+  Modules::registerHook(*this, ModuleHook::SimulationEnd);
   setSyncInterval(parameters.interval);
 }
 
@@ -133,16 +165,91 @@ void EnergyOutput::syncPoint(double time) {
   assert(isEnabled);
   const auto rank = MPI::mpi.rank();
   logInfo(rank) << "Writing energy output at time" << time;
-  computeEnergies();
-  reduceEnergies();
-  if (isCheckAbortCriteraSlipRateEnabled) {
-    reduceMinTimeSinceSlipRateBelowThreshold();
+  // the reduction of the previous output has been running in the background since then
+  finishOutput();
+  computeEnergies(time);
+  startReduction(time, outputId);
+  if (!isAsync) {
+    finishOutput();
   }
-  if ((rank == 0) && isCheckAbortCriteraMomentRateEnabled) {
+  ++outputId;
+  logInfo(rank) << "Writing energy output at time" << time << "Done.";
+}
+
+void EnergyOutput::startReduction(double time, int id) {
+  isOutputPending = true;
+  pendingTime = time;
+  pendingOutputId = id;
+
+  reductionBuffer = energiesStorage.energies;
+  reducedMinTimeSinceSlipRateBelowThreshold = minTimeSinceSlipRateBelowThreshold;
+
+#ifdef USE_MPI
+  const auto rank = MPI::mpi.rank();
+  const auto& comm = MPI::mpi.comm();
+
+  if (isAsync) {
+    // all ranks receive the reduced values and evaluate the abort criteria themselves, s.t. they
+    // stop at the same synchronization point without another round of communication
+    MPI_Iallreduce(MPI_IN_PLACE,
+                   reductionBuffer.data(),
+                   static_cast<int>(reductionBuffer.size()),
+                   MPI_DOUBLE,
+                   MPI_SUM,
+                   comm,
+                   &requests[0]);
+    if (isCheckAbortCriteraSlipRateEnabled) {
+      MPI_Iallreduce(MPI_IN_PLACE,
+                     &reducedMinTimeSinceSlipRateBelowThreshold,
+                     1,
+                     MPI_C_REAL,
+                     MPI_MIN,
+                     comm,
+                     &requests[1]);
+    }
+  } else {
+    MPI_Ireduce(rank == 0 ? MPI_IN_PLACE : reductionBuffer.data(),
+                reductionBuffer.data(),
+                static_cast<int>(reductionBuffer.size()),
+                MPI_DOUBLE,
+                MPI_SUM,
+                0,
+                comm,
+                &requests[0]);
+    if (isCheckAbortCriteraSlipRateEnabled) {
+      MPI_Ireduce(rank == 0 ? MPI_IN_PLACE : &reducedMinTimeSinceSlipRateBelowThreshold,
+                  &reducedMinTimeSinceSlipRateBelowThreshold,
+                  1,
+                  MPI_C_REAL,
+                  MPI_MIN,
+                  0,
+                  comm,
+                  &requests[1]);
+    }
+  }
+#endif
+}
+
+void EnergyOutput::finishOutput() {
+  if (!isOutputPending) {
+    return;
+  }
+  isOutputPending = false;
+
+#ifdef USE_MPI
+  MPI_Waitall(static_cast<int>(requests.size()), requests.data(), MPI_STATUSES_IGNORE);
+#endif
+  energiesStorage.energies = reductionBuffer;
+  minTimeSinceSlipRateBelowThreshold = reducedMinTimeSinceSlipRateBelowThreshold;
+
+  // with the asynchronous output, every rank has the reduced values; otherwise, only rank 0
+  const auto rank = MPI::mpi.rank();
+  const bool hasReducedValues = isAsync || rank == 0;
+  if (hasReducedValues && isCheckAbortCriteraMomentRateEnabled) {
     const double seismicMomentRate =
         (energiesStorage.seismicMoment() - seismicMomentPrevious) / energyOutputInterval;
     seismicMomentPrevious = energiesStorage.seismicMoment();
-    if (time > 0 && seismicMomentRate < terminatorMomentRateThreshold) {
+    if (pendingTime > 0 && seismicMomentRate < terminatorMomentRateThreshold) {
       minTimeSinceMomentRateBelowThreshold += energyOutputInterval;
     } else {
       minTimeSinceMomentRateBelowThreshold = 0.0;
@@ -150,20 +257,30 @@ void EnergyOutput::syncPoint(double time) {
   }
 
   if (isTerminalOutputEnabled) {
-    printEnergies();
+    printEnergies(pendingOutputId);
+  }
+  bool abort = false;
+  if (hasReducedValues && isCheckAbortCriteraSlipRateEnabled) {
+    abort = checkAbortCriterion(minTimeSinceSlipRateBelowThreshold, "All slip-rate are") || abort;
   }
-  if (isCheckAbortCriteraSlipRateEnabled) {
-    checkAbortCriterion(minTimeSinceSlipRateBelowThreshold, "All slip-rate are");
+  if (hasReducedValues && isCheckAbortCriteraMomentRateEnabled) {
+    abort = checkAbortCriterion(minTimeSinceMomentRateBelowThreshold,
+                                "The seismic moment rate is") ||
+            abort;
   }
-  if (isCheckAbortCriteraMomentRateEnabled) {
-    checkAbortCriterion(minTimeSinceMomentRateBelowThreshold, "The seismic moment rate is");
+  if (!isAsync && (isCheckAbortCriteraSlipRateEnabled || isCheckAbortCriteraMomentRateEnabled)) {
+#ifdef USE_MPI
+    const auto& comm = MPI::mpi.comm();
+    MPI_Bcast(reinterpret_cast<void*>(&abort), 1, MPI_CXX_BOOL, 0, comm);
+#endif
+  }
+  if (abort) {
+    seissolInstance.simulator().abort();
   }
 
   if (isFileOutputEnabled) {
-    writeEnergies(time);
+    writeEnergies(pendingTime, pendingOutputId);
   }
-  ++outputId;
-  logInfo(rank) << "Writing energy output at time" << time << "Done.";
 }
 
 void EnergyOutput::simulationStart() {
@@ -175,6 +292,39 @@ void EnergyOutput::simulationStart() {
   syncPoint(0.0);
 }
 
+void EnergyOutput::simulationEnd() {
+  if (isEnabled) {
+    finishOutput();
+  }
+}
+
+bool EnergyOutput::beginAccumulation(double time, double timeTolerance) {
+  if (!isEnabled || primaryMeshIds.empty() || !shouldComputeVolumeEnergies(outputId)) {
+    return false;
+  }
+  // the last synchronization point is forced at the end time
+  const auto endTime = seissolInstance.getSeisSolParameters().timeStepping.endTime;
+  if (std::abs(time - nextSynchronizationPoint()) >= timeTolerance &&
+      time < endTime - timeTolerance) {
+    return false;
+  }
+  accumulatedEnergies.energies.fill(0.0);
+  accumulationTime = time;
+  return true;
+}
+
+void EnergyOutput::accumulateVolumeEnergies(seissol::initializer::Layer& layer) {
+  if (layer.getNumberOfCells() == 0) {
+    return;
+  }
+  const auto offset = layer.var(lts->dofs) - ltsTree->var(lts->dofs);
+  EnergiesStorage layerEnergies{};
+  computeVolumeEnergies(primaryMeshIds.data() + offset, layer.getNumberOfCells(), layerEnergies);
+
+  const std::lock_guard lock(accumulationMutex);
+  accumulatedEnergies += layerEnergies;
+}
+
 EnergyOutput::~EnergyOutput() {
 #ifdef ACL_DEVICE
   if (timeDerivativePlusHost != nullptr) {
@@ -353,38 +503,32 @@ void EnergyOutput::computeDynamicRuptureEnergies() {
   }
 }
 
-void EnergyOutput::computeVolumeEnergies() {
-  // TODO: abstract energy calculation, and implement it for anisotropic and poroelastic
-  [[maybe_unused]] auto& totalGravitationalEnergyLocal = energiesStorage.gravitationalEnergy();
-  [[maybe_unused]] auto& totalAcousticEnergyLocal = energiesStorage.acousticEnergy();
-  [[maybe_unused]] auto& totalAcousticKineticEnergyLocal = energiesStorage.acousticKineticEnergy();
-  [[maybe_unused]] auto& totalMomentumX = energiesStorage.totalMomentumX();
-  [[maybe_unused]] auto& totalMomentumY = energiesStorage.totalMomentumY();
-  [[maybe_unused]] auto& totalMomentumZ = energiesStorage.totalMomentumZ();
-  [[maybe_unused]] auto& totalElasticEnergyLocal = energiesStorage.elasticEnergy();
-  [[maybe_unused]] auto& totalElasticKineticEnergyLocal = energiesStorage.elasticKineticEnergy();
-  [[maybe_unused]] auto& totalPlasticMoment = energiesStorage.plasticMoment();
-
+void EnergyOutput::computeVolumeEnergies(const unsigned* meshIds,
+                                         std::size_t count,
+                                         EnergiesStorage& storage) {
   const std::vector<Element>& elements = meshReader->getElements();
   const std::vector<Vertex>& vertices = meshReader->getVertices();
 
   [[maybe_unused]] const auto g = seissolInstance.getGravitationSetup().acceleration;
 
-  // Note: Default(none) is not possible, clang requires data sharing attribute for g, gcc forbids
-  // it
-#if defined(_OPENMP) && !NVHPC_AVOID_OMP
-#pragma omp parallel for schedule(static) reduction(+ : totalGravitationalEnergyLocal,             \
-                                                        totalAcousticEnergyLocal,                  \
-                                                        totalAcousticKineticEnergyLocal,           \
-                                                        totalElasticEnergyLocal,                   \
-                                                        totalElasticKineticEnergyLocal,            \
-                                                        totalMomentumX,                            \
-                                                        totalMomentumY,                            \
-                                                        totalMomentumZ,                            \
-                                                        totalPlasticMoment)                        \
-    shared(elements, vertices, lts, ltsLut, global)
-#endif
-  for (std::size_t elementId = 0; elementId < elements.size(); ++elementId) {
+  // (called by the time clusters as well; hence, the loop may run as tasks)
+  const auto cellEnergies = [&](std::size_t cell) {
+    EnergiesStorage energies{};
+    // TODO: abstract energy calculation, and implement it for anisotropic and poroelastic
+    [[maybe_unused]] auto& totalGravitationalEnergyLocal = energies.gravitationalEnergy();
+    [[maybe_unused]] auto& totalAcousticEnergyLocal = energies.acousticEnergy();
+    [[maybe_unused]] auto& totalAcousticKineticEnergyLocal = energies.acousticKineticEnergy();
+    [[maybe_unused]] auto& totalMomentumX = energies.totalMomentumX();
+    [[maybe_unused]] auto& totalMomentumY = energies.totalMomentumY();
+    [[maybe_unused]] auto& totalMomentumZ = energies.totalMomentumZ();
+    [[maybe_unused]] auto& totalElasticEnergyLocal = energies.elasticEnergy();
+    [[maybe_unused]] auto& totalElasticKineticEnergyLocal = energies.elasticKineticEnergy();
+    [[maybe_unused]] auto& totalPlasticMoment = energies.plasticMoment();
+
+    const std::size_t elementId = meshIds == nullptr ? cell : meshIds[cell];
+    if (elementId == std::numeric_limits<unsigned>::max()) {
+      return energies;
+    }
     const real volume = MeshTools::volume(elements[elementId], vertices);
     const CellMaterialData& material = ltsLut->lookup(lts->material, elementId);
 #if defined(USE_ELASTIC) || defined(USE_VISCOELASTIC2)
@@ -536,57 +680,32 @@ void EnergyOutput::computeVolumeEnergies() {
       const real mu = material.local.getMuBar();
       totalPlasticMoment += mu * volume * pstrainCell[tensor::QStress::size()];
     }
+    return energies;
+  };
+#if NVHPC_AVOID_OMP
+  for (std::size_t cell = 0; cell < count; ++cell) {
+    storage += cellEnergies(cell);
   }
-}
-
-void EnergyOutput::computeEnergies() {
-  energiesStorage.energies.fill(0.0);
-  if (shouldComputeVolumeEnergies()) {
-    computeVolumeEnergies();
-  }
-  computeDynamicRuptureEnergies();
-}
-
-void EnergyOutput::reduceEnergies() {
-#ifdef USE_MPI
-  const auto rank = MPI::mpi.rank();
-  const auto& comm = MPI::mpi.comm();
-
-  const auto count = static_cast<int>(energiesStorage.energies.size());
-  if (rank == 0) {
-    MPI_Reduce(MPI_IN_PLACE, energiesStorage.energies.data(), count, MPI_DOUBLE, MPI_SUM, 0, comm);
-  } else {
-    MPI_Reduce(energiesStorage.energies.data(),
-               energiesStorage.energies.data(),
-               count,
-               MPI_DOUBLE,
-               MPI_SUM,
-               0,
-               comm);
-  }
+#else
+  storage += seissol::parallel::runtime::parallelForSum<EnergiesStorage>(count, cellEnergies);
 #endif
 }
 
-void EnergyOutput::reduceMinTimeSinceSlipRateBelowThreshold() {
-#ifdef USE_MPI
-  const auto rank = MPI::mpi.rank();
-  const auto& comm = MPI::mpi.comm();
-
-  if (rank == 0) {
-    MPI_Reduce(MPI_IN_PLACE, &minTimeSinceSlipRateBelowThreshold, 1, MPI_C_REAL, MPI_MIN, 0, comm);
+void EnergyOutput::computeEnergies(double time) {
+  if (std::abs(time - accumulationTime) < seissolInstance.timeManager().getTimeTolerance()) {
+    // the clusters have accumulated the volume energies in their last correction step
+    energiesStorage = accumulatedEnergies;
   } else {
-    MPI_Reduce(&minTimeSinceSlipRateBelowThreshold,
-               &minTimeSinceSlipRateBelowThreshold,
-               1,
-               MPI_C_REAL,
-               MPI_MIN,
-               0,
-               comm);
+    energiesStorage.energies.fill(0.0);
+    if (shouldComputeVolumeEnergies(outputId)) {
+      computeVolumeEnergies(nullptr, meshReader->getElements().size(), energiesStorage);
+    }
   }
-#endif
+  accumulationTime = -std::numeric_limits<double>::infinity();
+  computeDynamicRuptureEnergies();
 }
 
-void EnergyOutput::printEnergies() {
+void EnergyOutput::printEnergies(int id) {
   const auto rank = MPI::mpi.rank();
 
   if (rank == 0) {
@@ -620,7 +739,7 @@ void EnergyOutput::printEnergies() {
       return std::abs(thresholdValue) > 1.e-20;
     };
 
-    if (shouldComputeVolumeEnergies()) {
+    if (shouldComputeVolumeEnergies(id)) {
       if (shouldPrint(totalElasticEnergy)) {
         logInfo(rank) << std::setprecision(outputPrecision)
                       << "Elastic energy (total, % kinematic, % potential): " << totalElasticEnergy
@@ -664,36 +783,28 @@ void EnergyOutput::printEnergies() {
     }
   }
 }
-void EnergyOutput::checkAbortCriterion(real timeSinceThreshold, const std::string& prefixMessage) {
+bool EnergyOutput::checkAbortCriterion(real timeSinceThreshold, const std::string& prefixMessage) {
   const auto rank = MPI::mpi.rank();
   bool abort = false;
-  if (rank == 0) {
-    if ((timeSinceThreshold > 0) and (timeSinceThreshold < std::numeric_limits<real>::max())) {
-      if (static_cast<double>(timeSinceThreshold) < terminatorMaxTimePostRupture) {
-        logInfo(rank) << prefixMessage.c_str() << "below threshold since" << timeSinceThreshold
-                      << "s (lower than the abort criteria: " << terminatorMaxTimePostRupture
-                      << "s)";
-      } else {
-        logInfo(rank) << prefixMessage.c_str() << "below threshold since" << timeSinceThreshold
-                      << "s (greater than the abort criteria: " << terminatorMaxTimePostRupture
-                      << "s)";
-        abort = true;
-      }
+  if ((timeSinceThreshold > 0) and (timeSinceThreshold < std::numeric_limits<real>::max())) {
+    if (static_cast<double>(timeSinceThreshold) < terminatorMaxTimePostRupture) {
+      logInfo(rank) << prefixMessage.c_str() << "below threshold since" << timeSinceThreshold
+                    << "s (lower than the abort criteria: " << terminatorMaxTimePostRupture
+                    << "s)";
+    } else {
+      logInfo(rank) << prefixMessage.c_str() << "below threshold since" << timeSinceThreshold
+                    << "s (greater than the abort criteria: " << terminatorMaxTimePostRupture
+                    << "s)";
+      abort = true;
     }
   }
-#ifdef USE_MPI
-  const auto& comm = MPI::mpi.comm();
-  MPI_Bcast(reinterpret_cast<void*>(&abort), 1, MPI_CXX_BOOL, 0, comm);
-#endif
-  if (abort) {
-    seissolInstance.simulator().abort();
-  }
+  return abort;
 }
 
 void EnergyOutput::writeHeader() { out << "time,variable,measurement" << std::endl; }
 
-void EnergyOutput::writeEnergies(double time) {
-  if (shouldComputeVolumeEnergies()) {
+void EnergyOutput::writeEnergies(double time, int id) {
+  if (shouldComputeVolumeEnergies(id)) {
     out << time << ",gravitational_energy," << energiesStorage.gravitationalEnergy() << "\n"
         << time << ",acoustic_energy," << energiesStorage.acousticEnergy() << "\n"
         << time << ",acoustic_kinetic_energy," << energiesStorage.acousticKineticEnergy() << "\n"
@@ -711,8 +822,8 @@ void EnergyOutput::writeEnergies(double time) {
       << time << ",plastic_moment," << energiesStorage.plasticMoment() << std::endl;
 }
 
-bool EnergyOutput::shouldComputeVolumeEnergies() const {
-  return outputId % computeVolumeEnergiesEveryOutput == 0;
+bool EnergyOutput::shouldComputeVolumeEnergies(int id) const {
+  return id % computeVolumeEnergiesEveryOutput == 0;
 }
 
 } // namespace seissol::writer
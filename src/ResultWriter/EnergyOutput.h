@@ -2,14 +2,24 @@
 #define ENERGYOUTPUT_H
 
 #include <array>
+#include <cstddef>
 #include <fstream>
 #include <iostream>
+#include <limits>
+#include <mutex>
 #include <string>
+#include <utility>
+#include <vector>
+
+#ifdef USE_MPI
+#include <mpi.h>
+#endif
 
 #include "Geometry/MeshReader.h"
 #include "Initializer/DynamicRupture.h"
 #include "Initializer/LTS.h"
 #include "Initializer/Tree/LTSTree.h"
+#include "Initializer/Tree/Layer.h"
 #include "Initializer/Tree/Lut.h"
 #include "Initializer/Typedefs.h"
 
@@ -47,8 +57,22 @@ struct EnergiesStorage {
   double& totalMomentumX();
   double& totalMomentumY();
   double& totalMomentumZ();
+
+  EnergiesStorage& operator+=(const EnergiesStorage& other);
 };
 
+/**
+ * Returns the mesh id of each cell, if the cell is the primary copy of its element, and an invalid
+ * id otherwise. (The copy layer may contain several cells of the same element; only one of them
+ * may contribute to the energies.)
+ *
+ * @param ltsToMesh the mesh id of each cell
+ * @param meshToLts the primary cell of each element
+ */
+std::vector<unsigned> computePrimaryMeshIds(const unsigned* ltsToMesh,
+                                            std::size_t numberOfCells,
+                                            const unsigned* meshToLts);
+
 class EnergyOutput : public Module {
   public:
   void init(GlobalData* newGlobal,
@@ -66,6 +90,22 @@ class EnergyOutput : public Module {
 
   void simulationStart() override;
 
+  void simulationEnd() override;
+
+  /**
+   * Prepares the accumulation of the volume energies for the synchronization point at time.
+   *
+   * @return true, if the clusters should accumulate the volume energies in their last correction
+   * step before time (cf. accumulateVolumeEnergies).
+   */
+  bool beginAccumulation(double time, double timeTolerance);
+
+  /**
+   * Adds the volume energies of the cells of layer. Called by the time clusters after their last
+   * correction step before the synchronization point, possibly from several threads at once.
+   */
+  void accumulateVolumeEnergies(seissol::initializer::Layer& layer);
+
   EnergyOutput(seissol::SeisSol& seissolInstance) : seissolInstance(seissolInstance) {}
 
   ~EnergyOutput() override;
@@ -84,25 +124,38 @@ class EnergyOutput : public Module {
 
   void computeDynamicRuptureEnergies();
 
-  void computeVolumeEnergies();
+  /**
+   * Adds the volume energies of the elements meshIds[0], ..., meshIds[count - 1] to storage.
+   * Invalid ids are skipped; if meshIds is nullptr, all elements of the mesh are used.
+   */
+  void computeVolumeEnergies(const unsigned* meshIds, std::size_t count, EnergiesStorage& storage);
 
-  void computeEnergies();
+  void computeEnergies(double time);
 
-  void reduceEnergies();
+  /**
+   * Starts the (non-blocking) reduction of the energies of the output id at time.
+   */
+  void startReduction(double time, int id);
 
-  void reduceMinTimeSinceSlipRateBelowThreshold();
+  /**
+   * Completes the pending reduction, if any, and prints and writes its energies.
+   */
+  void finishOutput();
 
-  void printEnergies();
+  void printEnergies(int id);
 
-  void checkAbortCriterion(real timeSinceThreshold, const std::string& prefixMessage);
+  /**
+   * @return true on rank 0, if the simulation should be aborted.
+   */
+  bool checkAbortCriterion(real timeSinceThreshold, const std::string& prefixMessage);
 
   void writeHeader();
 
-  void writeEnergies(double time);
+  void writeEnergies(double time, int id);
 
   seissol::SeisSol& seissolInstance;
 
-  bool shouldComputeVolumeEnergies() const;
+  bool shouldComputeVolumeEnergies(int id) const;
 
   bool isEnabled = false;
   bool isTerminalOutputEnabled = false;
@@ -113,6 +166,24 @@ class EnergyOutput : public Module {
   int computeVolumeEnergiesEveryOutput = 1;
   int outputId = 0;
 
+  // reduce the energies in the background, and complete the reduction at the next output
+  bool isAsync = false;
+  bool isOutputPending = false;
+  double pendingTime = 0.0;
+  int pendingOutputId = 0;
+
+  decltype(EnergiesStorage::energies) reductionBuffer{};
+  real reducedMinTimeSinceSlipRateBelowThreshold{};
+#ifdef USE_MPI
+  std::array<MPI_Request, 2> requests{MPI_REQUEST_NULL, MPI_REQUEST_NULL};
+#endif
+
+  // the mesh id of each cell, if the cell is the primary copy of its element (invalid otherwise)
+  std::vector<unsigned> primaryMeshIds;
+  EnergiesStorage accumulatedEnergies{};
+  double accumulationTime = -std::numeric_limits<double>::infinity();
+  std::mutex accumulationMutex;
+
   std::string outputFileName;
   std::ofstream out;
 
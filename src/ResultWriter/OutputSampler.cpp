@@ -0,0 +1,115 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "OutputSampler.h"
+
+#include "Kernels/Precision.h"
+
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace seissol::writer {
+
+void OutputSampler::init(double interval,
+                         const real* dofs,
+                         std::size_t dofsSize,
+                         const real* pstrain,
+                         std::size_t pstrainSize,
+                         WriteCallback callback) {
+  this->interval = interval;
+  treeDofs = dofs;
+  this->dofsSize = dofsSize;
+  treePstrain = pstrain;
+  this->pstrainSize = pstrain == nullptr ? 0 : pstrainSize;
+  this->callback = std::move(callback);
+}
+
+void OutputSampler::setNumContributors(unsigned numContributors) {
+  this->numContributors = numContributors;
+}
+
+std::size_t OutputSampler::firstIndexAfter(double time, double timeTolerance) const {
+  auto index = static_cast<std::size_t>(std::floor(time / interval));
+  while (this->time(index) < time + timeTolerance) {
+    ++index;
+  }
+  return index;
+}
+
+OutputSampler::Snapshot& OutputSampler::snapshot(std::size_t index) {
+  const std::lock_guard lock(mutex);
+  auto& entry = snapshots[index];
+  if (entry == nullptr) {
+    if (pool.empty()) {
+      entry = std::make_unique<Snapshot>();
+      entry->dofs.resize(dofsSize);
+      entry->pstrain.resize(pstrainSize);
+    } else {
+      entry = std::move(pool.back());
+      pool.pop_back();
+    }
+    entry->contributions = 0;
+  }
+  // the snapshot itself stays in place until all contributions have been made
+  return *entry;
+}
+
+real* OutputSampler::stageDofs(std::size_t index, const real* dofs) {
+  return snapshot(index).dofs.data() + (dofs - treeDofs);
+}
+
+real* OutputSampler::stagePstrain(std::size_t index, const real* pstrain) {
+  return snapshot(index).pstrain.data() + (pstrain - treePstrain);
+}
+
+void OutputSampler::contribute(std::size_t index) {
+  auto& staged = snapshot(index);
+  const std::lock_guard lock(mutex);
+  ++staged.contributions;
+}
+
+unsigned OutputSampler::flush() {
+  unsigned written = 0;
+  while (true) {
+    std::size_t index = 0;
+    std::unique_ptr<Snapshot> done;
+    {
+      const std::lock_guard lock(mutex);
+      // each cluster contributes in the order of the output times; hence, the first snapshot is
+      // always the first one to be completed
+      if (snapshots.empty() || snapshots.begin()->second->contributions < numContributors) {
+        break;
+      }
+      index = snapshots.begin()->first;
+      done = std::move(snapshots.begin()->second);
+      snapshots.erase(snapshots.begin());
+    }
+
+    const real* pstrain = treePstrain == nullptr ? nullptr : done->pstrain.data();
+    callback(time(index), done->dofs.data(), pstrain);
+    ++written;
+
+    const std::lock_guard lock(mutex);
+    pool.push_back(std::move(done));
+  }
+  return written;
+}
+
+std::size_t OutputSampler::pending() {
+  const std::lock_guard lock(mutex);
+  return snapshots.size();
+}
+
+void OutputSampler::discard() {
+  const std::lock_guard lock(mutex);
+  for (auto& [index, staged] : snapshots) {
+    pool.push_back(std::move(staged));
+  }
+  snapshots.clear();
+}
+
+} // namespace seissol::writer
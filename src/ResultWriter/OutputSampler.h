@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_RESULTWRITER_OUTPUTSAMPLER_H_
+#define SEISSOL_SRC_RESULTWRITER_OUTPUTSAMPLER_H_
+
+#include "Kernels/Precision.h"
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace seissol::writer {
+
+/**
+ * Stages the wave field at the output times without synchronizing the time clusters.
+ *
+ * Each time cluster evaluates its cells at all output times within its current time step (by the
+ * Taylor expansion of the predictor, as for the receivers) and stores the result in the snapshot
+ * of that output time. A snapshot is written once all clusters have contributed to it; until
+ * then, the clusters keep stepping.
+ *
+ * The snapshots mirror the layout of the DOFs (and plastic strain) of the LTS tree; a cluster
+ * finds its part at the same offset as in the tree.
+ */
+class OutputSampler {
+  public:
+  using WriteCallback = std::function<void(double time, const real* dofs, const real* pstrain)>;
+
+  /**
+   * @param interval the time between two outputs; the output times are multiples of it
+   * @param dofs the DOFs of the entire LTS tree
+   * @param pstrain the plastic strain of the entire LTS tree; may be nullptr
+   */
+  void init(double interval,
+            const real* dofs,
+            std::size_t dofsSize,
+            const real* pstrain,
+            std::size_t pstrainSize,
+            WriteCallback callback);
+
+  void setNumContributors(unsigned numContributors);
+
+  [[nodiscard]] bool enabled() const { return interval > 0; }
+
+  [[nodiscard]] double time(std::size_t index) const { return index * interval; }
+
+  /**
+   * The index of the first output time after the given time (the output at the time itself is
+   * written by the caller, if at all).
+   */
+  [[nodiscard]] std::size_t firstIndexAfter(double time, double timeTolerance) const;
+
+  /**
+   * Returns the staging location for the given DOFs of the tree in the snapshot of the given
+   * output time.
+   */
+  real* stageDofs(std::size_t index, const real* dofs);
+
+  /**
+   * Returns the staging location for the given plastic strain of the tree in the snapshot of the
+   * given output time.
+   */
+  real* stagePstrain(std::size_t index, const real* pstrain);
+
+  /**
+   * Marks the snapshot of the given output time as done by one more cluster.
+   */
+  void contribute(std::size_t index);
+
+  /**
+   * Writes all snapshots which all clusters have contributed to, in order of their output times.
+   *
+   * @return the number of written snapshots
+   */
+  unsigned flush();
+
+  /**
+   * @return the number of snapshots which some, but not all clusters have contributed to
+   */
+  [[nodiscard]] std::size_t pending();
+
+  /**
+   * Drops all unfinished snapshots (e.g. after an aborted simulation).
+   */
+  void discard();
+
+  private:
+  struct Snapshot {
+    std::vector<real> dofs;
+    std::vector<real> pstrain;
+    unsigned contributions{0};
+  };
+
+  Snapshot& snapshot(std::size_t index);
+
+  double interval{0};
+  const real* treeDofs{nullptr};
+  const real* treePstrain{nullptr};
+  std::size_t dofsSize{0};
+  std::size_t pstrainSize{0};
+  unsigned numContributors{0};
+  WriteCallback callback;
+
+  std::mutex mutex;
+  std::map<std::size_t, std::unique_ptr<Snapshot>> snapshots;
+  //! snapshots which have been written already; re-used to avoid allocating them again
+  std::vector<std::unique_ptr<Snapshot>> pool;
+};
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_SRC_RESULTWRITER_OUTPUTSAMPLER_H_
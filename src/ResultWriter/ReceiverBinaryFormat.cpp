@@ -0,0 +1,133 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "ReceiverBinaryFormat.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+constexpr char Magic[] = "SSRECV01";
+constexpr std::size_t MagicLength = sizeof(Magic) - 1;
+
+void writeInteger(std::ostream& stream, std::uint64_t value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+std::uint64_t readInteger(std::istream& stream) {
+  std::uint64_t value = 0;
+  stream.read(reinterpret_cast<char*>(&value), sizeof(value));
+  if (!stream) {
+    throw std::runtime_error("Unexpected end of the receiver file.");
+  }
+  return value;
+}
+} // namespace
+
+namespace seissol::writer {
+
+void writeReceiverBinaryHeader(std::ostream& stream, const ReceiverBinaryHeader& header) {
+  stream.write(Magic, MagicLength);
+  writeInteger(stream, header.valueSize);
+  writeInteger(stream, header.variables.size());
+  for (const auto& variable : header.variables) {
+    writeInteger(stream, variable.size());
+    stream.write(variable.data(), static_cast<std::streamsize>(variable.size()));
+  }
+  writeInteger(stream, header.pointIds.size());
+  for (std::size_t i = 0; i < header.pointIds.size(); ++i) {
+    writeInteger(stream, header.pointIds[i]);
+    stream.write(reinterpret_cast<const char*>(header.points[i].data()), 3 * sizeof(double));
+  }
+}
+
+ReceiverBinaryHeader readReceiverBinaryHeader(std::istream& stream) {
+  char magic[MagicLength];
+  stream.read(magic, MagicLength);
+  if (!stream || std::memcmp(magic, Magic, MagicLength) != 0) {
+    throw std::runtime_error("Not a SeisSol binary receiver file.");
+  }
+
+  ReceiverBinaryHeader header;
+  header.valueSize = readInteger(stream);
+  if (header.valueSize != sizeof(float) && header.valueSize != sizeof(double)) {
+    throw std::runtime_error("Unsupported value size in the receiver file.");
+  }
+  header.variables.resize(readInteger(stream));
+  for (auto& variable : header.variables) {
+    variable.resize(readInteger(stream));
+    stream.read(variable.data(), static_cast<std::streamsize>(variable.size()));
+  }
+  const auto numberOfReceivers = readInteger(stream);
+  header.pointIds.resize(numberOfReceivers);
+  header.points.resize(numberOfReceivers);
+  for (std::size_t i = 0; i < numberOfReceivers; ++i) {
+    header.pointIds[i] = readInteger(stream);
+    stream.read(reinterpret_cast<char*>(header.points[i].data()), 3 * sizeof(double));
+  }
+  if (!stream) {
+    throw std::runtime_error("Unexpected end of the receiver file.");
+  }
+  return header;
+}
+
+bool readReceiverBinaryChunk(std::istream& stream,
+                             const ReceiverBinaryHeader& header,
+                             std::vector<std::vector<double>>& outputs) {
+  if (stream.peek() == std::istream::traits_type::eof()) {
+    return false;
+  }
+  outputs.resize(header.pointIds.size());
+  std::vector<float> floatBuffer;
+  for (auto& output : outputs) {
+    const auto count = readInteger(stream);
+    if (count % header.ncols() != 0) {
+      throw std::runtime_error("Corrupted chunk in the receiver file.");
+    }
+    output.resize(count);
+    if (header.valueSize == sizeof(double)) {
+      stream.read(reinterpret_cast<char*>(output.data()),
+                  static_cast<std::streamsize>(sizeof(double) * count));
+    } else {
+      floatBuffer.resize(count);
+      stream.read(reinterpret_cast<char*>(floatBuffer.data()),
+                  static_cast<std::streamsize>(sizeof(float) * count));
+      output.assign(floatBuffer.begin(), floatBuffer.end());
+    }
+    if (!stream) {
+      throw std::runtime_error("Unexpected end of the receiver file.");
+    }
+  }
+  return true;
+}
+
+std::size_t receiverBinaryResumeOffset(std::istream& stream, const ReceiverBinaryHeader& header) {
+  try {
+    if (!(readReceiverBinaryHeader(stream) == header)) {
+      return 0;
+    }
+  } catch (const std::runtime_error&) {
+    return 0;
+  }
+
+  // a chunk may be incomplete, if the run which wrote it was aborted
+  auto offset = static_cast<std::size_t>(stream.tellg());
+  std::vector<std::vector<double>> outputs;
+  try {
+    while (readReceiverBinaryChunk(stream, header, outputs)) {
+      offset = static_cast<std::size_t>(stream.tellg());
+    }
+  } catch (const std::runtime_error&) {
+    // keep the last complete chunk
+  }
+  return offset;
+}
+
+} // namespace seissol::writer
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_RESULTWRITER_RECEIVERBINARYFORMAT_H_
+#define SEISSOL_SRC_RESULTWRITER_RECEIVERBINARYFORMAT_H_
+
+#include <Eigen/Dense>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace seissol::writer {
+
+/**
+ * Per-rank binary receiver file.
+ *
+ * Layout (all integers are 64 bit unsigned, native byte order):
+ * - the magic string "SSRECV01"
+ * - the size of a stored value in bytes (4 or 8)
+ * - the number of variables, followed by each variable name (length, then characters);
+ *   the time is always the first column and not part of the variables
+ * - the number of receivers, followed by the point id and the three coordinates (as double)
+ *   of each receiver
+ * - an arbitrary number of chunks (one per sync point). A chunk contains for each receiver
+ *   (in header order) the number of values, followed by the values themselves.
+ *   The values are row-major samples of (1 + number of variables) columns.
+ */
+struct ReceiverBinaryHeader {
+  std::size_t valueSize{sizeof(double)};
+  std::vector<std::string> variables;
+  std::vector<unsigned> pointIds;
+  std::vector<Eigen::Vector3d> points;
+
+  [[nodiscard]] std::size_t ncols() const { return variables.size() + 1; }
+
+  [[nodiscard]] bool operator==(const ReceiverBinaryHeader& other) const {
+    return valueSize == other.valueSize && variables == other.variables &&
+           pointIds == other.pointIds && points == other.points;
+  }
+};
+
+void writeReceiverBinaryHeader(std::ostream& stream, const ReceiverBinaryHeader& header);
+
+template <typename RealT>
+void writeReceiverBinaryChunk(std::ostream& stream,
+                              const std::vector<std::vector<RealT>>& outputs) {
+  for (const auto& output : outputs) {
+    const auto count = static_cast<std::uint64_t>(output.size());
+    stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    stream.write(reinterpret_cast<const char*>(output.data()),
+                 static_cast<std::streamsize>(sizeof(RealT) * output.size()));
+  }
+}
+
+ReceiverBinaryHeader readReceiverBinaryHeader(std::istream& stream);
+
+/**
+ * Reads the next chunk, converted to double. Returns false if the stream ends before the chunk.
+ */
+bool readReceiverBinaryChunk(std::istream& stream,
+                             const ReceiverBinaryHeader& header,
+                             std::vector<std::vector<double>>& outputs);
+
+/**
+ * Returns the length of the part of an existing receiver file which can be continued with the
+ * given header, i.e. up to the end of its last complete chunk. Returns 0, if the file does not
+ * start with this header.
+ */
+std::size_t receiverBinaryResumeOffset(std::istream& stream, const ReceiverBinaryHeader& header);
+
+} // namespace seissol::writer
+
+#endif // SEISSOL_SRC_RESULTWRITER_RECEIVERBINARYFORMAT_H_
@@ -42,6 +42,10 @@
 
 #include <Equations/Datastructures.h>
 #include <Geometry/MeshReader.h>
+#include <IO/Datatype/Inference.h>
+#include <IO/Writer/Instructions/Data.h>
+#include <IO/Writer/Instructions/Hdf5.h>
+#include <IO/Writer/Writer.h>
 #include <Initializer/LTS.h>
 #include <Initializer/Parameters/OutputParameters.h>
 #include <Initializer/PointMapper.h>
@@ -52,36 +56,42 @@
 #include <cassert>
 #include <cctype>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
 #include <fstream>
+#include <future>
 #include <iomanip>
 #include <ios>
 #include <memory>
 #include <numeric>
 #include <ostream>
-#include <regex>
 #include <sstream>
 #include <stdexcept>
 #include <string>
 #include <sys/stat.h>
+#include <utility>
 #include <utils/logger.h>
 #include <vector>
 
 #include "Modules/Modules.h"
 #include "Parallel/MPI.h"
+#include "Reader/PointList.h"
+#include "ReceiverBinaryFormat.h"
+#include "SeisSol.h"
 
 namespace seissol::writer {
 
 Eigen::Vector3d parseReceiverLine(const std::string& line) {
-  const std::regex rgx("\\s+");
-  std::sregex_token_iterator iter(line.begin(), line.end(), rgx, -1);
-  const std::sregex_token_iterator end;
+  std::istringstream stream(line);
+  std::string token;
   Eigen::Vector3d coordinates{};
   unsigned numberOfCoordinates = 0;
-  for (; iter != end; ++iter, ++numberOfCoordinates) {
+  for (; stream >> token; ++numberOfCoordinates) {
     if (numberOfCoordinates >= coordinates.size()) {
       throw std::runtime_error("Too many coordinates in line " + line + ".");
     }
-    coordinates[numberOfCoordinates] = std::stod(*iter);
+    coordinates[numberOfCoordinates] = std::stod(token);
   }
   if (numberOfCoordinates != coordinates.size()) {
     throw std::runtime_error("To few coordinates in line " + line + ".");
@@ -115,15 +125,35 @@ std::string ReceiverWriter::fileName(unsigned pointId) const {
   return fns.str();
 }
 
-void ReceiverWriter::writeHeader(unsigned pointId, const Eigen::Vector3d& point) {
-  auto name = fileName(pointId);
+std::string ReceiverWriter::binaryFileName() const {
+  std::stringstream fns;
+  fns << std::setfill('0') << m_fileNamePrefix << "-receivers-" << std::setw(5)
+      << seissol::MPI::mpi.rank() << ".bin";
+  return fns.str();
+}
 
+std::vector<std::string> ReceiverWriter::variableNames() const {
   std::vector<std::string> names(seissol::model::MaterialT::Quantities.begin(),
                                  seissol::model::MaterialT::Quantities.end());
   for (const auto& derived : derivedQuantities) {
     auto derivedNames = derived->quantities();
     names.insert(names.end(), derivedNames.begin(), derivedNames.end());
   }
+#ifdef MULTIPLE_SIMULATIONS
+  std::vector<std::string> simulationNames;
+  for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
+    for (const auto& name : names) {
+      simulationNames.push_back(name + std::to_string(sim));
+    }
+  }
+  return simulationNames;
+#else
+  return names;
+#endif
+}
+
+void ReceiverWriter::writeHeader(unsigned pointId, const Eigen::Vector3d& point) {
+  auto name = fileName(pointId);
 
   /// \todo Find a nicer solution that is not so hard-coded.
   struct stat fileStat;
@@ -134,17 +164,9 @@ void ReceiverWriter::writeHeader(unsigned pointId, const Eigen::Vector3d& point)
     file << "TITLE = \"Temporal Signal for receiver number " << std::setfill('0') << std::setw(5)
          << (pointId + 1) << "\"" << std::endl;
     file << "VARIABLES = \"Time\"";
-#ifdef MULTIPLE_SIMULATIONS
-    for (unsigned sim = init::QAtPoint::Start[0]; sim < init::QAtPoint::Stop[0]; ++sim) {
-      for (const auto& name : names) {
-        file << ",\"" << name << sim << "\"";
-      }
-    }
-#else
-    for (auto const& name : names) {
+    for (const auto& name : variableNames()) {
       file << ",\"" << name << "\"";
     }
-#endif
     file << std::endl;
     for (int d = 0; d < 3; ++d) {
       file << "# x" << (d + 1) << "       " << std::scientific << std::setprecision(12) << point[d]
@@ -154,39 +176,152 @@ void ReceiverWriter::writeHeader(unsigned pointId, const Eigen::Vector3d& point)
   }
 }
 
+void ReceiverWriter::writeBinaryHeader() {
+  ReceiverBinaryHeader header;
+  header.valueSize = sizeof(real);
+  header.variables = variableNames();
+  for (const auto* receiver : m_receivers) {
+    header.pointIds.push_back(receiver->pointId);
+    header.points.push_back(receiver->position);
+  }
+
+  // as the text output, we continue an existing file (e.g. when restarting from a checkpoint)
+  const auto name = binaryFileName();
+  std::ifstream existing(name, std::ios::binary);
+  if (existing) {
+    const auto resumeOffset = receiverBinaryResumeOffset(existing, header);
+    existing.close();
+    if (resumeOffset > 0) {
+      std::filesystem::resize_file(name, resumeOffset);
+      return;
+    }
+    logWarning() << "The receiver file" << name
+                 << "does not match the receivers of this run; it is overwritten.";
+  }
+
+  std::ofstream file(name, std::ios::binary | std::ios::trunc);
+  writeReceiverBinaryHeader(file, header);
+}
+
 void ReceiverWriter::syncPoint(double /*currentTime*/) {
-  if (m_receiverClusters.empty()) {
+  if (m_receivers.empty() || m_format == initializer::parameters::ReceiverOutputFormat::Hdf5) {
+    // (the HDF5 output is planned and written by the output manager)
     return;
   }
 
   m_stopwatch.start();
 
-  for (auto& [layer, clusters] : m_receiverClusters) {
-    for (auto& cluster : clusters) {
-      auto ncols = cluster.ncols();
-      for (auto& receiver : cluster) {
-        assert(receiver.output.size() % ncols == 0);
-        const size_t nSamples = receiver.output.size() / ncols;
-
-        std::ofstream file;
-        file.open(fileName(receiver.pointId), std::ios::app);
-        file << std::scientific << std::setprecision(15);
-        for (size_t i = 0; i < nSamples; ++i) {
-          for (size_t q = 0; q < ncols; ++q) {
-            file << "  " << receiver.output[q + i * ncols];
-          }
-          file << std::endl;
-        }
-        file.close();
-        receiver.output.clear();
-      }
-    }
+  if (m_format == initializer::parameters::ReceiverOutputFormat::Binary) {
+    writeBinary();
+  } else {
+    writeText();
   }
 
   auto time = m_stopwatch.stop();
   const int rank = seissol::MPI::mpi.rank();
   logInfo(rank) << "Wrote receivers in" << time << "seconds.";
 }
+
+void ReceiverWriter::writeText() {
+  const auto ncols = variableNames().size() + 1;
+  for (auto* receiver : m_receivers) {
+    assert(receiver->output.size() % ncols == 0);
+    const size_t nSamples = receiver->output.size() / ncols;
+
+    std::ofstream file;
+    file.open(fileName(receiver->pointId), std::ios::app);
+    file << std::scientific << std::setprecision(15);
+    for (size_t i = 0; i < nSamples; ++i) {
+      for (size_t q = 0; q < ncols; ++q) {
+        file << "  " << receiver->output[q + i * ncols];
+      }
+      file << std::endl;
+    }
+    file.close();
+    receiver->output.clear();
+  }
+}
+
+void ReceiverWriter::writeBinary() {
+  // the staging buffers are still in use until the previous write has finished
+  if (m_pendingWrite.valid()) {
+    m_pendingWrite.get();
+  }
+
+  // hand the sampled data over without copying; the receivers continue
+  // with the (cleared, but still allocated) buffers of the last interval
+  for (std::size_t i = 0; i < m_receivers.size(); ++i) {
+    m_stagingOutput[i].clear();
+    std::swap(m_stagingOutput[i], m_receivers[i]->output);
+  }
+
+  m_pendingWrite = std::async(std::launch::async, [this]() {
+    std::ofstream file(binaryFileName(), std::ios::binary | std::ios::app);
+    writeReceiverBinaryChunk(file, m_stagingOutput);
+  });
+}
+
+io::writer::Writer ReceiverWriter::planHdf5Write(const std::string& prefix, std::size_t counter) {
+  const auto filename = prefix + "-receiver-" + std::to_string(counter) + ".h5";
+  const auto variables = variableNames();
+  const std::size_t ncols = variables.size() + 1;
+
+  std::size_t rows = 0;
+  for (std::size_t i = 0; i < m_receivers.size(); ++i) {
+    m_hdf5SampleCounts[i] = m_receivers[i]->output.size() / ncols;
+    rows += m_hdf5SampleCounts[i];
+  }
+
+  auto writer = io::writer::Writer();
+  const auto location = io::writer::instructions::Hdf5Location(filename, {});
+  writer.addInstruction(std::make_shared<io::writer::instructions::Hdf5DataWrite>(
+      location,
+      "pointid",
+      io::writer::WriteBuffer::create(m_hdf5PointIds.data(), m_hdf5PointIds.size()),
+      io::datatype::inferDatatype<std::uint64_t>()));
+  writer.addInstruction(std::make_shared<io::writer::instructions::Hdf5DataWrite>(
+      location,
+      "position",
+      io::writer::WriteBuffer::create(m_hdf5Points.data(), m_receivers.size(), {3}),
+      io::datatype::inferDatatype<double>()));
+  writer.addInstruction(std::make_shared<io::writer::instructions::Hdf5DataWrite>(
+      location,
+      "samples",
+      io::writer::WriteBuffer::create(m_hdf5SampleCounts.data(), m_hdf5SampleCounts.size()),
+      io::datatype::inferDatatype<std::uint64_t>()));
+
+  // the sampled rows are appended as they are, receiver after receiver
+  auto* self = this;
+  writer.addInstruction(std::make_shared<io::writer::instructions::Hdf5DataWrite>(
+      location,
+      "receiverdata",
+      std::make_shared<io::writer::GeneratedBuffer>(
+          rows,
+          1,
+          [self](void* target) {
+            auto* targetReal = reinterpret_cast<real*>(target);
+            for (auto* receiver : self->m_receivers) {
+              std::memcpy(
+                  targetReal, receiver->output.data(), sizeof(real) * receiver->output.size());
+              targetReal += receiver->output.size();
+              receiver->output.clear();
+            }
+          },
+          io::datatype::inferDatatype<real>(),
+          std::vector<std::size_t>{ncols}),
+      io::datatype::inferDatatype<real>()));
+
+  std::string variableString = "Time";
+  for (const auto& variable : variables) {
+    variableString += "," + variable;
+  }
+  writer.addInstruction(std::make_shared<io::writer::instructions::Hdf5AttributeWrite>(
+      io::writer::instructions::Hdf5Location(filename, {}, "receiverdata"),
+      "variables",
+      io::writer::WriteInline::createString(variableString)));
+  return writer;
+}
+
 void ReceiverWriter::init(
     const std::string& fileNamePrefix,
     double endTime,
@@ -194,6 +329,7 @@ void ReceiverWriter::init(
   m_fileNamePrefix = fileNamePrefix;
   m_receiverFileName = parameters.fileName;
   m_samplingInterval = parameters.samplingInterval;
+  m_format = parameters.format;
 
   if (parameters.computeRotation) {
     derivedQuantities.push_back(std::make_shared<kernels::ReceiverRotation>());
@@ -206,6 +342,16 @@ void ReceiverWriter::init(
   Modules::registerHook(*this, ModuleHook::SimulationStart);
   Modules::registerHook(*this, ModuleHook::SynchronizationPoint);
   Modules::registerHook(*this, ModuleHook::Shutdown);
+
+  if (m_format == initializer::parameters::ReceiverOutputFormat::Hdf5) {
+    io::writer::ScheduledWriter schedWriter;
+    schedWriter.name = "receiver";
+    schedWriter.interval = syncInterval();
+    schedWriter.planWrite = [this](const std::string& prefix, std::size_t counter, double) {
+      return planHdf5Write(prefix, counter);
+    };
+    seissolInstance.getOutputManager().addOutput(schedWriter);
+  }
 }
 
 void ReceiverWriter::addPoints(const seissol::geometry::MeshReader& mesh,
@@ -216,7 +362,7 @@ void ReceiverWriter::addPoints(const seissol::geometry::MeshReader& mesh,
   const auto rank = seissol::MPI::mpi.rank();
   // Only parse if we have a receiver file
   if (!m_receiverFileName.empty()) {
-    points = parseReceiverFile(m_receiverFileName);
+    points = seissol::reader::readPointList(m_receiverFileName, parseReceiverFile);
     logInfo(rank) << "Record points read from" << m_receiverFileName;
     logInfo(rank) << "Number of record points =" << points.size();
   } else {
@@ -258,11 +404,33 @@ void ReceiverWriter::addPoints(const seissol::geometry::MeshReader& mesh,
                               seissolInstance);
       }
 
-      writeHeader(point, points[point]);
+      if (m_format == initializer::parameters::ReceiverOutputFormat::Text) {
+        writeHeader(point, points[point]);
+      }
       m_receiverClusters[layer][cluster].addReceiver(
           meshId, point, points[point], mesh, ltsLut, lts);
     }
   }
+
+  // (the clusters are complete now, i.e. the receivers won't move anymore)
+  m_receivers.clear();
+  for (auto& [layer, clusters] : m_receiverClusters) {
+    for (auto& cluster : clusters) {
+      for (auto& receiver : cluster) {
+        m_receivers.push_back(&receiver);
+      }
+    }
+  }
+
+  if (m_format == initializer::parameters::ReceiverOutputFormat::Binary && !m_receivers.empty()) {
+    writeBinaryHeader();
+  }
+  for (const auto* receiver : m_receivers) {
+    m_hdf5PointIds.push_back(receiver->pointId);
+    m_hdf5Points.insert(
+        m_hdf5Points.end(), receiver->position.data(), receiver->position.data() + 3);
+  }
+  m_hdf5SampleCounts.resize(m_receivers.size());
 }
 
 void ReceiverWriter::simulationStart() {
@@ -271,9 +439,16 @@ void ReceiverWriter::simulationStart() {
       cluster.allocateData();
     }
   }
+  m_stagingOutput.resize(m_receivers.size());
+  for (std::size_t i = 0; i < m_receivers.size(); ++i) {
+    m_stagingOutput[i].reserve(m_receivers[i]->output.capacity());
+  }
 }
 
 void ReceiverWriter::shutdown() {
+  if (m_pendingWrite.valid()) {
+    m_pendingWrite.get();
+  }
   for (auto& [layer, clusters] : m_receiverClusters) {
     for (auto& cluster : clusters) {
       cluster.freeData();
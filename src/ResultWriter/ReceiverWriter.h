@@ -41,10 +41,13 @@
 #ifndef RESULTWRITER_RECEIVERWRITER_H_
 #define RESULTWRITER_RECEIVERWRITER_H_
 
+#include <future>
 #include <string_view>
 #include <vector>
 
 #include "Geometry/MeshReader.h"
+#include "IO/Writer/Writer.h"
+#include "Initializer/Parameters/OutputParameters.h"
 #include "Initializer/LTS.h"
 #include "Initializer/Tree/Lut.h"
 #include "Kernels/Receiver.h"
@@ -56,9 +59,6 @@ namespace seissol {
 struct LocalIntegrationData;
 struct GlobalData;
 class SeisSol;
-namespace initializer::parameters {
-struct ReceiverOutputParameters;
-} // namespace initializer::parameters
 } // namespace seissol
 
 namespace seissol::writer {
@@ -91,11 +91,27 @@ class ReceiverWriter : public seissol::Module {
 
   private:
   [[nodiscard]] std::string fileName(unsigned pointId) const;
+  [[nodiscard]] std::string binaryFileName() const;
+  [[nodiscard]] std::vector<std::string> variableNames() const;
   void writeHeader(unsigned pointId, const Eigen::Vector3d& point);
+  void writeBinaryHeader();
+  void writeText();
+  void writeBinary();
+  io::writer::Writer planHdf5Write(const std::string& prefix, std::size_t counter);
 
   std::string m_receiverFileName;
   std::string m_fileNamePrefix;
   double m_samplingInterval;
+  seissol::initializer::parameters::ReceiverOutputFormat m_format{
+      seissol::initializer::parameters::ReceiverOutputFormat::Text};
+  // all receivers of this rank, in output order
+  std::vector<kernels::Receiver*> m_receivers;
+  // the binary output is written from these buffers, while the clusters fill the next interval
+  std::vector<std::vector<real>> m_stagingOutput;
+  std::future<void> m_pendingWrite;
+  std::vector<std::uint64_t> m_hdf5PointIds;
+  std::vector<double> m_hdf5Points;
+  std::vector<std::uint64_t> m_hdf5SampleCounts;
   std::vector<std::shared_ptr<kernels::DerivedReceiverQuantity>> derivedQuantities;
   // Map needed because LayerType enum casts weirdly to int.
   std::unordered_map<LayerType, std::vector<kernels::ReceiverCluster>> m_receiverClusters;
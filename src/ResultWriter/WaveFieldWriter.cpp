@@ -49,6 +49,7 @@
 #include <cassert>
 #include <cmath>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <mpi.h>
@@ -62,6 +63,7 @@
 #include "Geometry/Refinement/MeshRefiner.h"
 #include "Modules/Modules.h"
 #include "Monitoring/Instrumentation.h"
+#include "Parallel/Helper.h"
 #include "SeisSol.h"
 #include "WaveFieldWriter.h"
 
@@ -80,6 +82,16 @@ void seissol::writer::WaveFieldWriter::setUp() {
 
 void seissol::writer::WaveFieldWriter::enable() { m_enabled = true; }
 
+void seissol::writer::WaveFieldWriter::setWaveFieldInterval(double interval) {
+  m_interval = interval;
+  if (useSyncFreeOutput()) {
+    // the time clusters sample the output; we only need the final synchronization point
+    setSyncInterval(std::numeric_limits<double>::max());
+  } else {
+    setSyncInterval(interval);
+  }
+}
+
 seissol::refinement::TetrahedronRefiner<double>*
     seissol::writer::WaveFieldWriter::createRefiner(int refinement) {
   const int rank = seissol::MPI::mpi.rank();
@@ -457,7 +469,27 @@ void seissol::writer::WaveFieldWriter::init(
   delete meshRefiner;
 }
 
-void seissol::writer::WaveFieldWriter::write(double time) {
+seissol::writer::OutputSampler*
+    seissol::writer::WaveFieldWriter::enableSampling(std::size_t dofsSize,
+                                                     std::size_t pstrainSize) {
+  if (!m_enabled) {
+    return nullptr;
+  }
+
+  m_outputSampler.init(m_interval,
+                       m_dofs,
+                       dofsSize,
+                       m_pstrain,
+                       pstrainSize,
+                       [this](double time, const real* dofs, const real* pstrain) {
+                         write(time, dofs, pstrain);
+                       });
+  return &m_outputSampler;
+}
+
+void seissol::writer::WaveFieldWriter::write(double time) { write(time, m_dofs, m_pstrain); }
+
+void seissol::writer::WaveFieldWriter::write(double time, const real* dofs, const real* pstrain) {
   SCOREP_USER_REGION("WaveFieldWriter_write", SCOREP_USER_REGION_TYPE_FUNCTION);
 
   if (!m_enabled) {
@@ -486,10 +518,10 @@ void seissol::writer::WaveFieldWriter::write(double time) {
         async::Module<WaveFieldWriterExecutor, WaveFieldInitParam, WaveFieldParam>::managedBuffer<
             real*>(nextId);
     if (i < m_numVariables - WaveFieldWriterExecutor::NumPlasticityVariables) {
-      m_variableSubsampler->get(m_dofs, m_map.data(), i, managedBuffer);
+      m_variableSubsampler->get(dofs, m_map.data(), i, managedBuffer);
     } else {
       m_variableSubsamplerPStrain->get(
-          m_pstrain,
+          pstrain,
           m_map.data(),
           i - (m_numVariables - WaveFieldWriterExecutor::NumPlasticityVariables),
           managedBuffer);
@@ -531,6 +563,7 @@ void seissol::writer::WaveFieldWriter::write(double time) {
   WaveFieldParam param;
   param.time = time;
   call(param);
+  m_lastTime = time;
 
   m_stopwatch.pause();
 
@@ -539,4 +572,20 @@ void seissol::writer::WaveFieldWriter::write(double time) {
 
 void seissol::writer::WaveFieldWriter::simulationStart() { syncPoint(0.0); }
 
-void seissol::writer::WaveFieldWriter::syncPoint(double currentTime) { write(currentTime); }
+void seissol::writer::WaveFieldWriter::syncPoint(double currentTime) {
+  if (!m_outputSampler.enabled()) {
+    write(currentTime);
+    return;
+  }
+
+  // the final synchronization point; all clusters have passed the sampled output times
+  m_outputSampler.flush();
+  if (m_outputSampler.pending() > 0) {
+    logWarning(seissol::MPI::mpi.rank())
+        << "Dropping" << m_outputSampler.pending() << "incomplete wave field snapshot(s).";
+    m_outputSampler.discard();
+  }
+  if (std::abs(currentTime - m_lastTime) >= seissolInstance.timeManager().getTimeTolerance()) {
+    write(currentTime);
+  }
+}
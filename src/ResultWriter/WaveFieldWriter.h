@@ -59,6 +59,7 @@
 #include "Geometry/Refinement/VariableSubSampler.h"
 #include "Modules/Module.h"
 #include "Monitoring/Stopwatch.h"
+#include "OutputSampler.h"
 #include "WaveFieldWriterExecutor.h"
 
 // for OutputBounds
@@ -133,6 +134,15 @@ class WaveFieldWriter
   /** The stopwatch for the frontend */
   Stopwatch m_stopwatch;
 
+  /** The time between two outputs */
+  double m_interval{0};
+
+  /** The time of the last output (negative, if there was none yet) */
+  double m_lastTime{-1};
+
+  /** Collects the output sampled by the time clusters (with SEISSOL_SYNC_FREE_OUTPUT) */
+  OutputSampler m_outputSampler;
+
   /** Checks if a vertex given by the vertexCoords lies inside the boxBounds */
   /*   The boxBounds is in the format: xMin, xMax, yMin, yMax, zMin, zMax */
   static bool vertexInBox(const double* const boxBounds, const double* const vertexCoords) {
@@ -149,6 +159,11 @@ class WaveFieldWriter
                                     const std::vector<unsigned>& ltsClusteringData,
                                     std::map<int, int>& newToOldCellMap) const;
 
+  /**
+   * Write the given DOFs and plastic strain as the time step at the given time
+   */
+  void write(double time, const real* dofs, const real* pstrain);
+
   public:
   WaveFieldWriter(seissol::SeisSol& seissolInstance) : seissolInstance(seissolInstance) {}
 
@@ -172,7 +187,7 @@ class WaveFieldWriter
    */
   void setUp() override;
 
-  void setWaveFieldInterval(double interval) { setSyncInterval(interval); }
+  void setWaveFieldInterval(double interval);
 
   /**
    * Initialize the wave field ouput
@@ -193,6 +208,16 @@ class WaveFieldWriter
             xdmfwriter::BackendType backend,
             const std::string& backupTimeStamp);
 
+  /**
+   * Let the time clusters sample the output at the output times, instead of synchronizing them
+   * there (cf. TimeManager::setOutputSampler). Call after init().
+   *
+   * @param dofsSize The number of entries in the DOFs (as given to init())
+   * @param pstrainSize The number of entries in the plastic strain (as given to init())
+   * @return The output sampler, or nullptr if the wave field output is disabled
+   */
+  OutputSampler* enableSampling(std::size_t dofsSize, std::size_t pstrainSize);
+
   /**
    * Write a time step
    */
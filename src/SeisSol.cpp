@@ -77,6 +77,9 @@ bool SeisSol::init(int argc, char* argv[]) {
   seissol::MPI::mpi.setDataTransferModeFromEnv();
 
   printPersistentMpiInfo(seissol::MPI::mpi);
+  printMessageAggregationInfo(seissol::MPI::mpi);
+  printSinglePrecisionMpiInfo(seissol::MPI::mpi);
+  printCopyRegionIntegrationInfo(seissol::MPI::mpi);
 #endif
 #ifdef ACL_DEVICE
   printUSMInfo(MPI::mpi);
@@ -103,6 +106,12 @@ bool SeisSol::init(int argc, char* argv[]) {
                 << parallel::Pinning::maskToString(seissol::parallel::Pinning::getNodeMask());
 
   seissol::printCommThreadInfo(seissol::MPI::mpi);
+  seissol::printTaskSchedulerInfo(seissol::MPI::mpi);
+  seissol::printFusedSweepInfo(seissol::MPI::mpi);
+  seissol::printNumaPlacementInfo(seissol::MPI::mpi);
+  if (seissol::useNumaPlacement()) {
+    numaPlacement.init();
+  }
   if (seissol::useCommThread(seissol::MPI::mpi)) {
     auto freeCpus = pinning.getFreeCPUsMask();
     logInfo(rank) << "Communication thread affinity        :"
@@ -115,6 +124,10 @@ bool SeisSol::init(int argc, char* argv[]) {
     }
   }
 #endif // _OPENMP
+  seissol::printFrictionFaceBatchesInfo(seissol::MPI::mpi);
+  seissol::printPlasticityCellBlocksInfo(seissol::MPI::mpi);
+  seissol::printAsyncEnergyOutputInfo(seissol::MPI::mpi);
+  seissol::printSyncFreeOutputInfo(seissol::MPI::mpi);
 
   // Check if the ulimit for the stacksize is reasonable.
   // A low limit can lead to segmentation faults.
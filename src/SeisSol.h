@@ -52,6 +52,7 @@
 #include "Initializer/TimeStepping/LtsLayout.h"
 #include "Initializer/Typedefs.h"
 #include "Monitoring/FlopCounter.h"
+#include "Parallel/NumaPlacement.h"
 #include "Parallel/Pin.h"
 #include "Physics/InstantaneousTimeMirrorManager.h"
 #include "ResultWriter/AnalysisWriter.h"
@@ -62,6 +63,7 @@
 #include "ResultWriter/PostProcessor.h"
 #include "ResultWriter/WaveFieldWriter.h"
 #include "Solver/FreeSurfaceIntegrator.h"
+#include "Solver/Rebalancer.h"
 #include "Solver/Simulator.h"
 #include "Solver/time_stepping/TimeManager.h"
 #include "SourceTerm/Manager.h"
@@ -84,6 +86,8 @@ class SeisSol {
 
   const parallel::Pinning& getPinning() { return pinning; }
 
+  parallel::NumaPlacement& getNumaPlacement() { return numaPlacement; }
+
   /**
    * Initialize C++ part of the program
    */
@@ -104,6 +108,8 @@ class SeisSol {
 
   Simulator& simulator() { return m_simulator; }
 
+  solver::Rebalancer& rebalancer() { return m_rebalancer; }
+
   sourceterm::Manager& sourceTermManager() { return m_sourceTermManager; }
 
   solver::FreeSurfaceIntegrator& freeSurfaceIntegrator() { return m_freeSurfaceIntegrator; }
@@ -218,6 +224,9 @@ class SeisSol {
   // => Initialize it first, to avoid this.
   parallel::Pinning pinning;
 
+  //! Placement of the cell data on the NUMA nodes
+  parallel::NumaPlacement numaPlacement;
+
   seissol::io::OutputManager outputManager;
 
   //! Collection of Parameters
@@ -244,6 +253,9 @@ class SeisSol {
   //! Simulator
   Simulator m_simulator;
 
+  //! Checkpoint-based rebalancing module
+  solver::Rebalancer m_rebalancer;
+
   //! Source term module
   sourceterm::Manager m_sourceTermManager;
 
@@ -288,9 +300,9 @@ class SeisSol {
   SeisSol(initializer::parameters::SeisSolParameters& parameters)
       : outputManager(*this), m_seissolParameters(parameters), m_ltsLayout(parameters),
         m_memoryManager(std::make_unique<initializer::MemoryManager>(*this)), m_timeManager(*this),
-        m_freeSurfaceWriter(*this), m_analysisWriter(*this), m_waveFieldWriter(*this),
-        m_faultWriter(*this), m_receiverWriter(*this), m_energyOutput(*this),
-        timeMirrorManagers(*this, *this) {}
+        m_rebalancer(*this), m_freeSurfaceWriter(*this), m_analysisWriter(*this),
+        m_waveFieldWriter(*this), m_faultWriter(*this), m_receiverWriter(*this),
+        m_energyOutput(*this), timeMirrorManagers(*this, *this) {}
 
   SeisSol(const SeisSol&) = delete;
   SeisSol(SeisSol&&) = delete;
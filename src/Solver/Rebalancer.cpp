@@ -0,0 +1,136 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "Rebalancer.h"
+
+#include <cmath>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <mpi.h>
+#include <string>
+#include <utility>
+#include <utils/logger.h>
+#include <vector>
+
+#include "IO/Instance/Checkpoint/CheckpointManager.h"
+#include "Initializer/TimeStepping/LtsWeights/CostFactors.h"
+#include "Initializer/Tree/LTSTree.h"
+#include "Modules/Modules.h"
+#include "Numerical/Statistics.h"
+#include "Parallel/MPI.h"
+#include "SeisSol.h"
+
+namespace seissol::solver {
+
+Rebalancer::Rebalancer(SeisSol& seissolInstance) : seissolInstance(seissolInstance) {}
+
+void Rebalancer::setup(io::instance::checkpoint::CheckpointManager& checkpoint,
+                       initializer::LTSTree* tree,
+                       const std::vector<std::size_t>& globalIds,
+                       double interval,
+                       double maximumImbalance) {
+  this->maximumImbalance = maximumImbalance;
+
+  loadedFactors.assign(tree->getNumberOfCells(Ghost), 1.0);
+  const auto& checkpointFile = seissolInstance.getCheckpointLoadFile();
+  if (checkpointFile.has_value()) {
+    // cf. LtsWeights::applyRebalancingCosts
+    auto factors = io::instance::checkpoint::CheckpointManager::readWriteOnlyData(
+        checkpointFile.value(), "lts", CheckpointVariable, globalIds);
+    if (factors.has_value()) {
+      loadedFactors = std::move(factors.value());
+    }
+  }
+  costFactors = loadedFactors;
+  checkpoint.registerWriteOnlyData(CheckpointVariable, tree, costFactors);
+
+  // the cells are ordered by cluster, and by layer within a cluster (cf. TimeManager::addClusters
+  // for the profiling ids)
+  const auto* timeStepping = seissolInstance.timeManager().getTimeStepping();
+  cellGroups.clear();
+  cellGroups.reserve(costFactors.size());
+  for (unsigned cluster = 0; cluster < tree->numChildren(); ++cluster) {
+    const auto globalClusterId = timeStepping->clusterIds[cluster];
+    for (const auto layer : {Copy, Interior}) {
+      const auto offset = layer == Interior ? 0 : timeStepping->numberOfGlobalClusters;
+      const auto cells = tree->child(cluster).child(layer).getNumberOfCells();
+      cellGroups.insert(cellGroups.end(), cells, globalClusterId + offset);
+    }
+  }
+  lastMeasurements.assign(2 * timeStepping->numberOfGlobalClusters, {});
+
+  // a restart file of a previous run would be stale now
+  if (seissol::MPI::mpi.rank() == 0) {
+    const auto& prefix = seissolInstance.getSeisSolParameters().output.prefix;
+    std::filesystem::remove(prefix + RestartFileSuffix);
+  }
+
+  // needs to run before the checkpoint writer at the same time
+  Modules::registerHook(*this, ModuleHook::SynchronizationPoint, ModulePriority::High);
+  Modules::registerHook(*this, ModuleHook::Shutdown);
+  setSyncInterval(interval);
+}
+
+void Rebalancer::syncPoint(double currentTime) {
+  const auto rank = seissol::MPI::mpi.rank();
+  const auto& timeManager = seissolInstance.timeManager();
+
+  // the measurements since the previous checkpoint
+  const auto groups = lastMeasurements.size();
+  std::vector<initializer::time_stepping::CostMeasurement> local(groups);
+  double kernelTime = 0;
+  for (std::size_t group = 0; group < groups; ++group) {
+    const double time = timeManager.getKernelTime(group);
+    const double updates = timeManager.getElementUpdates(group);
+    local[group].time = time - lastMeasurements[group].time;
+    local[group].updates = updates - lastMeasurements[group].updates;
+    lastMeasurements[group] = {time, updates};
+    kernelTime += local[group].time;
+  }
+
+  auto global = local;
+#ifdef USE_MPI
+  static_assert(sizeof(initializer::time_stepping::CostMeasurement) == 2 * sizeof(double));
+  MPI_Allreduce(MPI_IN_PLACE,
+                global.data(),
+                static_cast<int>(2 * groups),
+                MPI_DOUBLE,
+                MPI_SUM,
+                seissol::MPI::mpi.comm());
+#endif
+  initializer::time_stepping::composeCostFactors(
+      costFactors, loadedFactors, cellGroups, local, global);
+
+  const auto summary = seissol::statistics::parallelSummary(kernelTime);
+  const double imbalance = summary.max > 0 ? 1.0 - summary.mean / summary.max : 0.0;
+  logInfo(rank) << "Load imbalance since the last checkpoint:" << 100.0 * imbalance << "%";
+
+  const auto& parameters = seissolInstance.getSeisSolParameters();
+  const double timeTolerance = seissolInstance.timeManager().getTimeTolerance();
+  if (imbalance > maximumImbalance &&
+      currentTime + timeTolerance < parameters.timeStepping.endTime) {
+    const auto counter = static_cast<long>(std::round(currentTime / syncInterval()));
+    restartCheckpoint = parameters.output.prefix + "-checkpoint-" + std::to_string(counter) + ".h5";
+    logInfo(rank) << "The load imbalance exceeds" << 100.0 * maximumImbalance
+                  << "%; stopping after this checkpoint. Restart from" << restartCheckpoint.value()
+                  << "to continue with a rebalanced partition.";
+    seissolInstance.simulator().abort();
+  }
+}
+
+void Rebalancer::shutdown() {
+  const auto rank = seissol::MPI::mpi.rank();
+  if (!restartCheckpoint.has_value() || rank != 0) {
+    return;
+  }
+  const auto filename = seissolInstance.getSeisSolParameters().output.prefix + RestartFileSuffix;
+  std::ofstream file(filename, std::ios::out | std::ios::trunc);
+  file << restartCheckpoint.value() << std::endl;
+  if (!file) {
+    logWarning(rank) << "Could not write the restart file" << filename;
+  }
+}
+
+} // namespace seissol::solver
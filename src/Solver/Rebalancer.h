@@ -0,0 +1,87 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_SOLVER_REBALANCER_H_
+#define SEISSOL_SRC_SOLVER_REBALANCER_H_
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Initializer/TimeStepping/LtsWeights/CostFactors.h"
+#include "Modules/Module.h"
+
+namespace seissol {
+class SeisSol;
+namespace initializer {
+class LTSTree;
+} // namespace initializer
+namespace io::instance::checkpoint {
+class CheckpointManager;
+} // namespace io::instance::checkpoint
+} // namespace seissol
+
+namespace seissol::solver {
+
+/**
+ * Rebalances the partition through checkpoints.
+ *
+ * At each checkpoint, the rebalancer measures the compute time per element update of each layer
+ * of each time cluster since the previous checkpoint, relative to the mean of that layer over all
+ * ranks. This cost factor, multiplied with the one the current partition was computed with, is
+ * written with the checkpoint for each cell. If the load imbalance exceeds the given ratio, the
+ * simulation stops after the checkpoint; SeisSol then exits with RestartExitCode, and rank 0 writes
+ * the name of the checkpoint into the file <output prefix>RestartFileSuffix.
+ * When the simulation is restarted from that checkpoint, the LTS weights of the cells are scaled
+ * by their cost factor before partitioning (cf. LtsWeights); then, loading the checkpoint migrates
+ * the cell state to the new partition.
+ */
+class Rebalancer : public Module {
+  public:
+  //! name of the cost factors in the checkpoint of the LTS tree
+  static constexpr const char* CheckpointVariable = "rebalanceCost";
+  //! the exit status of SeisSol, if it has stopped to be restarted with a rebalanced partition
+  //! (EX_TEMPFAIL of sysexits.h)
+  static constexpr int RestartExitCode = 75;
+  //! appended to the output prefix; the file contains the checkpoint to restart from
+  static constexpr const char* RestartFileSuffix = "-rebalance-restart";
+
+  explicit Rebalancer(SeisSol& seissolInstance);
+
+  /**
+   * @param globalIds the global ids of the cells of the tree (as registered with the checkpoint)
+   * @param interval the checkpoint interval
+   * @param maximumImbalance stop the simulation at a checkpoint with a larger load imbalance
+   */
+  void setup(io::instance::checkpoint::CheckpointManager& checkpoint,
+             initializer::LTSTree* tree,
+             const std::vector<std::size_t>& globalIds,
+             double interval,
+             double maximumImbalance);
+
+  void syncPoint(double currentTime) override;
+
+  //! writes the restart file, if requested (i.e. after all checkpoints have been written)
+  void shutdown() override;
+
+  [[nodiscard]] bool restartRequested() const { return restartCheckpoint.has_value(); }
+
+  private:
+  SeisSol& seissolInstance;
+  double maximumImbalance{0};
+  //! the cost factors which the current partition was computed with
+  std::vector<double> loadedFactors;
+  std::vector<double> costFactors;
+  //! the measurement group (i.e. the profiling id of the cluster layer) of each cell
+  std::vector<std::size_t> cellGroups;
+  //! the measurements of each group up to the previous checkpoint
+  std::vector<initializer::time_stepping::CostMeasurement> lastMeasurements;
+  //! the checkpoint to restart from with a rebalanced partition
+  std::optional<std::string> restartCheckpoint;
+};
+
+} // namespace seissol::solver
+
+#endif // SEISSOL_SRC_SOLVER_REBALANCER_H_
@@ -46,6 +46,7 @@
 #include "Monitoring/FlopCounter.h"
 #include "Monitoring/Stopwatch.h"
 #include "Monitoring/Unit.h"
+#include "Parallel/Helper.h"
 #include "ResultWriter/AnalysisWriter.h"
 #include "ResultWriter/EnergyOutput.h"
 #include "SeisSol.h"
@@ -116,6 +117,10 @@ void seissol::Simulator::simulate(seissol::SeisSol& seissolInstance) {
 
   Stopwatch::print("Time spent for initial IO:", ioStopwatch.split(), seissol::MPI::mpi.comm());
 
+  if (seissol::useNumaPlacement()) {
+    seissolInstance.getNumaPlacement().startCounters();
+  }
+
   while( m_finalTime > m_currentTime + timeTolerance ) {
     if (upcomingTime < m_currentTime + timeTolerance) {
       logError() << "Simulator did not advance in time from" << m_currentTime << "to" << upcomingTime;
@@ -169,7 +174,16 @@ void seissol::Simulator::simulate(seissol::SeisSol& seissolInstance) {
   seissolInstance.timeManager().printComputationTime(outputPrefix,
                                                             isLoopStatisticsNetcdfOutputOn);
 
+  const auto& vertexWeight = seissolInstance.getSeisSolParameters().timeStepping.vertexWeight;
+  if (vertexWeight.calibrateCostModel) {
+    seissolInstance.timeManager().writeCostModel(vertexWeight.costModelFile);
+  }
+
   seissolInstance.analysisWriter().printAnalysis(m_currentTime);
 
   seissolInstance.flopCounter().printPerformanceSummary(wallTime);
+
+  if (seissol::useNumaPlacement()) {
+    seissolInstance.getNumaPlacement().printSummary();
+  }
 }
@@ -18,6 +18,34 @@ bool AbstractGhostTimeCluster::testQueue(MPI_Request* requests,
   return regions.empty();
 }
 
+bool AbstractGhostTimeCluster::testReceiveQueue(MPI_Request* requests) {
+  for (auto region = receiveQueue.begin(); region != receiveQueue.end();) {
+    int testSuccess = 0;
+    MPI_Test(&requests[*region], &testSuccess, MPI_STATUS_IGNORE);
+    if (testSuccess) {
+      unpackGhostRegion(*region);
+      markRegionReceived(*region);
+      region = receiveQueue.erase(region);
+    } else {
+      ++region;
+    }
+  }
+  return receiveQueue.empty();
+}
+
+void AbstractGhostTimeCluster::markRegionReceived(unsigned int region) {
+  if (regionReadiness != nullptr) {
+    // the pending receives carry the data for our next prediction
+    const auto predictionSteps = ct.predictionsSinceLastSync + ct.timeStepRate;
+    const bool lastBeforeSync = predictionSteps >= ct.stepsUntilSync;
+    regionReadiness->markReceived(region, syncTime, predictionSteps, lastBeforeSync);
+  }
+}
+
+void AbstractGhostTimeCluster::setRegionReadiness(std::shared_ptr<GhostRegionReadiness> readiness) {
+  regionReadiness = std::move(readiness);
+}
+
 bool AbstractGhostTimeCluster::testForCopyLayerSends() {
   SCOREP_USER_REGION( "testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION )
   return testQueue(meshStructure->sendRequests, sendQueue);
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <list>
+#include <memory>
 #include "Initializer/Typedefs.h"
 #include "AbstractTimeCluster.h"
+#include "GhostRegionReadiness.h"
 
 namespace seissol::time_stepping {
 class AbstractGhostTimeCluster : public AbstractTimeCluster {
@@ -13,13 +15,19 @@ class AbstractGhostTimeCluster : public AbstractTimeCluster {
   std::list<unsigned int> sendQueue;
   std::list<unsigned int> receiveQueue;
 
+  std::shared_ptr<GhostRegionReadiness> regionReadiness;
+
   double lastSendTime = -1.0;
 
   virtual void sendCopyLayer() = 0;
   virtual void receiveGhostLayer() = 0;
 
   bool testQueue(MPI_Request* requests, std::list<unsigned int>& regions);
-  bool testForCopyLayerSends();
+  virtual bool testForCopyLayerSends();
+  bool testReceiveQueue(MPI_Request* requests);
+  void markRegionReceived(unsigned int region);
+  //! called once the receive of a region has completed
+  virtual void unpackGhostRegion(unsigned int /*region*/) {}
   virtual bool testForGhostLayerReceives() = 0;
 
   void start() override;
@@ -41,5 +49,9 @@ class AbstractGhostTimeCluster : public AbstractTimeCluster {
 
   void reset() override;
   ActResult act() override;
+  [[nodiscard]] bool isRemote() const override { return true; }
+
+  //! publish the completed receives of single regions
+  void setRegionReadiness(std::shared_ptr<GhostRegionReadiness> readiness);
 };
 } // namespace seissol::time_stepping
@@ -194,6 +194,8 @@ bool AbstractTimeCluster::maySync() {
 void AbstractTimeCluster::connect(AbstractTimeCluster &other) {
   neighbors.emplace_back(other.ct.maxTimeStepSize, other.ct.timeStepRate, other.executor);
   other.neighbors.emplace_back(ct.maxTimeStepSize, ct.timeStepRate, executor);
+  neighbors.back().remote = other.isRemote();
+  other.neighbors.back().remote = isRemote();
   neighbors.back().inbox = std::make_shared<MessageQueue>();
   other.neighbors.back().inbox = std::make_shared<MessageQueue>();
   neighbors.back().outbox = other.neighbors.back().inbox;
@@ -59,6 +59,9 @@ public:
   [[nodiscard]] virtual ActorPriority getPriority() const;
   virtual void setPriority(ActorPriority priority);
 
+  //! true, if the cluster stands in for a cluster on another rank
+  [[nodiscard]] virtual bool isRemote() const { return false; }
+
   void connect(AbstractTimeCluster& other);
   void setSyncTime(double newSyncTime);
 
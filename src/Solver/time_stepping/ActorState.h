@@ -98,6 +98,8 @@ struct NeighborCluster {
   ClusterTimes ct;
   std::shared_ptr<MessageQueue> inbox = nullptr;
   std::shared_ptr<MessageQueue> outbox = nullptr;
+  //! the neighbor represents a cluster on another rank (i.e. it is a ghost cluster)
+  bool remote = false;
 
   NeighborCluster(double maxTimeStepSize, int timeStepRate, Executor executor);
 
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "AggregatedGhostTimeCluster.h"
+
+#include <cassert>
+#include <utility>
+
+#include "Monitoring/Instrumentation.h"
+#include "Parallel/MPI.h"
+
+namespace seissol::time_stepping {
+
+AggregatedGhostTimeCluster::AggregatedGhostTimeCluster(
+    double maxTimeStepSize,
+    int timeStepRate,
+    int globalTimeClusterId,
+    int otherGlobalTimeClusterId,
+    const MeshStructure* meshStructure,
+    std::shared_ptr<MessageAggregator> aggregator)
+    : AbstractGhostTimeCluster(maxTimeStepSize,
+                               timeStepRate,
+                               globalTimeClusterId,
+                               otherGlobalTimeClusterId,
+                               meshStructure),
+      aggregator(std::move(aggregator)) {
+  this->aggregator->addParticipant();
+}
+
+void AggregatedGhostTimeCluster::sendCopyLayer() {
+  SCOREP_USER_REGION("sendCopyLayer", SCOREP_USER_REGION_TYPE_FUNCTION)
+  assert(ct.correctionTime > lastSendTime);
+  lastSendTime = ct.correctionTime;
+  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+    if (meshStructure->neighboringClusters[region][1] == otherGlobalClusterId) {
+      aggregator->send(meshStructure->neighboringClusters[region][0],
+                       meshStructure->sendIdentifiers[region],
+                       meshStructure->copyRegions[region],
+                       meshStructure->copyRegionSizes[region]);
+      sendQueue.push_back(region);
+    }
+  }
+}
+
+void AggregatedGhostTimeCluster::receiveGhostLayer() {
+  SCOREP_USER_REGION("receiveGhostLayer", SCOREP_USER_REGION_TYPE_FUNCTION)
+  assert(ct.predictionTime >= lastSendTime);
+  for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+    if (meshStructure->neighboringClusters[region][1] == otherGlobalClusterId) {
+      receiveQueue.push_back(region);
+    }
+  }
+}
+
+bool AggregatedGhostTimeCluster::testForGhostLayerReceives() {
+  SCOREP_USER_REGION("testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION)
+  aggregator->progress();
+  for (auto region = receiveQueue.begin(); region != receiveQueue.end();) {
+    if (aggregator->receive(meshStructure->neighboringClusters[*region][0],
+                            meshStructure->receiveIdentifiers[*region],
+                            meshStructure->ghostRegions[*region],
+                            meshStructure->ghostRegionSizes[*region])) {
+      markRegionReceived(*region);
+      region = receiveQueue.erase(region);
+    } else {
+      ++region;
+    }
+  }
+  return receiveQueue.empty();
+}
+
+bool AggregatedGhostTimeCluster::testForCopyLayerSends() {
+  SCOREP_USER_REGION("testForCopyLayerSends", SCOREP_USER_REGION_TYPE_FUNCTION)
+  // once packed, the copy regions may be overwritten again
+  for (auto region = sendQueue.begin(); region != sendQueue.end();) {
+    if (aggregator->isSendPending(meshStructure->neighboringClusters[*region][0],
+                                  meshStructure->sendIdentifiers[*region])) {
+      ++region;
+    } else {
+      region = sendQueue.erase(region);
+    }
+  }
+  return sendQueue.empty();
+}
+
+ActResult AggregatedGhostTimeCluster::act() {
+  const auto result = AbstractGhostTimeCluster::act();
+  aggregator->endTurn();
+  return result;
+}
+
+void AggregatedGhostTimeCluster::finalize() { aggregator->finalize(); }
+
+} // namespace seissol::time_stepping
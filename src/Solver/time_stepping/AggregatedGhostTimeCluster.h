@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_SOLVER_TIME_STEPPING_AGGREGATEDGHOSTTIMECLUSTER_H_
+#define SEISSOL_SRC_SOLVER_TIME_STEPPING_AGGREGATEDGHOSTTIMECLUSTER_H_
+
+#include <memory>
+
+#include "Initializer/Typedefs.h"
+#include "Solver/time_stepping/AbstractGhostTimeCluster.h"
+#include "Solver/time_stepping/MessageAggregator.h"
+
+namespace seissol::time_stepping {
+
+/**
+ * Ghost cluster which exchanges its regions through a MessageAggregator shared with the other
+ * ghost clusters of the rank, instead of sending one message per region.
+ */
+class AggregatedGhostTimeCluster : public AbstractGhostTimeCluster {
+  protected:
+  void sendCopyLayer() override;
+  void receiveGhostLayer() override;
+  bool testForGhostLayerReceives() override;
+  bool testForCopyLayerSends() override;
+
+  public:
+  AggregatedGhostTimeCluster(double maxTimeStepSize,
+                             int timeStepRate,
+                             int globalTimeClusterId,
+                             int otherGlobalTimeClusterId,
+                             const MeshStructure* meshStructure,
+                             std::shared_ptr<MessageAggregator> aggregator);
+
+  ActResult act() override;
+  void finalize() override;
+
+  private:
+  std::shared_ptr<MessageAggregator> aggregator;
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_SRC_SOLVER_TIME_STEPPING_AGGREGATEDGHOSTTIMECLUSTER_H_
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "CellBlockSchedule.h"
+
+#include <algorithm>
+#include <cassert>
+#include <queue>
+
+namespace seissol::time_stepping {
+
+CellBlockSchedule::CellBlockSchedule(const std::vector<std::array<unsigned, 4>>& neighbors,
+                                     const std::vector<bool>& deferred,
+                                     std::size_t blockSize) {
+  assert(neighbors.size() == deferred.size());
+  assert(blockSize > 0);
+  const auto numberOfCells = neighbors.size();
+
+  // breadth-first traversal of the face-neighbor graph;
+  // consecutive cells thus tend to share faces
+  order.reserve(numberOfCells);
+  std::vector<bool> visited(numberOfCells, false);
+  std::queue<unsigned> front;
+  for (unsigned start = 0; start < numberOfCells; ++start) {
+    if (visited[start]) {
+      continue;
+    }
+    visited[start] = true;
+    front.push(start);
+    while (!front.empty()) {
+      const auto cell = front.front();
+      front.pop();
+      order.push_back(cell);
+      for (const auto neighbor : neighbors[cell]) {
+        if (neighbor != NoNeighbor && !visited[neighbor]) {
+          visited[neighbor] = true;
+          front.push(neighbor);
+        }
+      }
+    }
+  }
+
+  std::vector<std::size_t> blockOfCell(numberOfCells);
+  for (std::size_t position = 0; position < numberOfCells; ++position) {
+    blockOfCell[order[position]] = position / blockSize;
+  }
+
+  fused.resize(numberOfCells);
+  for (std::size_t begin = 0; begin < numberOfCells; begin += blockSize) {
+    const auto end = std::min(begin + blockSize, numberOfCells);
+    const auto block = blockOffsets.size() - 1;
+    const auto firstDependency = dependencyList.size();
+    dependencyList.push_back(block);
+    for (auto position = begin; position < end; ++position) {
+      const auto cell = order[position];
+      fused[position] = !deferred[cell];
+      if (deferred[cell]) {
+        deferredCellList.push_back(cell);
+        continue;
+      }
+      for (const auto neighbor : neighbors[cell]) {
+        if (neighbor != NoNeighbor) {
+          dependencyList.push_back(blockOfCell[neighbor]);
+        }
+      }
+    }
+    const auto dependencies = dependencyList.begin() + firstDependency;
+    std::sort(dependencies, dependencyList.end());
+    dependencyList.erase(std::unique(dependencies, dependencyList.end()), dependencyList.end());
+    dependencyOffsets.push_back(dependencyList.size());
+    blockOffsets.push_back(end);
+  }
+
+  // keep the memory order for the deferred cells
+  std::sort(deferredCellList.begin(), deferredCellList.end());
+}
+
+} // namespace seissol::time_stepping
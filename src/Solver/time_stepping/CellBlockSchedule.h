@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_SOLVER_TIME_STEPPING_CELLBLOCKSCHEDULE_H_
+#define SEISSOL_SRC_SOLVER_TIME_STEPPING_CELLBLOCKSCHEDULE_H_
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace seissol::time_stepping {
+
+/**
+ * Groups the cells of a layer into blocks of neighboring cells, for the fused local+neighbor sweep.
+ *
+ * The cells are ordered by a breadth-first traversal of the face-neighbor graph, and then cut into
+ * blocks of (at most) blockSize cells. For each block, we store the list of blocks which contain
+ * the face neighbors of its cells (including the block itself): once the local integration of all
+ * these blocks is done, the neighbor integration of the block may run.
+ * Cells marked as deferred are part of the local integration sweep, but not of the fused neighbor
+ * integration; they have to be updated separately (e.g. after dynamic rupture).
+ */
+class CellBlockSchedule {
+  public:
+  //! marks a face neighbor which is not in the layer (or no neighbor at all)
+  static constexpr unsigned NoNeighbor = std::numeric_limits<unsigned>::max();
+
+  CellBlockSchedule() = default;
+  CellBlockSchedule(const std::vector<std::array<unsigned, 4>>& neighbors,
+                    const std::vector<bool>& deferred,
+                    std::size_t blockSize);
+
+  [[nodiscard]] std::size_t numberOfBlocks() const { return blockOffsets.size() - 1; }
+
+  //! all cells of the layer, in sweep order
+  [[nodiscard]] const std::vector<unsigned>& cells() const { return order; }
+
+  //! positions in cells() of the given block
+  [[nodiscard]] std::size_t blockBegin(std::size_t block) const { return blockOffsets[block]; }
+  [[nodiscard]] std::size_t blockEnd(std::size_t block) const { return blockOffsets[block + 1]; }
+
+  //! the dependencies of all blocks, sorted per block
+  [[nodiscard]] const std::vector<std::size_t>& dependencies() const { return dependencyList; }
+
+  //! positions in dependencies() of the given block; the local integration of these blocks needs
+  //! to be done before the neighbor integration of the given block
+  [[nodiscard]] std::size_t dependencyBegin(std::size_t block) const {
+    return dependencyOffsets[block];
+  }
+  [[nodiscard]] std::size_t dependencyEnd(std::size_t block) const {
+    return dependencyOffsets[block + 1];
+  }
+
+  //! true, if the cell at the given position of cells() takes part in the fused neighbor sweep
+  [[nodiscard]] bool isFused(std::size_t position) const { return fused[position]; }
+
+  //! cells which need to be updated outside of the fused sweep
+  [[nodiscard]] const std::vector<unsigned>& deferredCells() const { return deferredCellList; }
+
+  private:
+  std::vector<unsigned> order;
+  std::vector<std::size_t> blockOffsets{0};
+  std::vector<std::size_t> dependencyOffsets{0};
+  std::vector<std::size_t> dependencyList;
+  std::vector<bool> fused;
+  std::vector<unsigned> deferredCellList;
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_SRC_SOLVER_TIME_STEPPING_CELLBLOCKSCHEDULE_H_
@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "CopyRegionSchedule.h"
+
+#include <algorithm>
+#include <cassert>
+#include <numeric>
+
+namespace seissol::time_stepping {
+
+CopyRegionSchedule::CopyRegionSchedule(
+    const std::vector<unsigned>& regionSizes,
+    const std::vector<std::array<unsigned, 4>>& ghostRegionOfFace,
+    const std::vector<bool>& deferred)
+    : numberOfCells(ghostRegionOfFace.size()), regionCells(regionSizes.size()),
+      regionDependencies(regionSizes.size()) {
+  assert(std::accumulate(regionSizes.begin(), regionSizes.end(), std::size_t(0)) ==
+         ghostRegionOfFace.size());
+  assert(deferred.size() == ghostRegionOfFace.size());
+
+  unsigned regionBegin = 0;
+  for (std::size_t region = 0; region < regionSizes.size(); ++region) {
+    const unsigned regionEnd = regionBegin + regionSizes[region];
+    auto& dependencies = regionDependencies[region];
+    for (unsigned cell = regionBegin; cell < regionEnd; ++cell) {
+      for (const auto ghostRegion : ghostRegionOfFace[cell]) {
+        if (ghostRegion != NoRegion) {
+          dependencies.push_back(ghostRegion);
+        }
+      }
+    }
+    std::sort(dependencies.begin(), dependencies.end());
+    dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+
+    for (unsigned cell = regionBegin; cell < regionEnd; ++cell) {
+      if (!deferred[cell]) {
+        regionCells[region].push_back(cell);
+      }
+    }
+    regionBegin = regionEnd;
+  }
+}
+
+std::vector<unsigned>
+    CopyRegionSchedule::remainingCells(const std::vector<bool>& integrated) const {
+  std::vector<bool> done(numberOfCells, false);
+  for (std::size_t region = 0; region < regionCells.size(); ++region) {
+    if (integrated[region]) {
+      for (const auto cell : regionCells[region]) {
+        done[cell] = true;
+      }
+    }
+  }
+  std::vector<unsigned> remaining;
+  remaining.reserve(numberOfCells);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    if (!done[cell]) {
+      remaining.push_back(cell);
+    }
+  }
+  return remaining;
+}
+
+} // namespace seissol::time_stepping
@@ -0,0 +1,64 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_SOLVER_TIME_STEPPING_COPYREGIONSCHEDULE_H_
+#define SEISSOL_SRC_SOLVER_TIME_STEPPING_COPYREGIONSCHEDULE_H_
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+namespace seissol::time_stepping {
+
+/**
+ * Splits the neighbor integration of a copy layer by communication region.
+ *
+ * The copy layer consists of the copy regions (one per neighboring rank and cluster), stored one
+ * after another. For each region, we store the ghost regions its cells take face neighbors from;
+ * once these have been received, the neighbor integration of the region may run, even if other
+ * ghost regions are still missing.
+ * Deferred cells (e.g. cells at dynamic rupture faces) are always left to the regular neighbor
+ * integration.
+ */
+class CopyRegionSchedule {
+  public:
+  //! marks a face without a neighbor in the ghost layer
+  static constexpr unsigned NoRegion = std::numeric_limits<unsigned>::max();
+
+  CopyRegionSchedule() = default;
+
+  /**
+   * @param regionSizes number of copy cells per region
+   * @param ghostRegionOfFace per copy cell and face, the ghost region of the face neighbor
+   * @param deferred cells which always need to be updated by the regular neighbor integration
+   */
+  CopyRegionSchedule(const std::vector<unsigned>& regionSizes,
+                     const std::vector<std::array<unsigned, 4>>& ghostRegionOfFace,
+                     const std::vector<bool>& deferred);
+
+  [[nodiscard]] std::size_t numberOfRegions() const { return regionCells.size(); }
+
+  //! cells of the region which may be integrated early
+  [[nodiscard]] const std::vector<unsigned>& cells(std::size_t region) const {
+    return regionCells[region];
+  }
+
+  //! ghost regions which need to be received before the region may be integrated early
+  [[nodiscard]] const std::vector<unsigned>& dependencies(std::size_t region) const {
+    return regionDependencies[region];
+  }
+
+  //! all cells, except for the early cells of the regions which have been integrated already
+  [[nodiscard]] std::vector<unsigned> remainingCells(const std::vector<bool>& integrated) const;
+
+  private:
+  std::size_t numberOfCells{0};
+  std::vector<std::vector<unsigned>> regionCells;
+  std::vector<std::vector<unsigned>> regionDependencies;
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_SRC_SOLVER_TIME_STEPPING_COPYREGIONSCHEDULE_H_
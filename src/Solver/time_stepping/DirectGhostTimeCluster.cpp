@@ -9,13 +9,16 @@ void DirectGhostTimeCluster::sendCopyLayer() {
   lastSendTime = ct.correctionTime;
   for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
     if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
+      if (singlePrecision) {
+        sendRegions.pack(region, meshStructure->copyRegions[region]);
+      }
       if (persistent) {
         MPI_Start(meshStructure->sendRequests + region);
       }
       else {
-        MPI_Isend(meshStructure->copyRegions[region],
+        MPI_Isend(sendBuffer(region),
                     static_cast<int>(meshStructure->copyRegionSizes[region]),
-                    MPI_C_REAL,
+                    transferType(),
                     meshStructure->neighboringClusters[region][0],
                     DataTagOffset + meshStructure->sendIdentifiers[region],
                     seissol::MPI::mpi.comm(),
@@ -36,9 +39,9 @@ void DirectGhostTimeCluster::receiveGhostLayer() {
         MPI_Start(meshStructure->receiveRequests + region);
       }
       else {
-        MPI_Irecv(meshStructure->ghostRegions[region],
+        MPI_Irecv(receiveBuffer(region),
                   static_cast<int>(meshStructure->ghostRegionSizes[region]),
-                  MPI_C_REAL,
+                  transferType(),
                   meshStructure->neighboringClusters[region][0],
                   DataTagOffset + meshStructure->receiveIdentifiers[region],
                   seissol::MPI::mpi.comm(),
@@ -49,9 +52,33 @@ void DirectGhostTimeCluster::receiveGhostLayer() {
   }
 }
 
+void DirectGhostTimeCluster::unpackGhostRegion(unsigned int region) {
+  if (singlePrecision) {
+    receiveRegions.unpack(region, meshStructure->ghostRegions[region]);
+  }
+}
+
+void* DirectGhostTimeCluster::sendBuffer(unsigned int region) {
+  if (singlePrecision) {
+    return sendRegions.data(region);
+  }
+  return meshStructure->copyRegions[region];
+}
+
+void* DirectGhostTimeCluster::receiveBuffer(unsigned int region) {
+  if (singlePrecision) {
+    return receiveRegions.data(region);
+  }
+  return meshStructure->ghostRegions[region];
+}
+
+MPI_Datatype DirectGhostTimeCluster::transferType() const {
+  return singlePrecision ? MPI_FLOAT : MPI_C_REAL;
+}
+
 bool DirectGhostTimeCluster::testForGhostLayerReceives() {
   SCOREP_USER_REGION( "testForGhostLayerReceives", SCOREP_USER_REGION_TYPE_FUNCTION )
-  return testQueue(meshStructure->receiveRequests, receiveQueue);
+  return testReceiveQueue(meshStructure->receiveRequests);
 }
 
 DirectGhostTimeCluster::DirectGhostTimeCluster(double maxTimeStepSize,
@@ -59,25 +86,38 @@ DirectGhostTimeCluster::DirectGhostTimeCluster(double maxTimeStepSize,
                                                int globalTimeClusterId,
                                                int otherGlobalTimeClusterId,
                                                const MeshStructure *meshStructure,
-                                               bool persistent)
+                                               bool persistent,
+                                               bool singlePrecision)
     : AbstractGhostTimeCluster(maxTimeStepSize,
                                timeStepRate,
                                globalTimeClusterId,
                                otherGlobalTimeClusterId,
-                               meshStructure), persistent(persistent) {
+                               meshStructure), persistent(persistent), singlePrecision(singlePrecision) {
+    if (singlePrecision) {
+      std::vector<std::size_t> copySizes(meshStructure->numberOfRegions, 0);
+      std::vector<std::size_t> ghostSizes(meshStructure->numberOfRegions, 0);
+      for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
+        if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId)) {
+          copySizes[region] = meshStructure->copyRegionSizes[region];
+          ghostSizes[region] = meshStructure->ghostRegionSizes[region];
+        }
+      }
+      sendRegions = SinglePrecisionRegions(copySizes);
+      receiveRegions = SinglePrecisionRegions(ghostSizes);
+    }
     if (persistent) {
       for (unsigned int region = 0; region < meshStructure->numberOfRegions; ++region) {
         if (meshStructure->neighboringClusters[region][1] == static_cast<int>(otherGlobalClusterId) ) {
-          MPI_Send_init(meshStructure->copyRegions[region],
+          MPI_Send_init(sendBuffer(region),
                     static_cast<int>(meshStructure->copyRegionSizes[region]),
-                    MPI_C_REAL,
+                    transferType(),
                     meshStructure->neighboringClusters[region][0],
                     DataTagOffset + meshStructure->sendIdentifiers[region],
                     seissol::MPI::mpi.comm(),
                     meshStructure->sendRequests + region);
-          MPI_Recv_init(meshStructure->ghostRegions[region],
+          MPI_Recv_init(receiveBuffer(region),
                     static_cast<int>(meshStructure->ghostRegionSizes[region]),
-                    MPI_C_REAL,
+                    transferType(),
                     meshStructure->neighboringClusters[region][0],
                     DataTagOffset + meshStructure->receiveIdentifiers[region],
                     seissol::MPI::mpi.comm(),
@@ -3,6 +3,7 @@
 #include <list>
 #include "Initializer/Typedefs.h"
 #include "Solver/time_stepping/AbstractGhostTimeCluster.h"
+#include "Solver/time_stepping/SinglePrecisionRegions.h"
 
 
 namespace seissol::time_stepping {
@@ -11,6 +12,7 @@ protected:
   virtual void sendCopyLayer();
   virtual void receiveGhostLayer();
   virtual bool testForGhostLayerReceives();
+  void unpackGhostRegion(unsigned int region) override;
 
 public:
     DirectGhostTimeCluster(double maxTimeStepSize,
@@ -18,10 +20,19 @@ public:
                            int globalTimeClusterId,
                            int otherGlobalTimeClusterId,
                            const MeshStructure* meshStructure,
-                           bool persistent);
+                           bool persistent,
+                           bool singlePrecision = false);
     void finalize() override;
 private:
   bool persistent;
+  //! transfer the regions in single precision
+  bool singlePrecision;
+  SinglePrecisionRegions sendRegions;
+  SinglePrecisionRegions receiveRegions;
+
+  void* sendBuffer(unsigned int region);
+  void* receiveBuffer(unsigned int region);
+  MPI_Datatype transferType() const;
 };
 } // namespace seissol::time_stepping
 
@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "GhostRegionReadiness.h"
+
+#include <mutex>
+
+namespace seissol::time_stepping {
+
+GhostRegionReadiness::GhostRegionReadiness(unsigned numberOfRegions) : regions(numberOfRegions) {}
+
+void GhostRegionReadiness::markReceived(unsigned region,
+                                        double syncTime,
+                                        long predictionSteps,
+                                        bool lastBeforeSync) {
+  const std::lock_guard lock(mutex);
+  regions[region] = RegionState{syncTime, predictionSteps, lastBeforeSync};
+}
+
+bool GhostRegionReadiness::isReady(unsigned region, double syncTime, long predictionSteps) const {
+  const std::lock_guard lock(mutex);
+  const auto& state = regions[region];
+  // (the states of a previous sync interval are outdated)
+  return state.syncTime == syncTime &&
+         (state.lastBeforeSync || predictionSteps <= state.predictionSteps);
+}
+
+} // namespace seissol::time_stepping
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_SOLVER_TIME_STEPPING_GHOSTREGIONREADINESS_H_
+#define SEISSOL_SRC_SOLVER_TIME_STEPPING_GHOSTREGIONREADINESS_H_
+
+#include <mutex>
+#include <vector>
+
+namespace seissol::time_stepping {
+
+/**
+ * Tracks which ghost regions of a time cluster have received their data already.
+ *
+ * Written by the ghost clusters (possibly on the communication thread), whenever the receive of a
+ * region completes; read by the copy cluster, which may then integrate the copy cells depending on
+ * that region before the whole ghost cluster is ready.
+ * A region is described by the prediction steps (since the last sync) which its data belongs to,
+ * i.e. the value predictionsSinceLastSync of the ghost cluster after its next prediction.
+ */
+class GhostRegionReadiness {
+  public:
+  explicit GhostRegionReadiness(unsigned numberOfRegions);
+
+  //! the receive of the given region completed; its data is valid for the given prediction steps
+  //! of the sync interval ending at syncTime. If lastBeforeSync is set, it is also valid for all
+  //! subsequent steps up to the sync point.
+  void markReceived(unsigned region, double syncTime, long predictionSteps, bool lastBeforeSync);
+
+  //! true, if the data of the given region may be used by a cluster which predicted up to
+  //! predictionSteps in the sync interval ending at syncTime
+  [[nodiscard]] bool isReady(unsigned region, double syncTime, long predictionSteps) const;
+
+  private:
+  struct RegionState {
+    double syncTime{-1};
+    long predictionSteps{-1};
+    bool lastBeforeSync{false};
+  };
+
+  mutable std::mutex mutex;
+  std::vector<RegionState> regions;
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_SRC_SOLVER_TIME_STEPPING_GHOSTREGIONREADINESS_H_
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "Solver/time_stepping/AggregatedGhostTimeCluster.h"
 #include "Solver/time_stepping/DirectGhostTimeCluster.h"
 #ifdef ACL_DEVICE
 #include "Solver/time_stepping/GhostTimeClusterWithCopy.h"
@@ -16,7 +17,9 @@ struct GhostTimeClusterFactory {
                                                        int otherGlobalTimeClusterId,
                                                        const MeshStructure* meshStructure,
                                                        MPI::DataTransferMode mode,
-                                                       bool persistent) {
+                                                       bool persistent,
+                                                       bool singlePrecision = false,
+                                                       std::shared_ptr<MessageAggregator> aggregator = nullptr) {
     switch (mode) {
 #ifdef ACL_DEVICE
     case MPI::DataTransferMode::CopyInCopyOutHost: {
@@ -30,12 +33,21 @@ struct GhostTimeClusterFactory {
     }
 #endif // ACL_DEVICE
     case MPI::DataTransferMode::Direct: {
+      if (aggregator != nullptr) {
+        return std::make_unique<AggregatedGhostTimeCluster>(maxTimeStepSize,
+                                                            timeStepRate,
+                                                            globalTimeClusterId,
+                                                            otherGlobalTimeClusterId,
+                                                            meshStructure,
+                                                            std::move(aggregator));
+      }
       return std::make_unique<DirectGhostTimeCluster>(maxTimeStepSize,
                                                       timeStepRate,
                                                       globalTimeClusterId,
                                                       otherGlobalTimeClusterId,
                                                       meshStructure,
-                                                      persistent);
+                                                      persistent,
+                                                      singlePrecision);
     }
     default: {
       return nullptr;
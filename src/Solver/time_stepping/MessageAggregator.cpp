@@ -0,0 +1,170 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "MessageAggregator.h"
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+
+#include "Parallel/MPI.h"
+#include "utils/logger.h"
+
+namespace {
+constexpr int AggregateTag = 0;
+
+// the header consists of the number of parts, followed by (identifier, size) per part
+using HeaderEntry = std::int64_t;
+} // namespace
+
+namespace seissol::time_stepping {
+
+MessageAggregator::MessageAggregator(bool singlePrecision) : singlePrecision(singlePrecision) {
+  // a separate communicator keeps the aggregated messages apart from all other traffic
+  MPI_Comm_dup(seissol::MPI::mpi.comm(), &comm);
+}
+
+MessageAggregator::~MessageAggregator() { finalize(); }
+
+void MessageAggregator::addParticipant() { ++participants; }
+
+void MessageAggregator::send(int rank, int identifier, const real* data, std::size_t size) {
+  queuedSends[rank].push_back(Part{identifier, data, size});
+  pendingSends.emplace(rank, identifier);
+}
+
+bool MessageAggregator::isSendPending(int rank, int identifier) const {
+  return pendingSends.find({rank, identifier}) != pendingSends.end();
+}
+
+bool MessageAggregator::receive(int rank, int identifier, real* data, std::size_t size) {
+  const auto found = receivedRegions.find({rank, identifier});
+  if (found == receivedRegions.end() || found->second.empty()) {
+    return false;
+  }
+  const auto& received = found->second.front();
+  if (received.size != size) {
+    logError() << "Received" << received.size << "values for the ghost region" << identifier
+               << "of rank" << rank << ", but expected" << size;
+  }
+  if (singlePrecision) {
+    const auto* values = reinterpret_cast<const float*>(received.payload);
+    for (std::size_t i = 0; i < size; ++i) {
+      data[i] = static_cast<real>(values[i]);
+    }
+  } else {
+    std::memcpy(data, received.payload, size * sizeof(real));
+  }
+  found->second.pop_front();
+  return true;
+}
+
+void MessageAggregator::progress() {
+  for (auto message = messages.begin(); message != messages.end();) {
+    int testSuccess = 0;
+    MPI_Test(&message->request, &testSuccess, MPI_STATUS_IGNORE);
+    if (testSuccess) {
+      message = messages.erase(message);
+    } else {
+      ++message;
+    }
+  }
+
+  while (true) {
+    int found = 0;
+    MPI_Message handle{};
+    MPI_Status status{};
+    MPI_Improbe(MPI_ANY_SOURCE, AggregateTag, comm, &found, &handle, &status);
+    if (found == 0) {
+      break;
+    }
+    int count = 0;
+    MPI_Get_count(&status, MPI_BYTE, &count);
+    auto buffer = std::make_shared<std::vector<char>>(count);
+    MPI_Mrecv(buffer->data(), count, MPI_BYTE, &handle, MPI_STATUS_IGNORE);
+
+    // messages from the same rank arrive in order; hence, so do the parts of a region
+    HeaderEntry parts = 0;
+    std::memcpy(&parts, buffer->data(), sizeof(HeaderEntry));
+    const auto* header = buffer->data() + sizeof(HeaderEntry);
+    const auto* payload = header + 2 * parts * sizeof(HeaderEntry);
+    for (HeaderEntry part = 0; part < parts; ++part) {
+      HeaderEntry entry[2];
+      std::memcpy(entry, header + 2 * part * sizeof(HeaderEntry), sizeof(entry));
+      const auto size = static_cast<std::size_t>(entry[1]);
+      receivedRegions[{status.MPI_SOURCE, static_cast<int>(entry[0])}].push_back(
+          ReceivedPart{buffer, payload, size});
+      payload += size * valueSize();
+    }
+  }
+}
+
+void MessageAggregator::endTurn() {
+  ++turns;
+  if (turns >= participants) {
+    turns = 0;
+    flush();
+  }
+}
+
+void MessageAggregator::flush() {
+  for (auto& [rank, parts] : queuedSends) {
+    if (parts.empty()) {
+      continue;
+    }
+    std::size_t payloadSize = 0;
+    for (const auto& part : parts) {
+      payloadSize += part.size * valueSize();
+    }
+    const std::size_t headerSize = (1 + 2 * parts.size()) * sizeof(HeaderEntry);
+
+    auto& message = messages.emplace_back();
+    message.buffer.resize(headerSize + payloadSize);
+    auto* header = message.buffer.data();
+    const HeaderEntry numberOfParts = parts.size();
+    std::memcpy(header, &numberOfParts, sizeof(HeaderEntry));
+    header += sizeof(HeaderEntry);
+    auto* payload = message.buffer.data() + headerSize;
+    for (const auto& part : parts) {
+      const HeaderEntry entry[2] = {part.identifier, static_cast<HeaderEntry>(part.size)};
+      std::memcpy(header, entry, sizeof(entry));
+      header += sizeof(entry);
+      if (singlePrecision) {
+        auto* values = reinterpret_cast<float*>(payload);
+        for (std::size_t i = 0; i < part.size; ++i) {
+          values[i] = static_cast<float>(part.data[i]);
+        }
+      } else {
+        std::memcpy(payload, part.data, part.size * sizeof(real));
+      }
+      payload += part.size * valueSize();
+      pendingSends.erase({rank, part.identifier});
+    }
+    parts.clear();
+
+    MPI_Isend(message.buffer.data(),
+              static_cast<int>(message.buffer.size()),
+              MPI_BYTE,
+              rank,
+              AggregateTag,
+              comm,
+              &message.request);
+  }
+}
+
+std::size_t MessageAggregator::valueSize() const {
+  return singlePrecision ? sizeof(float) : sizeof(real);
+}
+
+void MessageAggregator::finalize() {
+  for (auto& message : messages) {
+    MPI_Wait(&message.request, MPI_STATUS_IGNORE);
+  }
+  messages.clear();
+  if (comm != MPI_COMM_NULL) {
+    MPI_Comm_free(&comm);
+  }
+}
+
+} // namespace seissol::time_stepping
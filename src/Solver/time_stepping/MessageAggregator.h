@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_SOLVER_TIME_STEPPING_MESSAGEAGGREGATOR_H_
+#define SEISSOL_SRC_SOLVER_TIME_STEPPING_MESSAGEAGGREGATOR_H_
+
+#include <cstddef>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <mpi.h>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "Kernels/Precision.h"
+
+namespace seissol::time_stepping {
+
+/**
+ * Packs the copy regions which are sent to the same rank into a single message.
+ *
+ * Shared by all ghost clusters of a rank (cf. AggregatedGhostTimeCluster). Sends are collected
+ * until each ghost cluster has acted once, i.e. for one pass of the communication manager; then,
+ * all collected regions for a rank are copied into one buffer and sent at once.
+ * Each message lists the identifiers of the regions it contains. Thus, the receiving rank does
+ * not need to know which regions were packed together: it probes for messages, and queues their
+ * parts per region. Once a ghost cluster expects its data, the part is unpacked from the received
+ * message directly into the ghost region; a message is released once all of its parts are taken.
+ */
+class MessageAggregator {
+  public:
+  //! @param singlePrecision transfer the region data in single precision
+  explicit MessageAggregator(bool singlePrecision = false);
+  ~MessageAggregator();
+
+  MessageAggregator(const MessageAggregator&) = delete;
+  MessageAggregator& operator=(const MessageAggregator&) = delete;
+
+  //! adds a ghost cluster which calls endTurn() after each of its actions
+  void addParticipant();
+
+  //! queues a copy region for the next message to the given rank; the data is copied on flush
+  void send(int rank, int identifier, const real* data, std::size_t size);
+
+  //! true, if a queued region has not been copied into a message yet
+  [[nodiscard]] bool isSendPending(int rank, int identifier) const;
+
+  //! unpacks the oldest received data of the given region into the ghost region, if available
+  bool receive(int rank, int identifier, real* data, std::size_t size);
+
+  //! handles incoming messages, and releases the buffers of completed sends
+  void progress();
+
+  //! a participant has acted; after a full pass, the queued regions are sent
+  void endTurn();
+
+  //! waits for all outstanding sends, and releases the communicator
+  void finalize();
+
+  private:
+  struct Part {
+    int identifier;
+    const real* data;
+    std::size_t size;
+  };
+
+  struct Message {
+    std::vector<char> buffer;
+    MPI_Request request;
+  };
+
+  //! a region in a received message; the message is shared by all of its parts
+  struct ReceivedPart {
+    std::shared_ptr<const std::vector<char>> message;
+    const char* payload;
+    std::size_t size;
+  };
+
+  void flush();
+
+  [[nodiscard]] std::size_t valueSize() const;
+
+  bool singlePrecision;
+  MPI_Comm comm{MPI_COMM_NULL};
+  unsigned participants{0};
+  unsigned turns{0};
+
+  std::map<int, std::vector<Part>> queuedSends;
+  std::set<std::pair<int, int>> pendingSends;
+  std::list<Message> messages;
+
+  std::map<std::pair<int, int>, std::deque<ReceivedPart>> receivedRegions;
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_SRC_SOLVER_TIME_STEPPING_MESSAGEAGGREGATOR_H_
@@ -0,0 +1,32 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "SinglePrecisionRegions.h"
+
+namespace seissol::time_stepping {
+
+SinglePrecisionRegions::SinglePrecisionRegions(const std::vector<std::size_t>& regionSizes)
+    : regions(regionSizes.size()) {
+  for (std::size_t region = 0; region < regionSizes.size(); ++region) {
+    regions[region].resize(regionSizes[region]);
+  }
+}
+
+void SinglePrecisionRegions::pack(std::size_t region, const real* data) {
+  auto& target = regions[region];
+#pragma omp simd
+  for (std::size_t i = 0; i < target.size(); ++i) {
+    target[i] = static_cast<float>(data[i]);
+  }
+}
+
+void SinglePrecisionRegions::unpack(std::size_t region, real* data) const {
+  const auto& source = regions[region];
+#pragma omp simd
+  for (std::size_t i = 0; i < source.size(); ++i) {
+    data[i] = static_cast<real>(source[i]);
+  }
+}
+
+} // namespace seissol::time_stepping
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef SEISSOL_SRC_SOLVER_TIME_STEPPING_SINGLEPRECISIONREGIONS_H_
+#define SEISSOL_SRC_SOLVER_TIME_STEPPING_SINGLEPRECISIONREGIONS_H_
+
+#include <cstddef>
+#include <vector>
+
+#include "Kernels/Precision.h"
+
+namespace seissol::time_stepping {
+
+/**
+ * Single-precision copies of the copy or ghost regions, used to halve the MPI volume.
+ *
+ * The buffers and derivatives themselves stay in the compute precision: the copy regions are
+ * rounded to single precision right before sending, and the ghost regions are widened again
+ * right after receiving.
+ */
+class SinglePrecisionRegions {
+  public:
+  SinglePrecisionRegions() = default;
+  explicit SinglePrecisionRegions(const std::vector<std::size_t>& regionSizes);
+
+  //! rounds the given region data (of size(region) values) into the single-precision copy
+  void pack(std::size_t region, const real* data);
+
+  //! widens the single-precision copy into the given region data
+  void unpack(std::size_t region, real* data) const;
+
+  [[nodiscard]] float* data(std::size_t region) { return regions[region].data(); }
+  [[nodiscard]] std::size_t size(std::size_t region) const { return regions[region].size(); }
+
+  private:
+  std::vector<std::vector<float>> regions;
+};
+
+} // namespace seissol::time_stepping
+
+#endif // SEISSOL_SRC_SOLVER_TIME_STEPPING_SINGLEPRECISIONREGIONS_H_
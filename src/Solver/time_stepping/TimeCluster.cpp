@@ -85,14 +85,41 @@
 #include "Kernels/TimeCommon.h"
 #include "Kernels/DynamicRupture.h"
 #include "Kernels/Receiver.h"
+#include "ResultWriter/EnergyOutput.h"
+#include "ResultWriter/OutputSampler.h"
 #include "Monitoring/FlopCounter.h"
 #include "Monitoring/Instrumentation.h"
+#include "Parallel/Runtime/ParallelFor.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstring>
+#include <memory>
+#include <numeric>
+#include <thread>
+#include <unordered_map>
+#include <yateto.h>
 
 #include "generated_code/kernel.h"
 
+namespace {
+// runs function (i.e. the LIKWID markers) once on each thread; skipped within the task-based
+// scheduler, where the cluster runs in a task of an enclosing parallel region already
+template <typename F>
+void onEachThread(F&& function) {
+#ifdef _OPENMP
+  if (omp_in_parallel()) {
+    return;
+  }
+#pragma omp parallel
+  function();
+#else
+  function();
+#endif
+}
+} // namespace
+
 seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsigned int i_globalClusterId,
                                                  unsigned int profilingId,
                                                  bool usePlasticity,
@@ -120,6 +147,9 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
     ),
     // cluster ids
     usePlasticity(usePlasticity),
+    usePlasticityBlocks(seissol::usePlasticityCellBlocks()),
+    useFusedSweep(seissol::useFusedSweep()),
+    useCopyRegions(seissol::useCopyRegionIntegration()),
     seissolInstance(seissolInstance),
     m_globalDataOnHost( i_globalData.onHost ),
     m_globalDataOnDevice(i_globalData.onDevice ),
@@ -161,12 +191,25 @@ seissol::time_stepping::TimeCluster::TimeCluster(unsigned int i_clusterId, unsig
   m_neighborKernel.setGlobalData(i_globalData);
   m_dynamicRuptureKernel.setGlobalData(i_globalData);
 
+  if (usePlasticity) {
+    plasticityScreening = seissol::kernels::Plasticity::computeScreening(m_globalDataOnHost);
+    plasticityActiveSet.resize(m_clusterData->getNumberOfCells(), 0);
+    if (usePlasticityBlocks) {
+#ifdef _OPENMP
+      plasticityCandidates.resize(omp_get_max_threads());
+#else
+      plasticityCandidates.resize(1);
+#endif
+    }
+  }
+
   computeFlops();
 
   m_regionComputeLocalIntegration = m_loopStatistics->getRegion("computeLocalIntegration");
   m_regionComputeNeighboringIntegration = m_loopStatistics->getRegion("computeNeighboringIntegration");
   m_regionComputeDynamicRupture = m_loopStatistics->getRegion("computeDynamicRupture");
   m_regionComputePointSources = m_loopStatistics->getRegion("computePointSources");
+  m_regionComputeFusedIntegration = m_loopStatistics->getRegion("computeFusedIntegration");
 }
 
 seissol::time_stepping::TimeCluster::~TimeCluster() {
@@ -188,6 +231,62 @@ void seissol::time_stepping::TimeCluster::writeReceivers() {
   }
 }
 
+void seissol::time_stepping::TimeCluster::stageOutput() {
+  SCOREP_USER_REGION("stageOutput", SCOREP_USER_REGION_TYPE_FUNCTION)
+
+  m_firstOutputIndex = m_outputIndex;
+  m_stagedDofs.clear();
+  m_expansionTimes.clear();
+  if (m_outputSampler == nullptr) {
+    return;
+  }
+
+  // all output times in [correctionTime, correctionTime + timeStepSize()); an output at the end
+  // of the time step belongs to the next one (or to the final synchronization point)
+  while (m_outputSampler->time(m_outputIndex) < ct.correctionTime + timeStepSize()) {
+    ++m_outputIndex;
+  }
+
+  const auto numberOfCells = m_clusterData->getNumberOfCells();
+  if (numberOfCells == 0) {
+    return;
+  }
+  const real* dofs = reinterpret_cast<const real*>(m_clusterData->var(m_lts->dofs));
+  for (auto index = m_firstOutputIndex; index < m_outputIndex; ++index) {
+    m_stagedDofs.push_back(m_outputSampler->stageDofs(index, dofs));
+    // expand relative to the start of the time step, to keep the precision for large times
+    m_expansionTimes.push_back(m_outputSampler->time(index) - ct.correctionTime);
+    if (usePlasticity) {
+      // the plastic strain is not predicted; we take it from the start of the time step
+      const auto* pstrain = m_clusterData->var(m_lts->pstrain);
+      const auto* pstrainBegin = reinterpret_cast<const real*>(pstrain);
+      std::copy_n(pstrainBegin,
+                  numberOfCells * sizeof(pstrain[0]) / sizeof(real),
+                  m_outputSampler->stagePstrain(index, pstrainBegin));
+    }
+  }
+}
+
+void seissol::time_stepping::TimeCluster::sampleOutput(std::size_t cell, const real* timeDerivatives) {
+  for (std::size_t i = 0; i < m_stagedDofs.size(); ++i) {
+    m_timeKernel.computeTaylorExpansion(m_expansionTimes[i],
+                                        0.0,
+                                        timeDerivatives,
+                                        m_stagedDofs[i] + cell * tensor::Q::size());
+  }
+}
+
+void seissol::time_stepping::TimeCluster::contributeOutput() {
+  if (m_outputSampler == nullptr) {
+    return;
+  }
+  for (auto index = m_firstOutputIndex; index < m_outputIndex; ++index) {
+    m_outputSampler->contribute(index);
+  }
+  m_stagedDofs.clear();
+  m_expansionTimes.clear();
+}
+
 std::vector<seissol::time_stepping::NeighborCluster>*
     seissol::time_stepping::TimeCluster::getNeighborClusters() {
   return &neighbors;
@@ -215,10 +314,10 @@ void seissol::time_stepping::TimeCluster::computeSources() {
   }();
 
   if (pointSourceCluster) {
-    m_loopStatistics->begin(m_regionComputePointSources);
+    const auto beginTime = LoopStatistics::begin();
     auto timeStepSizeLocal = timeStepSize();
     pointSourceCluster->addTimeIntegratedPointSources(ct.correctionTime, ct.correctionTime + timeStepSizeLocal, streamRuntime);
-    m_loopStatistics->end(m_regionComputePointSources, pointSourceCluster->size(), m_profilingId);
+    m_loopStatistics->end(m_regionComputePointSources, beginTime, pointSourceCluster->size(), m_profilingId);
   }
 #ifdef ACL_DEVICE
   device.api->popLastProfilingMark();
@@ -230,7 +329,7 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   SCOREP_USER_REGION_DEFINE(myRegionHandle)
   SCOREP_USER_REGION_BEGIN(myRegionHandle, "computeDynamicRuptureSpaceTimeInterpolation", SCOREP_USER_REGION_TYPE_COMMON )
 
-  m_loopStatistics->begin(m_regionComputeDynamicRupture);
+  const auto beginTime = LoopStatistics::begin();
 
   DRFaceInformation* faceInformation = layerData.var(m_dynRup->faceInformation);
   DRGodunovData* godunovData = layerData.var(m_dynRup->godunovData);
@@ -243,14 +342,10 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
   m_dynamicRuptureKernel.setTimeStepWidth(timeStepSize());
   frictionSolver->computeDeltaT(m_dynamicRuptureKernel.timePoints);
 
-#pragma omp parallel 
-  {
-  LIKWID_MARKER_START("computeDynamicRuptureSpaceTimeInterpolation");
-  }
-#ifdef _OPENMP
-  #pragma omp parallel for schedule(static)
-#endif
-  for (unsigned face = 0; face < layerData.getNumberOfCells(); ++face) {
+  onEachThread([]() {
+    LIKWID_MARKER_START("computeDynamicRuptureSpaceTimeInterpolation");
+  });
+  seissol::parallel::runtime::parallelFor(layerData.getNumberOfCells(), [&](std::size_t face) {
     unsigned prefetchFace = (face < layerData.getNumberOfCells()-1) ? face+1 : face;
     m_dynamicRuptureKernel.spaceTimeInterpolation(faceInformation[face],
                                                   m_globalDataOnHost,
@@ -262,13 +357,12 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
                                                   qInterpolatedMinus[face],
                                                   timeDerivativePlus[prefetchFace],
                                                   timeDerivativeMinus[prefetchFace]);
-  }
+  });
   SCOREP_USER_REGION_END(myRegionHandle)
-#pragma omp parallel 
-  {
-  LIKWID_MARKER_STOP("computeDynamicRuptureSpaceTimeInterpolation");
-  LIKWID_MARKER_START("computeDynamicRuptureFrictionLaw");
-  }
+  onEachThread([]() {
+    LIKWID_MARKER_STOP("computeDynamicRuptureSpaceTimeInterpolation");
+    LIKWID_MARKER_START("computeDynamicRuptureFrictionLaw");
+  });
 
   SCOREP_USER_REGION_BEGIN(myRegionHandle, "computeDynamicRuptureFrictionLaw", SCOREP_USER_REGION_TYPE_COMMON )
   frictionSolver->evaluate(layerData,
@@ -277,19 +371,18 @@ void seissol::time_stepping::TimeCluster::computeDynamicRupture( seissol::initia
                            m_dynamicRuptureKernel.timeWeights,
                            streamRuntime);
   SCOREP_USER_REGION_END(myRegionHandle)
-#pragma omp parallel 
-  {
-  LIKWID_MARKER_STOP("computeDynamicRuptureFrictionLaw");
-  }
+  onEachThread([]() {
+    LIKWID_MARKER_STOP("computeDynamicRuptureFrictionLaw");
+  });
 
-  m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), m_profilingId);
+  m_loopStatistics->end(m_regionComputeDynamicRupture, beginTime, layerData.getNumberOfCells(), m_profilingId);
 }
 
 #ifdef ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeDynamicRuptureDevice( seissol::initializer::Layer&  layerData ) {
   SCOREP_USER_REGION( "computeDynamicRupture", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-  m_loopStatistics->begin(m_regionComputeDynamicRupture);
+  const auto beginTime = LoopStatistics::begin();
 
   if (layerData.getNumberOfCells() > 0) {
     // compute space time interpolation part
@@ -326,7 +419,7 @@ void seissol::time_stepping::TimeCluster::computeDynamicRuptureDevice( seissol::
     }
     streamRuntime.wait();
   }
-  m_loopStatistics->end(m_regionComputeDynamicRupture, layerData.getNumberOfCells(), m_profilingId);
+  m_loopStatistics->end(m_regionComputeDynamicRupture, beginTime, layerData.getNumberOfCells(), m_profilingId);
 }
 #endif
 
@@ -352,14 +445,19 @@ void seissol::time_stepping::TimeCluster::computeDynamicRuptureFlops( seissol::i
 void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initializer::Layer& i_layerData, bool resetBuffers ) {
   SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
 
-  m_loopStatistics->begin(m_regionComputeLocalIntegration);
+  const auto beginTime = LoopStatistics::begin();
 
-  // local integration buffer
-  alignas(Alignment) real l_integrationBuffer[tensor::I::size()];
+  computeLocalIntegrationImplementation(i_layerData, resetBuffers, [&](auto&& localCell) {
+    seissol::parallel::runtime::parallelFor(i_layerData.getNumberOfCells(), localCell);
+  });
 
-  // pointer for the call of the ADER-function
-  real* l_bufferPointer;
+  m_loopStatistics->end(m_regionComputeLocalIntegration, beginTime, i_layerData.getNumberOfCells(), m_profilingId);
+}
 
+template<typename LoopT>
+void seissol::time_stepping::TimeCluster::computeLocalIntegrationImplementation(seissol::initializer::Layer& i_layerData,
+                                                                                bool resetBuffers,
+                                                                                LoopT&& loop) {
   real** buffers = i_layerData.var(m_lts->buffers);
   real** derivatives = i_layerData.var(m_lts->derivatives);
   CellMaterialData* materialData = i_layerData.var(m_lts->material);
@@ -368,10 +466,31 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
   loader.load(*m_lts, i_layerData);
   kernels::LocalTmp tmp(seissolInstance.getGravitationSetup().acceleration);
 
+  // one copy of the scratch memory per thread (as with firstprivate); the loop may run inside of a
+  // parallel region (task-based scheduler), or open its own one
 #ifdef _OPENMP
-  #pragma omp parallel for private(l_bufferPointer, l_integrationBuffer), firstprivate(tmp) schedule(static)
+  const auto numberOfThreads = static_cast<std::size_t>(std::max(omp_get_max_threads(), omp_get_num_threads()));
+#else
+  const std::size_t numberOfThreads = 1;
 #endif
-  for (unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++) {
+  std::vector<kernels::LocalTmp> threadTmp(numberOfThreads, tmp);
+
+  loop([&](std::size_t l_cell) {
+#ifdef _OPENMP
+    auto& cellTmp = threadTmp[omp_get_thread_num()];
+#else
+    auto& cellTmp = threadTmp[0];
+#endif
+
+    // local integration buffer
+    alignas(Alignment) real l_integrationBuffer[tensor::I::size()];
+
+    // time derivatives for the output sampling, if the cell does not store its own
+    alignas(Alignment) real l_derivativesBuffer[yateto::computeFamilySize<tensor::dQ>()];
+
+    // pointer for the call of the ADER-function
+    real* l_bufferPointer;
+
     auto data = loader.entry(l_cell);
 
     // We need to check, whether we can overwrite the buffer or if it is
@@ -391,18 +510,26 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
       l_bufferPointer = l_integrationBuffer;
     }
 
+    real* l_derivativesPointer = derivatives[l_cell];
+    if (l_derivativesPointer == nullptr && !m_stagedDofs.empty()) {
+      l_derivativesPointer = l_derivativesBuffer;
+    }
+
     m_timeKernel.computeAder(timeStepSize(),
                              data,
-                             tmp,
+                             cellTmp,
                              l_bufferPointer,
-                             derivatives[l_cell],
+                             l_derivativesPointer,
                              true);
 
+    // evaluate the staged output times from the derivatives of the predictor
+    sampleOutput(l_cell, l_derivativesPointer);
+
     // Compute local integrals (including some boundary conditions)
     CellBoundaryMapping (*boundaryMapping)[4] = i_layerData.var(m_lts->boundaryMapping);
     m_localKernel.computeIntegral(l_bufferPointer,
                                   data,
-                                  tmp,
+                                  cellTmp,
                                   &materialData[l_cell],
                                   &boundaryMapping[l_cell],
                                   ct.correctionTime,
@@ -434,9 +561,7 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegration(seissol::initi
         buffers[l_cell][l_dof] += l_integrationBuffer[l_dof];
       }
     }
-  }
-
-  m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), m_profilingId);
+  });
 }
 #ifdef ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeLocalIntegrationDevice(
@@ -446,7 +571,7 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegrationDevice(
   SCOREP_USER_REGION( "computeLocalIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
   device.api->putProfilingMark("computeLocalIntegration", device::ProfilingColors::Yellow);
 
-  m_loopStatistics->begin(m_regionComputeLocalIntegration);
+  const auto beginTime = LoopStatistics::begin();
 
   auto& dataTable = i_layerData.getConditionalTable<inner_keys::Wp>();
   auto& materialTable = i_layerData.getConditionalTable<inner_keys::Material>();
@@ -533,25 +658,294 @@ void seissol::time_stepping::TimeCluster::computeLocalIntegrationDevice(
 
   streamRuntime.wait();
 
-  m_loopStatistics->end(m_regionComputeLocalIntegration, i_layerData.getNumberOfCells(), m_profilingId);
+  m_loopStatistics->end(m_regionComputeLocalIntegration, beginTime, i_layerData.getNumberOfCells(), m_profilingId);
   device.api->popLastProfilingMark();
 }
 #endif // ACL_DEVICE
 
 void seissol::time_stepping::TimeCluster::computeNeighboringIntegration(seissol::initializer::Layer& i_layerData,
                                                                         double subTimeStart) {
+  if (i_layerData.getNumberOfCells() == 0) return;
+  SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+  const auto beginTime = LoopStatistics::begin();
+
+  // with the fused sweep or the early integration of copy regions, only the cells left out by these remain
+  const std::vector<unsigned>* cells = nullptr;
+  std::vector<unsigned> remainingCells;
+  if (neighborIntegrationFused) {
+    cells = &blockSchedule->deferredCells();
+  } else if (std::find(copyRegionsIntegrated.begin(), copyRegionsIntegrated.end(), true) != copyRegionsIntegrated.end()) {
+    remainingCells = copyRegionSchedule->remainingCells(copyRegionsIntegrated);
+    cells = &remainingCells;
+  }
+  neighborIntegrationFused = false;
+  std::fill(copyRegionsIntegrated.begin(), copyRegionsIntegrated.end(), false);
+
+  const auto numberOfCells = cells != nullptr ? cells->size() : i_layerData.getNumberOfCells();
+  auto loop = [&](auto&& neighborCell) {
+    if (cells != nullptr) {
+      return seissol::parallel::runtime::parallelForSum<unsigned>(cells->size(), [&](std::size_t i) {
+        return neighborCell((*cells)[i]);
+      });
+    }
+    return seissol::parallel::runtime::parallelForSum<unsigned>(i_layerData.getNumberOfCells(), neighborCell);
+  };
+
+  if (usePlasticity) {
+    computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart, loop);
+  } else {
+    computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart, loop);
+  }
+
+  m_loopStatistics->end(m_regionComputeNeighboringIntegration, beginTime, numberOfCells, m_profilingId);
+}
+
+void seissol::time_stepping::TimeCluster::computeFusedIntegration(seissol::initializer::Layer& i_layerData,
+                                                                  bool resetBuffers,
+                                                                  double subTimeStart) {
+  SCOREP_USER_REGION( "computeFusedIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
+
+  const auto beginTime = LoopStatistics::begin();
+
+  const auto& schedule = *blockSchedule;
+  const auto numberOfBlocks = schedule.numberOfBlocks();
+  auto localDone = std::make_unique<std::atomic<bool>[]>(numberOfBlocks);
+  for (std::size_t block = 0; block < numberOfBlocks; ++block) {
+    localDone[block].store(false, std::memory_order_relaxed);
+  }
+
+  auto sweep = [&](auto&& localCell, auto&& neighborCell) {
+    unsigned yieldedCells = 0;
+#ifdef _OPENMP
+#pragma omp parallel reduction(+:yieldedCells)
+#endif
+    {
+#ifdef _OPENMP
+      const std::size_t threadId = omp_get_thread_num();
+      const std::size_t numberOfThreads = omp_get_num_threads();
+#else
+      const std::size_t threadId = 0;
+      const std::size_t numberOfThreads = 1;
+#endif
+      // contiguous chunks of blocks per thread, as with a static schedule
+      const auto firstBlock = (numberOfBlocks * threadId) / numberOfThreads;
+      const auto lastBlock = (numberOfBlocks * (threadId + 1)) / numberOfThreads;
+
+      auto isReady = [&](std::size_t block) {
+        for (auto position = schedule.dependencyBegin(block); position < schedule.dependencyEnd(block); ++position) {
+          if (!localDone[schedule.dependencies()[position]].load(std::memory_order_acquire)) {
+            return false;
+          }
+        }
+        return true;
+      };
+      auto neighborBlock = [&](std::size_t block) {
+        for (auto position = schedule.blockBegin(block); position < schedule.blockEnd(block); ++position) {
+          if (schedule.isFused(position)) {
+            yieldedCells += neighborCell(schedule.cells()[position]);
+          }
+        }
+      };
+
+      // The neighbor integration of a block follows as soon as the local integration of all blocks
+      // containing its face neighbors is done; the data of the block is then likely still in cache.
+      auto nextNeighborBlock = firstBlock;
+      for (auto block = firstBlock; block < lastBlock; ++block) {
+        for (auto position = schedule.blockBegin(block); position < schedule.blockEnd(block); ++position) {
+          localCell(schedule.cells()[position]);
+        }
+        localDone[block].store(true, std::memory_order_release);
+        while (nextNeighborBlock <= block && isReady(nextNeighborBlock)) {
+          neighborBlock(nextNeighborBlock++);
+        }
+      }
+      // the remaining blocks depend on blocks of other threads; their local integration never waits
+      while (nextNeighborBlock < lastBlock) {
+        if (isReady(nextNeighborBlock)) {
+          neighborBlock(nextNeighborBlock++);
+        } else {
+          // leave the core to other threads (e.g. the communication thread) instead of spinning
+          std::this_thread::yield();
+        }
+      }
+    }
+    return yieldedCells;
+  };
+
+  computeLocalIntegrationImplementation(i_layerData, resetBuffers, [&](auto&& localCell) {
+    auto neighborLoop = [&](auto&& neighborCell) {
+      return sweep(localCell, neighborCell);
+    };
+    if (usePlasticity) {
+      computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart, neighborLoop);
+    } else {
+      computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart, neighborLoop);
+    }
+  });
+
+  m_loopStatistics->end(m_regionComputeFusedIntegration, beginTime, i_layerData.getNumberOfCells(), m_profilingId);
+}
+
+void seissol::time_stepping::TimeCluster::initializeBlockSchedule(seissol::initializer::Layer& layerData) {
+  const auto numberOfCells = layerData.getNumberOfCells();
+  real** buffers = layerData.var(m_lts->buffers);
+  real** derivatives = layerData.var(m_lts->derivatives);
+  real* (*faceNeighbors)[4] = layerData.var(m_lts->faceNeighbors);
+  CellLocalInformation* cellInformation = layerData.var(m_lts->cellInformation);
+
+  // the face neighbors are only known by their buffers/derivatives; map these back to cells
+  std::unordered_map<const real*, unsigned> cellOfData;
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    if (buffers[cell] != nullptr) {
+      cellOfData[buffers[cell]] = cell;
+    }
+    if (derivatives[cell] != nullptr) {
+      cellOfData[derivatives[cell]] = cell;
+    }
+  }
+
+  std::vector<std::array<unsigned, 4>> neighbors(numberOfCells);
+  std::vector<bool> deferred(numberOfCells, false);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      neighbors[cell][face] = CellBlockSchedule::NoNeighbor;
+      if (cellInformation[cell].faceTypes[face] == FaceType::DynamicRupture) {
+        // needs the dynamic rupture fluxes, which are computed during the correction
+        deferred[cell] = true;
+      }
+      const auto found = cellOfData.find(faceNeighbors[cell][face]);
+      if (found != cellOfData.end()) {
+        neighbors[cell][face] = found->second;
+      }
+    }
+  }
+
+  std::size_t blockSize = seissol::fusedSweepBlockCells();
+  if (blockSize == 0) {
+    // aim for the data touched by a block to fit into a (per-core) L2 cache of 1 MiB
+    constexpr std::size_t BytesPerCell = sizeof(real) * (tensor::Q::size() + tensor::I::size())
+        + sizeof(LocalIntegrationData) + sizeof(NeighboringIntegrationData) + sizeof(CellLocalInformation);
+    blockSize = std::max<std::size_t>(1, (1UL << 20) / BytesPerCell);
+  }
+
+  blockSchedule.emplace(neighbors, deferred, blockSize);
+}
+
+void seissol::time_stepping::TimeCluster::initializeCopyRegionSchedule(seissol::initializer::Layer& layerData) {
+  const auto numberOfCells = layerData.getNumberOfCells();
+  real* (*faceNeighbors)[4] = layerData.var(m_lts->faceNeighbors);
+  CellLocalInformation* cellInformation = layerData.var(m_lts->cellInformation);
+
+  const std::vector<unsigned> regionSizes(meshStructure->numberOfCopyRegionCells,
+                                          meshStructure->numberOfCopyRegionCells + meshStructure->numberOfRegions);
+  if (std::accumulate(regionSizes.begin(), regionSizes.end(), 0U) != numberOfCells) {
+    // the copy layer does not consist of its regions only; leave it to the regular integration
+    useCopyRegions = false;
+    return;
+  }
+
+  // the ghost buffers/derivatives of the face neighbors identify the ghost regions
+  std::vector<std::array<unsigned, 4>> ghostRegionOfFace(numberOfCells);
+  std::vector<bool> deferred(numberOfCells, false);
+  for (unsigned cell = 0; cell < numberOfCells; ++cell) {
+    for (unsigned face = 0; face < 4; ++face) {
+      ghostRegionOfFace[cell][face] = CopyRegionSchedule::NoRegion;
+      if (cellInformation[cell].faceTypes[face] == FaceType::DynamicRupture) {
+        // needs the dynamic rupture fluxes, which are computed during the correction
+        deferred[cell] = true;
+      }
+      const real* neighbor = faceNeighbors[cell][face];
+      for (unsigned region = 0; region < meshStructure->numberOfRegions; ++region) {
+        const real* begin = meshStructure->ghostRegions[region];
+        if (neighbor != nullptr && begin != nullptr && neighbor >= begin
+            && neighbor < begin + meshStructure->ghostRegionSizes[region]) {
+          ghostRegionOfFace[cell][face] = region;
+        }
+      }
+    }
+  }
+
+  copyRegionSchedule.emplace(regionSizes, ghostRegionOfFace, deferred);
+  copyRegionsIntegrated.assign(copyRegionSchedule->numberOfRegions(), false);
+}
+
+bool seissol::time_stepping::TimeCluster::integrateReadyCopyRegions() {
+  if (!useCopyRegions || ghostRegionReadiness == nullptr || executor != Executor::Host
+      || state != ActorState::Predicted || neighborIntegrationFused
+      || m_clusterData->getNumberOfCells() == 0) {
+    return false;
+  }
+
+  // all local neighbors (and all neighbors providing time derivatives, which determine lastSubTime)
+  // need to be as far as they are for the correction
+  while (processMessages()) {}
+  for (auto& neighbor : neighbors) {
+    if (neighbor.remote && neighbor.ct.timeStepRate <= ct.timeStepRate) {
+      continue;
+    }
+    const bool isSynced = neighbor.ct.stepsUntilSync <= neighbor.ct.predictionsSinceLastSync;
+    if (!isSynced && ct.predictionsSinceLastSync > neighbor.ct.predictionsSinceLastSync) {
+      return false;
+    }
+  }
+
+  if (!copyRegionSchedule.has_value()) {
+    initializeCopyRegionSchedule(*m_clusterData);
+    if (!useCopyRegions) {
+      return false;
+    }
+  }
+  const auto& schedule = *copyRegionSchedule;
+
+  std::vector<unsigned> readyCells;
+  std::vector<std::size_t> readyRegions;
+  for (std::size_t region = 0; region < schedule.numberOfRegions(); ++region) {
+    if (copyRegionsIntegrated[region] || schedule.cells(region).empty()) {
+      continue;
+    }
+    const auto& dependencies = schedule.dependencies(region);
+    const bool ready = std::all_of(dependencies.begin(), dependencies.end(), [&](unsigned ghostRegion) {
+      return ghostRegionReadiness->isReady(ghostRegion, syncTime, ct.predictionsSinceLastSync);
+    });
+    if (ready) {
+      readyRegions.push_back(region);
+      readyCells.insert(readyCells.end(), schedule.cells(region).begin(), schedule.cells(region).end());
+    }
+  }
+  if (readyRegions.empty()) {
+    return false;
+  }
+
+  SCOREP_USER_REGION( "integrateReadyCopyRegions", SCOREP_USER_REGION_TYPE_FUNCTION )
+  const auto beginTime = LoopStatistics::begin();
+
+  const double subTimeStart = ct.correctionTime - lastSubTime;
+  auto loop = [&](auto&& neighborCell) {
+    return seissol::parallel::runtime::parallelForSum<unsigned>(readyCells.size(), [&](std::size_t i) {
+      return neighborCell(readyCells[i]);
+    });
+  };
   if (usePlasticity) {
-    computeNeighboringIntegrationImplementation<true>(i_layerData, subTimeStart);
+    computeNeighboringIntegrationImplementation<true>(*m_clusterData, subTimeStart, loop);
   } else {
-    computeNeighboringIntegrationImplementation<false>(i_layerData, subTimeStart);
+    computeNeighboringIntegrationImplementation<false>(*m_clusterData, subTimeStart, loop);
+  }
+
+  m_loopStatistics->end(m_regionComputeNeighboringIntegration, beginTime, readyCells.size(), m_profilingId);
+
+  for (const auto region : readyRegions) {
+    copyRegionsIntegrated[region] = true;
   }
+  return true;
 }
+
 #ifdef ACL_DEVICE
 void seissol::time_stepping::TimeCluster::computeNeighboringIntegrationDevice( seissol::initializer::Layer&  i_layerData,
                                                                          double subTimeStart) {
   device.api->putProfilingMark("computeNeighboring", device::ProfilingColors::Red);
   SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
-  m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
+  const auto beginTime = LoopStatistics::begin();
 
   const double timeStepWidth = timeStepSize();
   auto& table = i_layerData.getConditionalTable<inner_keys::Wp>();
@@ -590,7 +984,7 @@ void seissol::time_stepping::TimeCluster::computeNeighboringIntegrationDevice( s
 
   device.api->popLastProfilingMark();
   streamRuntime.wait();
-  m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_profilingId);
+  m_loopStatistics->end(m_regionComputeNeighboringIntegration, beginTime, i_layerData.getNumberOfCells(), m_profilingId);
 }
 #endif // ACL_DEVICE
 
@@ -665,6 +1059,8 @@ void seissol::time_stepping::TimeCluster::computeFlops() {
                              m_flops_nonZero[static_cast<int>(ComputePart::DRFrictionLawCopy)],
                              m_flops_hardware[static_cast<int>(ComputePart::DRFrictionLawCopy)]);
   seissol::kernels::Plasticity::flopsPlasticity(
+          m_flops_nonZero[static_cast<int>(ComputePart::PlasticityScreen)],
+          m_flops_hardware[static_cast<int>(ComputePart::PlasticityScreen)],
           m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)],
           m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)],
           m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)],
@@ -690,7 +1086,12 @@ void TimeCluster::handleAdvancedCorrectionTimeMessage(const NeighborCluster&) {
 }
 void TimeCluster::predict() {
   assert(state == ActorState::Corrected);
-  if (m_clusterData->getNumberOfCells() == 0) return;
+  // (also for empty clusters; the output waits for the contributions of all clusters)
+  stageOutput();
+  if (m_clusterData->getNumberOfCells() == 0) {
+    contributeOutput();
+    return;
+  }
 
   bool resetBuffers = true;
   for (auto& neighbor : neighbors) {
@@ -712,8 +1113,17 @@ void TimeCluster::predict() {
     computeLocalIntegration(*m_clusterData, resetBuffers);
   }
 #else
-  computeLocalIntegration(*m_clusterData, resetBuffers);
+  if (mayFuseIntegration()) {
+    if (!blockSchedule.has_value()) {
+      initializeBlockSchedule(*m_clusterData);
+    }
+    computeFusedIntegration(*m_clusterData, resetBuffers, ct.correctionTime - lastSubTime);
+    neighborIntegrationFused = true;
+  } else {
+    computeLocalIntegration(*m_clusterData, resetBuffers);
+  }
 #endif
+  contributeOutput();
   computeSources();
 
   seissolInstance.flopCounter().incrementNonZeroFlopsLocal(m_flops_nonZero[static_cast<int>(ComputePart::Local)]);
@@ -727,6 +1137,31 @@ void TimeCluster::predict() {
 #endif
 }
 
+bool TimeCluster::mayFuseIntegration() {
+  // the fused sweep brings its own parallel region, and the point sources need to be added
+  // before the (non-linear) plasticity correction
+#ifdef _OPENMP
+  const bool inParallel = omp_in_parallel();
+#else
+  const bool inParallel = false;
+#endif
+  if (!useFusedSweep || executor != Executor::Host || inParallel
+      || (m_sourceCluster.host != nullptr && m_sourceCluster.host->size() > 0)) {
+    return false;
+  }
+
+  // take all pending messages into account, and check if mayCorrect() will hold after our prediction
+  while (processMessages()) {}
+  const auto predictionsAfterwards = ct.predictionsSinceLastSync + ct.timeStepRate;
+  for (auto& neighbor : neighbors) {
+    const bool isSynced = neighbor.ct.stepsUntilSync <= neighbor.ct.predictionsSinceLastSync;
+    if (!isSynced && predictionsAfterwards > neighbor.ct.predictionsSinceLastSync) {
+      return false;
+    }
+  }
+  return true;
+}
+
 void TimeCluster::handleDynamicRupture(initializer::Layer& layerData) {
 #ifdef ACL_DEVICE
   if (executor == Executor::Device) {
@@ -819,6 +1254,12 @@ void TimeCluster::correct() {
 
   // TODO(Lukas) Adjust with time step rate? Relevant is maximum cluster is not on this node
   const auto nextCorrectionSteps = ct.nextCorrectionSteps();
+
+  // the cells are still in cache after the neighbor integration
+  if (m_energyOutput != nullptr && nextCorrectionSteps >= ct.stepsUntilSync) {
+    m_energyOutput->accumulateVolumeEnergies(*m_clusterData);
+  }
+
   if constexpr (USE_MPI) {
     if (printProgress && (((nextCorrectionSteps / timeStepRate) % 100) == 0)) {
       const int rank = MPI::mpi.rank();
@@ -878,31 +1319,31 @@ void TimeCluster::finalize() {
   streamRuntime.dispose();
 }
 
-template<bool usePlasticity>
-    std::pair<long, long> TimeCluster::computeNeighboringIntegrationImplementation(seissol::initializer::Layer& i_layerData,
-                                                                      double subTimeStart) {
-      if (i_layerData.getNumberOfCells() == 0) return {0,0};
-      SCOREP_USER_REGION( "computeNeighboringIntegration", SCOREP_USER_REGION_TYPE_FUNCTION )
-
-      m_loopStatistics->begin(m_regionComputeNeighboringIntegration);
-
+template<bool usePlasticity, typename LoopT>
+    void TimeCluster::computeNeighboringIntegrationImplementation(seissol::initializer::Layer& i_layerData,
+                                                                  double subTimeStart,
+                                                                  LoopT&& loop) {
       real* (*faceNeighbors)[4] = i_layerData.var(m_lts->faceNeighbors);
       CellDRMapping (*drMapping)[4] = i_layerData.var(m_lts->drMapping);
       CellLocalInformation* cellInformation = i_layerData.var(m_lts->cellInformation);
       auto* plasticity = i_layerData.var(m_lts->plasticity);
       auto* pstrain = i_layerData.var(m_lts->pstrain);
-      unsigned numberOTetsWithPlasticYielding = 0;
 
       kernels::NeighborData::Loader loader;
       loader.load(*m_lts, i_layerData);
 
-      real *l_timeIntegrated[4];
-      real *l_faceNeighbors_prefetch[4];
+      if constexpr (usePlasticity) {
+        updateRelaxTime();
+      }
+
+      std::atomic<long long> numberOfScreenedTets{0};
+      std::atomic<long long> numberOfCheckedTets{0};
+
+      auto numberOTetsWithPlasticYielding = loop([&](std::size_t l_cell) -> unsigned {
+        real *l_timeIntegrated[4];
+        real *l_faceNeighbors_prefetch[4];
+        unsigned yielded = 0;
 
-#ifdef _OPENMP
-#pragma omp parallel for schedule(static) default(none) private(l_timeIntegrated, l_faceNeighbors_prefetch) shared(cellInformation, loader, faceNeighbors, pstrain, i_layerData, plasticity, drMapping, subTimeStart) reduction(+:numberOTetsWithPlasticYielding)
-#endif
-      for( unsigned int l_cell = 0; l_cell < i_layerData.getNumberOfCells(); l_cell++ ) {
         auto data = loader.entry(l_cell);
         seissol::kernels::TimeCommon::computeIntegrals(m_timeKernel,
                                                        data.cellInformation().ltsSetup,
@@ -942,14 +1383,33 @@ template<bool usePlasticity>
         );
 
         if constexpr (usePlasticity) {
-          updateRelaxTime();
-          numberOTetsWithPlasticYielding += seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
-                                                                                             timeStepSize(),
-                                                                                             m_tv,
-                                                                                             m_globalDataOnHost,
-                                                                                             &plasticity[l_cell],
-                                                                                             data.dofs(),
-                                                                                             pstrain[l_cell] );
+          // cells which yielded recently are likely to yield again; do not bother screening them
+          bool check = plasticityActiveSet[l_cell] != 0;
+          if (!check) {
+            numberOfScreenedTets.fetch_add(1, std::memory_order_relaxed);
+            check = !seissol::kernels::Plasticity::isElastic( plasticityScreening,
+                                                              &plasticity[l_cell],
+                                                              data.dofs() );
+          }
+          if (check && usePlasticityBlocks) {
+            // the yield check follows for blocks of cells after the loop
+            numberOfCheckedTets.fetch_add(1, std::memory_order_relaxed);
+#ifdef _OPENMP
+            plasticityCandidates[omp_get_thread_num()].push_back(l_cell);
+#else
+            plasticityCandidates[0].push_back(l_cell);
+#endif
+          } else if (check) {
+            numberOfCheckedTets.fetch_add(1, std::memory_order_relaxed);
+            yielded = seissol::kernels::Plasticity::computePlasticity( m_oneMinusIntegratingFactor,
+                                                                       timeStepSize(),
+                                                                       m_tv,
+                                                                       m_globalDataOnHost,
+                                                                       &plasticity[l_cell],
+                                                                       data.dofs(),
+                                                                       pstrain[l_cell] );
+            plasticityActiveSet[l_cell] = yielded;
+          }
         }
 #ifdef INTEGRATE_QUANTITIES
         seissolInstance.postProcessor().integrateQuantities( m_timeStepWidth,
@@ -957,19 +1417,70 @@ template<bool usePlasticity>
                                                               l_cell,
                                                               dofs[l_cell] );
 #endif // INTEGRATE_QUANTITIES
-      }
+        return yielded;
+      });
 
-      const long long nonZeroFlopsPlasticity =
-          i_layerData.getNumberOfCells() * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
-          numberOTetsWithPlasticYielding * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)];
-      const long long hardwareFlopsPlasticity =
-          i_layerData.getNumberOfCells() * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
-          numberOTetsWithPlasticYielding * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
+      if constexpr (usePlasticity) {
+        if (usePlasticityBlocks) {
+          numberOTetsWithPlasticYielding += computePlasticityBlocks(i_layerData);
+        }
 
-      m_loopStatistics->end(m_regionComputeNeighboringIntegration, i_layerData.getNumberOfCells(), m_profilingId);
+        const long long nonZeroFlopsPlasticity =
+            numberOfScreenedTets * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityScreen)] +
+            numberOfCheckedTets * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityCheck)] +
+            numberOTetsWithPlasticYielding * m_flops_nonZero[static_cast<int>(ComputePart::PlasticityYield)];
+        const long long hardwareFlopsPlasticity =
+            numberOfScreenedTets * m_flops_hardware[static_cast<int>(ComputePart::PlasticityScreen)] +
+            numberOfCheckedTets * m_flops_hardware[static_cast<int>(ComputePart::PlasticityCheck)] +
+            numberOTetsWithPlasticYielding * m_flops_hardware[static_cast<int>(ComputePart::PlasticityYield)];
+        seissolInstance.flopCounter().incrementNonZeroFlopsPlasticity(nonZeroFlopsPlasticity);
+        seissolInstance.flopCounter().incrementHardwareFlopsPlasticity(hardwareFlopsPlasticity);
+      }
+    }
 
-      return {nonZeroFlopsPlasticity, hardwareFlopsPlasticity};
+unsigned TimeCluster::computePlasticityBlocks(seissol::initializer::Layer& layerData) {
+  auto* plasticity = layerData.var(m_lts->plasticity);
+  auto* pstrain = layerData.var(m_lts->pstrain);
+  real** dofs = layerData.var(m_lts->dofs);
+
+  // (sorted, s.t. neighboring cells end up in the same block)
+  std::vector<unsigned> cells;
+  for (auto& threadCells : plasticityCandidates) {
+    cells.insert(cells.end(), threadCells.begin(), threadCells.end());
+    threadCells.clear();
+  }
+  std::sort(cells.begin(), cells.end());
+
+  constexpr auto BlockSize = seissol::kernels::Plasticity::BlockSize;
+  const std::size_t numberOfBlocks = (cells.size() + BlockSize - 1) / BlockSize;
+  return seissol::parallel::runtime::parallelForSum<unsigned>(numberOfBlocks, [&](std::size_t block) {
+    const std::size_t firstCell = block * BlockSize;
+    const std::size_t numberOfCells = std::min(BlockSize, cells.size() - firstCell);
+    const seissol::model::PlasticityData* blockPlasticity[BlockSize];
+    real* blockDofs[BlockSize];
+    real* blockPstrain[BlockSize];
+    unsigned yielded[BlockSize];
+    for (std::size_t i = 0; i < numberOfCells; ++i) {
+      const auto cell = cells[firstCell + i];
+      blockPlasticity[i] = &plasticity[cell];
+      blockDofs[i] = dofs[cell];
+      blockPstrain[i] = pstrain[cell];
+    }
+    const auto numberOfYieldedCells = seissol::kernels::Plasticity::computePlasticityBlock(m_oneMinusIntegratingFactor,
+                                                                                          timeStepSize(),
+                                                                                          m_tv,
+                                                                                          m_globalDataOnHost,
+                                                                                          numberOfCells,
+                                                                                          blockPlasticity,
+                                                                                          blockDofs,
+                                                                                          blockPstrain,
+                                                                                          yielded);
+    for (std::size_t i = 0; i < numberOfCells; ++i) {
+      plasticityActiveSet[cells[firstCell + i]] = yielded[i];
     }
+    return numberOfYieldedCells;
+  });
+}
 
 void TimeCluster::synchronizeTo(seissol::initializer::AllocationPlace place, void* stream) {
 #ifdef ACL_DEVICE
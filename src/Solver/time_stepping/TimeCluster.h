@@ -73,7 +73,9 @@
 
 #ifdef USE_MPI
 #include <mpi.h>
+#include <cstdint>
 #include <list>
+#include <optional>
 #endif
 
 #include "Initializer/Typedefs.h"
@@ -98,6 +100,9 @@
 #include <Common/Executor.h>
 
 #include "AbstractTimeCluster.h"
+#include "CellBlockSchedule.h"
+#include "CopyRegionSchedule.h"
+#include "GhostRegionReadiness.h"
 
 #ifdef ACL_DEVICE
 #include <device.h>
@@ -111,6 +116,11 @@ namespace seissol {
   namespace kernels {
     class ReceiverCluster;
   }
+
+  namespace writer {
+    class OutputSampler;
+    class EnergyOutput;
+  }
 }
 
 /**
@@ -129,6 +139,31 @@ private:
     void correct() override;
     bool usePlasticity;
 
+    //! modal bounds to screen the cells for plastic yielding
+    seissol::kernels::Plasticity::Screening plasticityScreening;
+    //! per cell, true if the cell yielded in its last update; these cells skip the screening
+    std::vector<std::uint8_t> plasticityActiveSet;
+    //! run the yield check for blocks of cells after the neighbor integration
+    bool usePlasticityBlocks;
+    //! per thread, the cells which failed the screening in the current neighbor integration
+    std::vector<std::vector<unsigned>> plasticityCandidates;
+
+    //! fuse the local and neighbor integration if the neighbors allow it
+    bool useFusedSweep;
+    //! cell blocks for the fused sweep, built on first use
+    std::optional<CellBlockSchedule> blockSchedule;
+    //! the neighbor integration of the current time step was done during the prediction already
+    bool neighborIntegrationFused{false};
+
+    //! integrate the copy regions as soon as the ghost regions they depend on have arrived
+    bool useCopyRegions;
+    const MeshStructure* meshStructure{nullptr};
+    std::shared_ptr<GhostRegionReadiness> ghostRegionReadiness;
+    //! regions of the copy layer, built on first use
+    std::optional<CopyRegionSchedule> copyRegionSchedule;
+    //! the neighbor integration of these regions was done for the current time step already
+    std::vector<bool> copyRegionsIntegrated;
+
     //! number of time steps
     unsigned long m_numberOfTimeSteps;
 
@@ -179,6 +214,7 @@ private:
       DRNeighbor,
       DRFrictionLawInterior,
       DRFrictionLawCopy,
+      PlasticityScreen,
       PlasticityCheck,
       PlasticityYield,
       NUM_COMPUTE_PARTS
@@ -200,14 +236,47 @@ private:
     unsigned        m_regionComputeNeighboringIntegration;
     unsigned        m_regionComputeDynamicRupture;
     unsigned        m_regionComputePointSources;
+    unsigned        m_regionComputeFusedIntegration;
 
     kernels::ReceiverCluster* m_receiverCluster;
 
+    //! stages the wave field output without synchronizing the clusters (nullptr, if disabled)
+    writer::OutputSampler* m_outputSampler{nullptr};
+
+    //! index of the next output time to be sampled by this cluster
+    std::size_t m_outputIndex{0};
+
+    //! index of the first output time sampled in the current time step
+    std::size_t m_firstOutputIndex{0};
+
+    //! staged dofs and expansion times of the output times sampled in the current time step
+    std::vector<real*> m_stagedDofs;
+    std::vector<double> m_expansionTimes;
+
+    //! accumulates the volume energies after the last correction before the sync (or nullptr)
+    writer::EnergyOutput* m_energyOutput{nullptr};
+
     /**
      * Writes the receiver output if applicable (receivers present, receivers have to be written).
      **/
     void writeReceivers();
 
+    /**
+     * Stages the output times within the upcoming time step in the output sampler, if applicable.
+     * The DOFs are evaluated by the local integration from the time derivatives of the predictor.
+     **/
+    void stageOutput();
+
+    /**
+     * Evaluates the DOFs of a cell at the staged output times from its time derivatives.
+     **/
+    void sampleOutput(std::size_t cell, const real* timeDerivatives);
+
+    /**
+     * Marks the staged output times as sampled by this cluster.
+     **/
+    void contributeOutput();
+
     /**
      * Computes the source terms if applicable.
      **/
@@ -254,6 +323,24 @@ private:
      **/
     void computeNeighboringIntegration( seissol::initializer::Layer&  layerData, double subTimeStart );
 
+    /**
+     * Computes the local integration, directly followed by the neighbor integration block by block.
+     *
+     * Requires the neighboring clusters to be predicted already (cf. mayFuseIntegration).
+     * The cells adjacent to dynamic rupture faces are left out of the neighbor integration;
+     * the subsequent call to computeNeighboringIntegration handles them.
+     **/
+    void computeFusedIntegration( seissol::initializer::Layer&  layerData, bool resetBuffers, double subTimeStart );
+
+    /**
+     * Returns true, if the correction of this cluster will be legal right after the prediction.
+     **/
+    bool mayFuseIntegration();
+
+    void initializeBlockSchedule( seissol::initializer::Layer&  layerData );
+
+    void initializeCopyRegionSchedule( seissol::initializer::Layer&  layerData );
+
 #ifdef ACL_DEVICE
     void computeLocalIntegrationDevice( seissol::initializer::Layer&  layerData, bool resetBuffers);
     void computeDynamicRuptureDevice( seissol::initializer::Layer&  layerData );
@@ -262,9 +349,21 @@ private:
 
     void computeLocalIntegrationFlops(seissol::initializer::Layer& layerData);
 
-    template<bool usePlasticity>
-    std::pair<long, long> computeNeighboringIntegrationImplementation(seissol::initializer::Layer& layerData,
-                                                                      double subTimeStart);
+    template<typename LoopT>
+    void computeLocalIntegrationImplementation(seissol::initializer::Layer& layerData,
+                                               bool resetBuffers,
+                                               LoopT&& loop);
+
+    template<bool usePlasticity, typename LoopT>
+    void computeNeighboringIntegrationImplementation(seissol::initializer::Layer& layerData,
+                                                     double subTimeStart,
+                                                     LoopT&& loop);
+
+    /**
+     * Runs the yield check for the cells collected in plasticityCandidates, in blocks of cells
+     * (cf. Plasticity::computePlasticityBlock). Returns the number of cells which yielded.
+     **/
+    unsigned computePlasticityBlocks( seissol::initializer::Layer&  layerData );
 
     void computeLocalIntegrationFlops(unsigned numberOfCells,
                                       CellLocalInformation const* cellInformation,
@@ -349,10 +448,40 @@ public:
   void setPointSources(seissol::kernels::PointSourceClusterPair sourceCluster);
   void freePointSources() { m_sourceCluster.host.reset(nullptr); m_sourceCluster.device.reset(nullptr); }
 
+  /**
+   * Sets the communication regions of a copy cluster, and where to find out which of the
+   * corresponding ghost regions have been received already.
+   */
+  void setGhostRegions(const MeshStructure* meshStructure,
+                       std::shared_ptr<GhostRegionReadiness> readiness) {
+    this->meshStructure = meshStructure;
+    ghostRegionReadiness = std::move(readiness);
+  }
+
+  /**
+   * Computes the neighbor integration of the copy regions whose ghost regions have been received
+   * already, while the cluster waits for the remaining ones.
+   *
+   * @return true, if any region was integrated.
+   */
+  bool integrateReadyCopyRegions();
+
   void setReceiverCluster( kernels::ReceiverCluster* receiverCluster) {
     m_receiverCluster = receiverCluster;
   }
 
+  void setOutputSampler(writer::OutputSampler* outputSampler) {
+    m_outputSampler = outputSampler;
+  }
+
+  void setOutputIndex(std::size_t outputIndex) {
+    m_outputIndex = outputIndex;
+  }
+
+  void setEnergyOutput(writer::EnergyOutput* energyOutput) {
+    m_energyOutput = energyOutput;
+  }
+
   void setFaultOutputManager(dr::output::OutputManager* outputManager) {
     faultOutputManager = outputManager;
   }
@@ -374,6 +503,10 @@ public:
 
   void finalize() override;
 
+  [[nodiscard]] bool hasDynamicRuptureFaces() const {
+    return dynamicRuptureScheduler->hasDynamicRuptureFaces();
+  }
+
   [[nodiscard]] unsigned int getClusterId() const;
   [[nodiscard]] unsigned int getGlobalClusterId() const;
   [[nodiscard]] LayerType getLayerType() const;
@@ -45,9 +45,13 @@
 #include "CommunicationManager.h"
 #include "Initializer/PreProcessorMacros.h"
 #include "Initializer/TimeStepping/Common.h"
+#include "Initializer/TimeStepping/LtsWeights/CostModel.h"
 #include "SeisSol.h"
 #include "ResultWriter/ClusteringWriter.h"
 #include "Parallel/Helper.h"
+#include "Numerical/Statistics.h"
+
+#include <array>
 
 #ifdef ACL_DEVICE
 #include <device.h>
@@ -61,6 +65,11 @@ seissol::time_stepping::TimeManager::TimeManager(seissol::SeisSol& seissolInstan
   m_loopStatistics.addRegion("computeNeighboringIntegration");
   m_loopStatistics.addRegion("computeDynamicRupture");
   m_loopStatistics.addRegion("computePointSources");
+  m_loopStatistics.addRegion("computeFusedIntegration");
+  m_loopStatistics.addRegion("advanceInTime", false);
+
+  useTasks = seissol::useTaskScheduler();
+  useCopyRegions = seissol::useCopyRegionIntegration();
 
   m_loopStatistics.enableSampleOutput(seissolInstance.getSeisSolParameters().output.loopStatisticsNetcdfOutput);
 }
@@ -183,7 +192,16 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& timeStepping
     // Create ghost time clusters for MPI
     const auto preferredDataTransferMode = MPI::mpi.getPreferredDataTransferMode();
     const auto persistent = usePersistentMpi();
+    const auto singlePrecision = useSinglePrecisionMpi();
+    if (useMessageAggregation() && messageAggregator == nullptr) {
+      messageAggregator = std::make_shared<MessageAggregator>(singlePrecision);
+    }
     const int globalClusterId = static_cast<int>(m_timeStepping.clusterIds[localClusterId]);
+    std::shared_ptr<GhostRegionReadiness> regionReadiness;
+    if (useCopyRegions) {
+      regionReadiness = std::make_shared<GhostRegionReadiness>(meshStructure->numberOfRegions);
+      copy->setGhostRegions(meshStructure, regionReadiness);
+    }
     for (unsigned int otherGlobalClusterId = 0; otherGlobalClusterId < m_timeStepping.numberOfGlobalClusters; ++otherGlobalClusterId) {
       const bool hasNeighborRegions = std::any_of(meshStructure->neighboringClusters,
                                                   meshStructure->neighboringClusters + meshStructure->numberOfRegions,
@@ -206,7 +224,12 @@ void seissol::time_stepping::TimeManager::addClusters(TimeStepping& timeStepping
                                                          otherGlobalClusterId,
                                                          meshStructure,
                                                          preferredDataTransferMode,
-                                                         persistent);
+                                                         persistent,
+                                                         singlePrecision,
+                                                         messageAggregator);
+        if (regionReadiness != nullptr) {
+          ghostCluster->setRegionReadiness(regionReadiness);
+        }
         ghostClusters.push_back(std::move(ghostCluster));
 
         // Connect with previous copy layer.
@@ -272,8 +295,13 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
 
   m_timeStepping.synchronizationTime = synchronizationTime;
 
+  auto& energyOutput = seissolInstance.energyOutput();
+  const bool accumulateEnergies =
+      energyOutput.beginAccumulation(synchronizationTime, getTimeTolerance());
+
   for (auto& cluster : clusters) {
     cluster->setSyncTime(synchronizationTime);
+    cluster->setEnergyOutput(accumulateEnergies ? &energyOutput : nullptr);
     cluster->reset();
   }
 
@@ -293,6 +321,19 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     assert(cluster->getState() == ActorState::Corrected);
   }
 
+  const auto regionAdvanceInTime = m_loopStatistics.getRegion("advanceInTime");
+  const auto beginTime = LoopStatistics::begin();
+  const auto numberOfActions = useTasks ? advanceInTimeTasked() : advanceInTimeActorLoop();
+  m_loopStatistics.end(regionAdvanceInTime, beginTime, numberOfActions, 0);
+#ifdef ACL_DEVICE
+  device.api->popLastProfilingMark();
+#endif
+}
+
+unsigned seissol::time_stepping::TimeManager::advanceInTimeActorLoop() {
+  unsigned numberOfActions = 0;
+  // with aggregated messages, let the copy clusters predict together, s.t. their sends are packed
+  const bool progressBetweenPredictions = messageAggregator == nullptr;
   bool finished = false; // Is true, once all clusters reached next sync point
   while (!finished) {
     finished = true;
@@ -301,16 +342,29 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
     // Update all high priority clusters
     std::for_each(highPrioClusters.begin(), highPrioClusters.end(), [&](auto& cluster) {
       if (cluster->getNextLegalAction() == ActorAction::Predict) {
-        communicationManager->progression();
+        if (progressBetweenPredictions) {
+          communicationManager->progression();
+        }
         cluster->act();
+        ++numberOfActions;
       }
     });
     std::for_each(highPrioClusters.begin(), highPrioClusters.end(), [&](auto& cluster) {
       if (cluster->getNextLegalAction() != ActorAction::Predict && cluster->getNextLegalAction() != ActorAction::Nothing) {
         communicationManager->progression();
         cluster->act();
+        ++numberOfActions;
       }
     });
+    // While waiting for their ghost clusters, copy clusters may integrate the regions received already
+    if (useCopyRegions) {
+      std::for_each(highPrioClusters.begin(), highPrioClusters.end(), [&](auto& cluster) {
+        if (cluster->getNextLegalAction() == ActorAction::Nothing) {
+          communicationManager->progression();
+          cluster->integrateReadyCopyRegions();
+        }
+      });
+    }
 
     // Update one low priority cluster
     if (auto predictable = std::find_if(
@@ -320,6 +374,7 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
       );
         predictable != lowPrioClusters.end()) {
       (*predictable)->act();
+      ++numberOfActions;
     } else {
     }
     if (auto correctable = std::find_if(
@@ -329,26 +384,200 @@ void seissol::time_stepping::TimeManager::advanceInTime(const double &synchroniz
       );
         correctable != lowPrioClusters.end()) {
       (*correctable)->act();
+      ++numberOfActions;
     } else {
     }
+    if (m_outputSampler != nullptr) {
+      m_outputSampler->flush();
+    }
     finished = std::all_of(clusters.begin(), clusters.end(),
                            [](auto& c) {
       return c->synced();
     });
     finished &= communicationManager->checkIfFinished();
   }
-#ifdef ACL_DEVICE
-  device.api->popLastProfilingMark();
+  return numberOfActions;
+}
+
+unsigned seissol::time_stepping::TimeManager::advanceInTimeTasked() {
+  unsigned numberOfActions = 0;
+  std::vector<TimeCluster*> wave;
+  std::vector<TimeCluster*> waiting;
+  wave.reserve(clusters.size());
+  waiting.reserve(clusters.size());
+
+#ifdef _OPENMP
+#pragma omp parallel
+#pragma omp single
+#endif
+  {
+    bool finished = false; // Is true, once all clusters reached next sync point
+    while (!finished) {
+      communicationManager->progression();
+
+      // Collect all clusters which may act right now. The actor state machine guarantees
+      // that their actions are independent of each other, with one exception:
+      // all clusters share the friction solver and the fault output, hence at most one
+      // cluster may compute dynamic rupture at a time.
+      // High priority (copy) clusters are issued first, s.t. their data is sent early.
+      wave.clear();
+      waiting.clear();
+      bool waveHasDynamicRupture = false;
+      for (auto* priorityClusters : {&highPrioClusters, &lowPrioClusters}) {
+        for (auto* cluster : *priorityClusters) {
+          const auto action = cluster->getNextLegalAction();
+          if (action == ActorAction::Nothing) {
+            if (useCopyRegions && priorityClusters == &highPrioClusters) {
+              waiting.push_back(cluster);
+            }
+            continue;
+          }
+          if (action == ActorAction::Correct && cluster->hasDynamicRuptureFaces()) {
+            if (waveHasDynamicRupture) {
+              continue;
+            }
+            waveHasDynamicRupture = true;
+          }
+          wave.push_back(cluster);
+        }
+      }
+
+      // Each action splits its cell loops into tasks (cf. parallel::runtime::parallelFor);
+      // threads waiting here steal them from all clusters of the current wave.
+      for (auto* cluster : wave) {
+#ifdef _OPENMP
+#pragma omp task default(none) firstprivate(cluster)
 #endif
+        cluster->act();
+      }
+      // copy clusters waiting for their ghost clusters may integrate the regions received already
+      for (auto* cluster : waiting) {
+#ifdef _OPENMP
+#pragma omp task default(none) firstprivate(cluster)
+#endif
+        cluster->integrateReadyCopyRegions();
+      }
+      // write the complete output snapshots while the other threads work on the wave
+      if (m_outputSampler != nullptr) {
+        m_outputSampler->flush();
+      }
+#ifdef _OPENMP
+#pragma omp taskwait
+#endif
+      numberOfActions += wave.size();
+
+      finished = std::all_of(clusters.begin(), clusters.end(),
+                             [](auto& c) {
+        return c->synced();
+      });
+      finished &= communicationManager->checkIfFinished();
+    }
+  }
+  return numberOfActions;
 }
 
 void seissol::time_stepping::TimeManager::printComputationTime(
     const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn) {
   actorStateStatisticsManager.finish();
   m_loopStatistics.printSummary(MPI::mpi.comm());
+
+  // compare the time spent in the kernels with the time needed to advance all clusters;
+  // with the task-based scheduler, the kernel time may exceed the wall time due to overlapping clusters
+  const double kernelTime = getKernelTime();
+  const auto advanceTime = m_loopStatistics.getTotalTime(m_loopStatistics.getRegion("advanceInTime"));
+  const auto advanceSummary = seissol::statistics::parallelSummary(advanceTime);
+  const auto kernelRatioSummary = seissol::statistics::parallelSummary(advanceTime > 0 ? kernelTime / advanceTime : 0);
+  const auto rank = MPI::mpi.rank();
+  logInfo(rank) << "Time spent advancing the clusters (" << (useTasks ? "task-based scheduler" : "actor loop")
+                << "): mean =" << advanceSummary.mean << " min =" << advanceSummary.min
+                << " max =" << advanceSummary.max;
+  logInfo(rank) << "Compute kernel time per time spent advancing the clusters: mean =" << kernelRatioSummary.mean
+                << " min =" << kernelRatioSummary.min << " max =" << kernelRatioSummary.max;
   m_loopStatistics.writeSamples(outputPrefix, isLoopStatisticsNetcdfOutputOn);
 }
 
+namespace {
+constexpr std::array<const char*, 5> KernelRegions = {"computeLocalIntegration",
+                                                      "computeNeighboringIntegration",
+                                                      "computeDynamicRupture",
+                                                      "computePointSources",
+                                                      "computeFusedIntegration"};
+// the fused integration replaces the local and the neighbor integration of a layer
+constexpr std::array<const char*, 2> ElementUpdateRegions = {"computeLocalIntegration",
+                                                             "computeFusedIntegration"};
+} // namespace
+
+double seissol::time_stepping::TimeManager::getKernelTime() const {
+  double kernelTime = 0;
+  for (const auto* region : KernelRegions) {
+    kernelTime += m_loopStatistics.getTotalTime(m_loopStatistics.getRegion(region));
+  }
+  return kernelTime;
+}
+
+double seissol::time_stepping::TimeManager::getElementUpdates() const {
+  double elementUpdates = 0;
+  for (const auto* region : ElementUpdateRegions) {
+    elementUpdates += m_loopStatistics.getTotalIterations(m_loopStatistics.getRegion(region));
+  }
+  return elementUpdates;
+}
+
+double seissol::time_stepping::TimeManager::getKernelTime(unsigned profilingId) const {
+  double kernelTime = 0;
+  for (const auto* region : KernelRegions) {
+    kernelTime += m_loopStatistics.getTotalTime(m_loopStatistics.getRegion(region), profilingId);
+  }
+  return kernelTime;
+}
+
+double seissol::time_stepping::TimeManager::getElementUpdates(unsigned profilingId) const {
+  double elementUpdates = 0;
+  for (const auto* region : ElementUpdateRegions) {
+    elementUpdates +=
+        m_loopStatistics.getTotalIterations(m_loopStatistics.getRegion(region), profilingId);
+  }
+  return elementUpdates;
+}
+
+void seissol::time_stepping::TimeManager::writeCostModel(const std::string& fileName) {
+  // the tasks of all clusters run concurrently, i.e. the loop statistics add up overlapping
+  // kernel times, which do not correspond to the cost of an update anymore
+  if (useTasks) {
+    logWarning(MPI::mpi.rank()) << "The cost model is not written, since the kernel times measured"
+                                << "with the task-based scheduler (SEISSOL_TASK_SCHEDULER) overlap.";
+    return;
+  }
+
+  const auto region = [&](const char* name) { return m_loopStatistics.getRegion(name); };
+  const auto dynamicRupture = region("computeDynamicRupture");
+  double measurements[4] = {
+      m_loopStatistics.getTotalTime(region("computeLocalIntegration")) +
+          m_loopStatistics.getTotalTime(region("computeNeighboringIntegration")) +
+          m_loopStatistics.getTotalTime(region("computeFusedIntegration")),
+      getElementUpdates(),
+      m_loopStatistics.getTotalTime(dynamicRupture),
+      m_loopStatistics.getTotalIterations(dynamicRupture)};
+#ifdef USE_MPI
+  MPI_Allreduce(MPI_IN_PLACE, measurements, 4, MPI_DOUBLE, MPI_SUM, MPI::mpi.comm());
+#endif
+
+  const auto rank = MPI::mpi.rank();
+  if (measurements[1] == 0) {
+    logWarning(rank) << "No element updates were measured; the cost model is not written.";
+    return;
+  }
+  const auto costModel = seissol::initializer::time_stepping::deriveCostModel(
+      measurements[0], measurements[1], measurements[2], measurements[3],
+      seissolInstance.getSeisSolParameters().timeStepping.vertexWeight);
+  logInfo(rank) << "Measured costs per update: element =" << costModel.element
+                << "s, dynamic rupture face =" << costModel.dynamicRupture << "s";
+  if (rank == 0) {
+    seissol::initializer::time_stepping::writeCostModel(fileName, costModel);
+  }
+  logInfo(rank) << "Wrote the cost model for the LTS weights to" << fileName;
+}
+
 double seissol::time_stepping::TimeManager::getTimeTolerance() {
   return 1E-5 * m_timeStepping.globalCflTimeStepWidths[0];
 }
@@ -371,6 +600,14 @@ void seissol::time_stepping::TimeManager::setReceiverClusters(writer::ReceiverWr
   }
 }
 
+void seissol::time_stepping::TimeManager::setOutputSampler(writer::OutputSampler* outputSampler) {
+  m_outputSampler = outputSampler;
+  m_outputSampler->setNumContributors(clusters.size());
+  for (auto& cluster : clusters) {
+    cluster->setOutputSampler(outputSampler);
+  }
+}
+
 void seissol::time_stepping::TimeManager::setInitialTimes( double time ) {
   assert( time >= 0 );
 
@@ -379,6 +616,9 @@ void seissol::time_stepping::TimeManager::setInitialTimes( double time ) {
     cluster->setCorrectionTime(time);
     cluster->setReceiverTime(time);
     cluster->setLastSubTime(time);
+    if (m_outputSampler != nullptr) {
+      cluster->setOutputIndex(m_outputSampler->firstIndexAfter(time, getTimeTolerance()));
+    }
   }
   for (auto& cluster : *communicationManager->getGhostClusters()) {
     cluster->setPredictionTime(time);
@@ -398,6 +638,7 @@ void seissol::time_stepping::TimeManager::freeDynamicResources() {
     cluster->finalize();
   }
   communicationManager.reset(nullptr);
+  messageAggregator.reset();
 }
 
 void seissol::time_stepping::TimeManager::synchronizeTo(seissol::initializer::AllocationPlace place) {
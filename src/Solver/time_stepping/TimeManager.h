@@ -55,6 +55,7 @@
 #include "Kernels/PointSourceCluster.h"
 #include "Solver/FreeSurfaceIntegrator.h"
 #include "ResultWriter/ReceiverWriter.h"
+#include "ResultWriter/OutputSampler.h"
 #include "TimeCluster.h"
 #include "Monitoring/Stopwatch.h"
 #include "Solver/time_stepping/GhostTimeClusterFactory.h"
@@ -112,6 +113,9 @@ class seissol::time_stepping::TimeManager {
     //! one dynamic rupture scheduler per pair of interior/copy cluster
     std::vector<std::unique_ptr<DynamicRuptureScheduler>> dynamicRuptureSchedulers;
 
+    //! packs the messages of all ghost clusters to the same rank, if enabled
+    std::shared_ptr<MessageAggregator> messageAggregator;
+
     //! all MPI (ghost) LTS clusters, which are under control of this time manager
     std::unique_ptr<AbstractCommunicationManager> communicationManager;
 
@@ -122,6 +126,27 @@ class seissol::time_stepping::TimeManager {
     //! dynamic rupture output
     dr::output::OutputManager* m_faultOutputManager{};
 
+    //! advance the clusters with the task-based scheduler instead of the actor loop
+    bool useTasks{false};
+
+    //! let waiting copy clusters integrate the regions received already
+    bool useCopyRegions{false};
+
+    //! collects the wave field output sampled by the clusters (nullptr, if not used)
+    writer::OutputSampler* m_outputSampler{nullptr};
+
+    /**
+     * Advances the clusters by polling them one after another on the calling thread.
+     * Returns the number of performed actions.
+     **/
+    unsigned advanceInTimeActorLoop();
+
+    /**
+     * Advances the clusters in waves of independent actions, executed as OpenMP tasks.
+     * Returns the number of performed actions.
+     **/
+    unsigned advanceInTimeTasked();
+
   public:
     /**
      * Construct a new time manager.
@@ -172,6 +197,12 @@ class seissol::time_stepping::TimeManager {
    */
     void setReceiverClusters(writer::ReceiverWriter& receiverWriter); 
 
+    /**
+     * Lets the clusters sample the wave field output, s.t. it does not need synchronization points.
+     * Complete snapshots are written while the clusters advance in time.
+     */
+    void setOutputSampler(writer::OutputSampler* outputSampler);
+
     /**
      * Set Tv constant for plasticity.
      */
@@ -187,6 +218,24 @@ class seissol::time_stepping::TimeManager {
 
     void printComputationTime(const std::string& outputPrefix, bool isLoopStatisticsNetcdfOutputOn);
 
+    /**
+     * Derives the cost of an element and of a dynamic rupture face update from the kernel
+     * times of all ranks, and writes them to a cost model for the LTS weights of later runs.
+     **/
+    void writeCostModel(const std::string& fileName);
+
+    //! time spent in the compute kernels on this rank so far
+    double getKernelTime() const;
+
+    //! number of element updates on this rank so far
+    double getElementUpdates() const;
+
+    //! time spent in the compute kernels of one cluster layer (given by its profiling id) so far
+    double getKernelTime(unsigned profilingId) const;
+
+    //! number of element updates of one cluster layer (given by its profiling id) so far
+    double getElementUpdates(unsigned profilingId) const;
+
     void freeDynamicResources();
 
     void synchronizeTo(seissol::initializer::AllocationPlace place);
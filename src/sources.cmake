@@ -18,10 +18,16 @@ src/Initializer/GlobalData.cpp
 src/Solver/time_stepping/AbstractGhostTimeCluster.cpp
 src/Solver/time_stepping/AbstractTimeCluster.cpp
 src/Solver/time_stepping/ActorState.cpp
+src/Solver/time_stepping/AggregatedGhostTimeCluster.cpp
+src/Solver/time_stepping/CellBlockSchedule.cpp
 src/Solver/time_stepping/CommunicationManager.cpp
+src/Solver/time_stepping/CopyRegionSchedule.cpp
 src/Solver/time_stepping/DirectGhostTimeCluster.cpp
+src/Solver/time_stepping/GhostRegionReadiness.cpp
 src/Solver/time_stepping/GhostTimeClusterWithCopy.cpp
+src/Solver/time_stepping/MessageAggregator.cpp
 src/Solver/time_stepping/MiniSeisSol.cpp
+src/Solver/time_stepping/SinglePrecisionRegions.cpp
 src/Solver/time_stepping/TimeCluster.cpp
 src/Solver/time_stepping/TimeManager.cpp
 
@@ -59,6 +65,7 @@ src/Kernels/Receiver.cpp
 src/Model/Common.cpp
 src/Numerical/Functions.cpp
 src/Numerical/Statistics.cpp
+src/Parallel/NumaPlacement.cpp
 src/Parallel/Pin.cpp
 src/Physics/InstantaneousTimeMirrorManager.cpp
 src/ResultWriter/ClusteringWriter.cpp
@@ -68,6 +75,7 @@ src/SourceTerm/FSRMReader.cpp
 src/SourceTerm/PointSource.cpp
 src/SourceTerm/Manager.cpp
 
+src/Solver/Rebalancer.cpp
 src/Solver/Simulator.cpp
 src/ResultWriter/AnalysisWriter.cpp
 )
@@ -89,6 +97,8 @@ src/ResultWriter/FreeSurfaceWriterExecutor.cpp
 src/ResultWriter/MiniSeisSolWriter.cpp
 src/ResultWriter/PostProcessor.cpp
 src/ResultWriter/ReceiverWriter.cpp
+src/ResultWriter/ReceiverBinaryFormat.cpp
+src/ResultWriter/OutputSampler.cpp
 src/ResultWriter/ThreadsPinningWriter.cpp
 src/ResultWriter/WaveFieldWriter.cpp
 src/ResultWriter/FaultWriter.cpp
@@ -104,7 +114,11 @@ src/Equations/poroelastic/Model/Datastructures.cpp
 
 src/Geometry/MeshReader.cpp
 src/Geometry/MeshTools.cpp
+src/Geometry/SpaceFillingCurve.cpp
+src/Geometry/TetrahedronBvh.cpp
 
+src/Initializer/EasiQueryCache.cpp
+src/Initializer/HugePageArena.cpp
 src/Initializer/InitProcedure/Init.cpp
 src/Initializer/InitProcedure/InitIO.cpp
 src/Initializer/InitProcedure/InitMesh.cpp
@@ -129,6 +143,8 @@ src/Initializer/Parameters/SeisSolParameters.cpp
 src/Initializer/Parameters/SourceParameters.cpp
 
 src/Initializer/TimeStepping/GlobalTimestep.cpp
+src/Initializer/TimeStepping/LtsWeights/CostFactors.cpp
+src/Initializer/TimeStepping/LtsWeights/CostModel.cpp
 src/Initializer/TimeStepping/LtsLayout.cpp
 
 src/Initializer/Tree/Lut.cpp
@@ -145,6 +161,7 @@ src/Solver/FreeSurfaceIntegrator.cpp
 
 src/Reader/AsagiModule.cpp
 src/Reader/AsagiReader.cpp
+src/Reader/PointList.cpp
 
 src/Parallel/Runtime/StreamOMP.cpp
 )
@@ -167,6 +184,7 @@ if (HDF5 AND MPI)
   target_sources(SeisSol-lib PRIVATE
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/PartitioningLib.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/PUMLReader.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/Geometry/PreparedMeshReader.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/TimeStepping/LtsWeights/LtsWeights.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/Initializer/TimeStepping/LtsWeights/WeightsModels.cpp
     )
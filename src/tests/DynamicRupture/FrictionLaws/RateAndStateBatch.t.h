@@ -0,0 +1,181 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include "DynamicRupture/FrictionLaws/AgingLaw.h"
+#include "DynamicRupture/FrictionLaws/ThermalPressurization/NoTP.h"
+#include "DynamicRupture/Misc.h"
+#include "doctest.h"
+
+namespace seissol::unit_test {
+
+using namespace seissol;
+using namespace seissol::dr;
+
+/**
+ * Fault data of a rate-and-state law, stored face-major as in the LTS tree
+ */
+struct RateAndStateFaultData {
+  explicit RateAndStateFaultData(std::size_t numberOfFaces)
+      : impAndEta(numberOfFaces), initialStress(numberOfFaces * misc::NumPaddedPoints * 6),
+        a(numberOfFaces * misc::NumPaddedPoints), sl0(a.size()), mu(a.size()),
+        slipRateMagnitude(a.size()), slipRate1(a.size()), slipRate2(a.size()),
+        traction1(a.size()), traction2(a.size()), slip1(a.size()), slip2(a.size()),
+        accumulatedSlipMagnitude(a.size()), initialPressure(a.size()) {}
+
+  std::vector<ImpedancesAndEta> impAndEta;
+  std::vector<real> initialStress;
+  std::vector<real> a;
+  std::vector<real> sl0;
+  std::vector<real> mu;
+  std::vector<real> slipRateMagnitude;
+  std::vector<real> slipRate1;
+  std::vector<real> slipRate2;
+  std::vector<real> traction1;
+  std::vector<real> traction2;
+  std::vector<real> slip1;
+  std::vector<real> slip2;
+  std::vector<real> accumulatedSlipMagnitude;
+  std::vector<real> initialPressure;
+};
+
+class TestAgingLaw : public friction_law::AgingLaw<friction_law::NoTP> {
+  public:
+  using AgingLaw::AgingLaw;
+
+  void setUp(RateAndStateFaultData& data, real timeStepSize) {
+    using PointsT = real(*)[misc::NumPaddedPoints];
+    this->impAndEta = data.impAndEta.data();
+    this->initialStressInFaultCS =
+        reinterpret_cast<real(*)[misc::NumPaddedPoints][6]>(data.initialStress.data());
+    this->a = reinterpret_cast<PointsT>(data.a.data());
+    this->sl0 = reinterpret_cast<PointsT>(data.sl0.data());
+    this->mu = reinterpret_cast<PointsT>(data.mu.data());
+    this->slipRateMagnitude = reinterpret_cast<PointsT>(data.slipRateMagnitude.data());
+    this->slipRate1 = reinterpret_cast<PointsT>(data.slipRate1.data());
+    this->slipRate2 = reinterpret_cast<PointsT>(data.slipRate2.data());
+    this->traction1 = reinterpret_cast<PointsT>(data.traction1.data());
+    this->traction2 = reinterpret_cast<PointsT>(data.traction2.data());
+    this->slip1 = reinterpret_cast<PointsT>(data.slip1.data());
+    this->slip2 = reinterpret_cast<PointsT>(data.slip2.data());
+    this->accumulatedSlipMagnitude =
+        reinterpret_cast<PointsT>(data.accumulatedSlipMagnitude.data());
+    this->initialPressure = reinterpret_cast<PointsT>(data.initialPressure.data());
+    for (auto& deltaT : this->deltaT) {
+      deltaT = timeStepSize;
+    }
+  }
+};
+
+TEST_CASE("Batched rate-and-state solver") {
+  // one full and one partial batch
+  constexpr std::size_t NumberOfFaces = friction_law::FaceBatchSize + 5;
+
+  initializer::parameters::DRParameters drParameters;
+  drParameters.rsF0 = 0.6;
+  drParameters.rsB = 0.012;
+  drParameters.rsSr0 = 1e-6;
+
+  RateAndStateFaultData initialData(NumberOfFaces);
+  std::vector<FaultStresses> faultStresses(NumberOfFaces);
+  std::vector<std::array<real, misc::NumPaddedPoints>> stateVariable(NumberOfFaces);
+  for (std::size_t face = 0; face < NumberOfFaces; ++face) {
+    const real zs = 9.0e6 + 1.0e5 * face;
+    auto& impAndEta = initialData.impAndEta[face];
+    impAndEta.zs = zs;
+    impAndEta.zsNeig = zs;
+    impAndEta.etaS = 0.5 * zs;
+    impAndEta.invEtaS = 1.0 / impAndEta.etaS;
+    for (std::size_t point = 0; point < misc::NumPaddedPoints; ++point) {
+      const auto value = face * misc::NumPaddedPoints + point;
+      const real variation = std::sin(static_cast<real>(value));
+      initialData.a[value] = 0.01 + 0.002 * variation;
+      initialData.sl0[value] = 0.02;
+      // initial slip rates from creep to seismic slip, s.t. the faces need a different number of
+      // Newton iterations
+      initialData.slipRate1[value] =
+          std::pow(static_cast<real>(10.0), static_cast<int>(value % 10) - 9);
+      initialData.slipRate2[value] = 0.1 * initialData.slipRate1[value];
+      initialData.initialStress[6 * value + 0] = -120e6;
+      initialData.initialStress[6 * value + 3] = 70e6 + 2e6 * variation;
+      initialData.initialStress[6 * value + 5] = 1e6;
+      for (std::size_t timeIndex = 0; timeIndex < ConvergenceOrder; ++timeIndex) {
+        faultStresses[face].normalStress[timeIndex][point] = 1e5 * variation;
+        faultStresses[face].traction1[timeIndex][point] = 1e5 * timeIndex;
+        faultStresses[face].traction2[timeIndex][point] = -1e5 * variation;
+      }
+      stateVariable[face][point] = 1e4 * (1.5 + variation);
+    }
+  }
+
+  auto perFaceData = initialData;
+  auto perFaceStateVariable = stateVariable;
+  std::vector<TractionResults> perFaceResults(NumberOfFaces);
+  TestAgingLaw perFaceLaw(&drParameters);
+  perFaceLaw.setUp(perFaceData, 1e-3);
+
+  auto batchedData = initialData;
+  auto batchedStateVariable = stateVariable;
+  std::vector<TractionResults> batchedResults(NumberOfFaces);
+  TestAgingLaw batchedLaw(&drParameters);
+  batchedLaw.setUp(batchedData, 1e-3);
+
+  for (std::size_t timeIndex = 0; timeIndex < ConvergenceOrder; ++timeIndex) {
+    for (std::size_t face = 0; face < NumberOfFaces; ++face) {
+      std::array<real, misc::NumPaddedPoints> strengthBuffer{};
+      perFaceLaw.updateFrictionAndSlip(faultStresses[face],
+                                       perFaceResults[face],
+                                       perFaceStateVariable[face],
+                                       strengthBuffer,
+                                       face,
+                                       timeIndex);
+    }
+
+    for (std::size_t firstFace = 0; firstFace < NumberOfFaces;
+         firstFace += friction_law::FaceBatchSize) {
+      friction_law::FaceBatch batch;
+      batch.firstFace = firstFace;
+      batch.size = std::min(friction_law::FaceBatchSize, NumberOfFaces - firstFace);
+      for (std::size_t i = 0; i < batch.size; ++i) {
+        batch.faultStresses[i] = faultStresses[firstFace + i];
+        batch.tractionResults[i] = batchedResults[firstFace + i];
+        batch.stateVariableBuffer[i] = batchedStateVariable[firstFace + i];
+      }
+      batchedLaw.updateFrictionAndSlipBatch(batch, timeIndex);
+      for (std::size_t i = 0; i < batch.size; ++i) {
+        batchedResults[firstFace + i] = batch.tractionResults[i];
+        batchedStateVariable[firstFace + i] = batch.stateVariableBuffer[i];
+      }
+    }
+  }
+
+  // the batched solver evaluates the same expressions and takes the same Newton steps per face;
+  // only the loop order differs. Hence, the results are bitwise identical
+  auto checkEqual = [&](const std::vector<real>& expected, const std::vector<real>& actual) {
+    REQUIRE(expected.size() == actual.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      REQUIRE(actual[i] == expected[i]);
+    }
+  };
+  checkEqual(perFaceData.mu, batchedData.mu);
+  checkEqual(perFaceData.slipRateMagnitude, batchedData.slipRateMagnitude);
+  checkEqual(perFaceData.slipRate1, batchedData.slipRate1);
+  checkEqual(perFaceData.slipRate2, batchedData.slipRate2);
+  checkEqual(perFaceData.traction1, batchedData.traction1);
+  checkEqual(perFaceData.traction2, batchedData.traction2);
+  checkEqual(perFaceData.accumulatedSlipMagnitude, batchedData.accumulatedSlipMagnitude);
+  for (std::size_t face = 0; face < NumberOfFaces; ++face) {
+    for (std::size_t point = 0; point < misc::NumPaddedPoints; ++point) {
+      REQUIRE(batchedStateVariable[face][point] == perFaceStateVariable[face][point]);
+      for (std::size_t timeIndex = 0; timeIndex < ConvergenceOrder; ++timeIndex) {
+        REQUIRE(batchedResults[face].traction1[timeIndex][point] ==
+                perFaceResults[face].traction1[timeIndex][point]);
+        REQUIRE(batchedResults[face].traction2[timeIndex][point] ==
+                perFaceResults[face].traction2[timeIndex][point]);
+      }
+    }
+  }
+}
+
+} // namespace seissol::unit_test
@@ -1,5 +1,6 @@
 #include "doctest.h"
 
 #include "FrictionLaws/FrictionSolverCommon.t.h"
+#include "FrictionLaws/RateAndStateBatch.t.h"
 #include "Output/Geometry.t.h"
 #include "Output/Variables.t.h"
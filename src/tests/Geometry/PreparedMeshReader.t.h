@@ -0,0 +1,107 @@
+#include <cstdio>
+#include <string>
+
+#include "Geometry/MeshReader.h"
+#include "Geometry/PreparedMeshReader.h"
+#include "Parallel/MPI.h"
+
+namespace seissol::unit_test {
+
+// the prepared mesh is written with parallel HDF5
+#if defined(USE_HDF) && defined(USE_MPI)
+
+namespace {
+class TwoTetrahedraReader : public seissol::geometry::MeshReader {
+  public:
+  TwoTetrahedraReader() : seissol::geometry::MeshReader(seissol::MPI::mpi.rank()) {
+    const double coords[5][3] = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}};
+    m_vertices.resize(5);
+    for (int i = 0; i < 5; ++i) {
+      std::copy_n(coords[i], 3, m_vertices[i].coords);
+    }
+    m_vertices[0].elements = {0};
+    m_vertices[1].elements = {0, 1};
+    m_vertices[2].elements = {0, 1};
+    m_vertices[3].elements = {0, 1};
+    m_vertices[4].elements = {1};
+
+    m_elements.resize(2);
+    for (int i = 0; i < 2; ++i) {
+      auto& element = m_elements[i];
+      element.globalId = 10 + i;
+      element.localId = i;
+      for (int side = 0; side < 4; ++side) {
+        element.vertices[side] = i + side;
+        element.neighbors[side] = (side == 3) ? 1 - i : 2;
+        element.neighborSides[side] = side;
+        element.sideOrientations[side] = side % 3;
+        element.boundaries[side] = (side == 0) ? 1 : 0;
+        element.neighborRanks[side] = seissol::MPI::mpi.rank();
+        element.mpiIndices[side] = i * side;
+        element.faultTags[side] = 65 + side;
+      }
+      element.group = 3 + i;
+    }
+
+    auto& neighbor = m_MPINeighbors[seissol::MPI::mpi.rank() + 1];
+    neighbor.localID = 0;
+    neighbor.elements = {{1, 2, 7, 3}, {0, 1, 8, 0}};
+  }
+};
+} // namespace
+
+TEST_CASE("Prepared mesh") {
+  const std::string file = "preparedMeshTest.h5";
+  const TwoTetrahedraReader mesh;
+
+  REQUIRE_FALSE(seissol::geometry::PreparedMeshReader::matches(file, 42));
+  seissol::geometry::PreparedMeshReader::write(mesh, file, 42);
+  REQUIRE(seissol::geometry::PreparedMeshReader::matches(file, 42));
+  REQUIRE_FALSE(seissol::geometry::PreparedMeshReader::matches(file, 43));
+
+  const seissol::geometry::PreparedMeshReader prepared(file);
+
+  REQUIRE(prepared.getElements().size() == mesh.getElements().size());
+  for (std::size_t i = 0; i < mesh.getElements().size(); ++i) {
+    const auto& expected = mesh.getElements()[i];
+    const auto& element = prepared.getElements()[i];
+    REQUIRE(element.globalId == expected.globalId);
+    REQUIRE(element.localId == expected.localId);
+    REQUIRE(element.group == expected.group);
+    for (int side = 0; side < 4; ++side) {
+      REQUIRE(element.vertices[side] == expected.vertices[side]);
+      REQUIRE(element.neighbors[side] == expected.neighbors[side]);
+      REQUIRE(element.neighborSides[side] == expected.neighborSides[side]);
+      REQUIRE(element.sideOrientations[side] == expected.sideOrientations[side]);
+      REQUIRE(element.boundaries[side] == expected.boundaries[side]);
+      REQUIRE(element.neighborRanks[side] == expected.neighborRanks[side]);
+      REQUIRE(element.mpiIndices[side] == expected.mpiIndices[side]);
+      REQUIRE(element.faultTags[side] == expected.faultTags[side]);
+    }
+  }
+
+  REQUIRE(prepared.getVertices().size() == mesh.getVertices().size());
+  for (std::size_t i = 0; i < mesh.getVertices().size(); ++i) {
+    for (int dim = 0; dim < 3; ++dim) {
+      REQUIRE(prepared.getVertices()[i].coords[dim] == mesh.getVertices()[i].coords[dim]);
+    }
+    REQUIRE(prepared.getVertices()[i].elements == mesh.getVertices()[i].elements);
+  }
+
+  REQUIRE(prepared.getMPINeighbors().size() == 1);
+  const auto& [rank, neighbor] = *prepared.getMPINeighbors().begin();
+  REQUIRE(rank == seissol::MPI::mpi.rank() + 1);
+  REQUIRE(neighbor.elements.size() == 2);
+  REQUIRE(neighbor.elements[0].localElement == 1);
+  REQUIRE(neighbor.elements[0].localSide == 2);
+  REQUIRE(neighbor.elements[0].neighborElement == 7);
+  REQUIRE(neighbor.elements[0].neighborSide == 3);
+  REQUIRE(neighbor.elements[1].localElement == 0);
+  REQUIRE(neighbor.elements[1].neighborElement == 8);
+
+  std::remove(file.c_str());
+}
+
+#endif
+
+} // namespace seissol::unit_test
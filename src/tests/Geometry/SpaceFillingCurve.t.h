@@ -0,0 +1,59 @@
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdlib>
+#include <utility>
+#include <vector>
+
+#include "Geometry/SpaceFillingCurve.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Space-filling curves") {
+  SUBCASE("Morton keys interleave the coordinate bits") {
+    REQUIRE(geometry::mortonKey({0, 0, 1}) == 1);
+    REQUIRE(geometry::mortonKey({0, 1, 0}) == 2);
+    REQUIRE(geometry::mortonKey({1, 0, 0}) == 4);
+    REQUIRE(geometry::mortonKey({3, 3, 3}) == 63);
+  }
+
+  SUBCASE("Hilbert curve visits neighboring grid points") {
+    // the first 8^2 points of the curve fill the cube [0, 4)^3
+    std::vector<std::pair<std::uint64_t, std::array<std::uint32_t, 3>>> keys;
+    for (std::uint32_t x = 0; x < 4; ++x) {
+      for (std::uint32_t y = 0; y < 4; ++y) {
+        for (std::uint32_t z = 0; z < 4; ++z) {
+          keys.emplace_back(geometry::hilbertKey({x, y, z}), std::array<std::uint32_t, 3>{x, y, z});
+        }
+      }
+    }
+    std::sort(keys.begin(), keys.end());
+    for (std::size_t i = 0; i < keys.size(); ++i) {
+      REQUIRE(keys[i].first == i);
+      if (i > 0) {
+        int distance = 0;
+        for (unsigned d = 0; d < 3; ++d) {
+          distance += std::abs(static_cast<int>(keys[i].second[d]) -
+                               static_cast<int>(keys[i - 1].second[d]));
+        }
+        REQUIRE(distance == 1);
+      }
+    }
+  }
+
+  SUBCASE("Points are ordered along the curve") {
+    const std::vector<std::array<double, 3>> points{
+        {1.0, 1.0, 1.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.1}, {1.0, 1.0, 0.9}};
+    for (const auto curve : {geometry::SpaceFillingCurve::Morton, geometry::SpaceFillingCurve::Hilbert}) {
+      const auto order = geometry::spaceFillingCurveOrder(points, curve);
+      REQUIRE(order.size() == points.size());
+      REQUIRE(order[0] == 1);
+      REQUIRE(order[1] == 2);
+      // the two points close to (1, 1, 1) follow each other
+      REQUIRE(std::min(order[2], order[3]) == 0);
+      REQUIRE(std::max(order[2], order[3]) == 3);
+    }
+  }
+}
+
+} // namespace seissol::unit_test
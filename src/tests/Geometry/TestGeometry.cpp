@@ -1,5 +1,8 @@
 #include "doctest.h"
 
 #include "MeshRefiner.t.h"
+#include "PreparedMeshReader.t.h"
+#include "SpaceFillingCurve.t.h"
+#include "TetrahedronBvh.t.h"
 #include "TriangleRefiner.t.h"
 #include "VariableSubsampler.t.h"
@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "Geometry/MeshDefinition.h"
+#include "Geometry/TetrahedronBvh.h"
+
+#include "doctest.h"
+
+#include <Eigen/Dense>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Bounding volume hierarchy over tetrahedra") {
+  // a distorted grid of n^3 cubes, each one split into six tetrahedra
+  constexpr int N = 6;
+  const auto vertexId = [](int i, int j, int k) { return i + (N + 1) * (j + (N + 1) * k); };
+  std::vector<Vertex> vertices;
+  for (int k = 0; k <= N; ++k) {
+    for (int j = 0; j <= N; ++j) {
+      for (int i = 0; i <= N; ++i) {
+        Vertex vertex;
+        vertex.coords[0] = i + 0.1 * ((7 * i + 3 * j) % 5);
+        vertex.coords[1] = j;
+        vertex.coords[2] = 0.5 * k;
+        vertices.push_back(vertex);
+      }
+    }
+  }
+  const int permutations[6][3] = {{0, 1, 2}, {0, 2, 1}, {1, 0, 2}, {1, 2, 0}, {2, 0, 1}, {2, 1, 0}};
+  // odd permutations yield negatively oriented tetrahedra
+  const bool odd[6] = {false, true, true, false, false, true};
+  std::vector<Element> elements;
+  for (int k = 0; k < N; ++k) {
+    for (int j = 0; j < N; ++j) {
+      for (int i = 0; i < N; ++i) {
+        for (int p = 0; p < 6; ++p) {
+          int corner[3] = {i, j, k};
+          Element element{};
+          element.vertices[0] = vertexId(corner[0], corner[1], corner[2]);
+          for (int step = 0; step < 3; ++step) {
+            ++corner[permutations[p][step]];
+            element.vertices[step + 1] = vertexId(corner[0], corner[1], corner[2]);
+          }
+          if (odd[p]) {
+            std::swap(element.vertices[2], element.vertices[3]);
+          }
+          elements.push_back(element);
+        }
+      }
+    }
+  }
+  // the local ids run opposite to the element order
+  for (std::size_t elem = 0; elem < elements.size(); ++elem) {
+    elements[elem].localId = static_cast<int>(elements.size() - elem - 1);
+  }
+
+  const geometry::TetrahedronBvh bvh(vertices, elements);
+  CHECK(bvh.numberOfNodes() > 1);
+
+  const auto bruteForce = [&](const Eigen::Vector3d& point) {
+    auto found = geometry::TetrahedronBvh::NotFound;
+    for (std::size_t elem = 0; elem < elements.size(); ++elem) {
+      if (bvh.contains(elem, point) &&
+          (found == geometry::TetrahedronBvh::NotFound ||
+           elements[elem].localId < elements[found].localId)) {
+        found = elem;
+      }
+    }
+    return found;
+  };
+
+  SUBCASE("random points") {
+    std::mt19937 generator(321);
+    std::uniform_real_distribution<double> distribution(-1.0, N + 1.0);
+    unsigned numFound = 0;
+    for (int trial = 0; trial < 2000; ++trial) {
+      const Eigen::Vector3d point(
+          distribution(generator), distribution(generator), 0.5 * distribution(generator));
+      const auto expected = bruteForce(point);
+      REQUIRE(bvh.locate(point) == expected);
+      numFound += expected != geometry::TetrahedronBvh::NotFound ? 1 : 0;
+    }
+    CHECK(numFound > 0);
+  }
+
+  SUBCASE("points on vertices and faces") {
+    for (const auto& vertex : vertices) {
+      const Eigen::Vector3d point(vertex.coords[0], vertex.coords[1], vertex.coords[2]);
+      const auto found = bvh.locate(point);
+      REQUIRE(found != geometry::TetrahedronBvh::NotFound);
+      REQUIRE(found == bruteForce(point));
+    }
+  }
+
+  SUBCASE("centroids") {
+    for (std::size_t elem = 0; elem < elements.size(); ++elem) {
+      Eigen::Vector3d centroid = Eigen::Vector3d::Zero();
+      for (const auto vertex : elements[elem].vertices) {
+        centroid += 0.25 * Eigen::Vector3d(vertices[vertex].coords[0],
+                                           vertices[vertex].coords[1],
+                                           vertices[vertex].coords[2]);
+      }
+      REQUIRE(bvh.locate(centroid) == elem);
+    }
+  }
+
+  SUBCASE("empty mesh") {
+    const std::vector<Element> noElements;
+    const geometry::TetrahedronBvh emptyBvh(vertices, noElements);
+    CHECK(emptyBvh.locate(Eigen::Vector3d::Zero()) == geometry::TetrahedronBvh::NotFound);
+  }
+}
+
+} // namespace seissol::unit_test
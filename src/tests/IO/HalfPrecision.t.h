@@ -0,0 +1,93 @@
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+#include "IO/Datatype/Datatype.h"
+#include "doctest.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Half precision conversion") {
+  using namespace seissol::io::datatype;
+
+  SUBCASE("Normal numbers") {
+    REQUIRE(floatToHalf(0.0F) == 0x0000U);
+    REQUIRE(floatToHalf(-0.0F) == 0x8000U);
+    REQUIRE(floatToHalf(1.0F) == 0x3c00U);
+    REQUIRE(floatToHalf(-2.0F) == 0xc000U);
+    REQUIRE(floatToHalf(0.333251953125F) == 0x3555U);
+    REQUIRE(floatToHalf(65504.0F) == 0x7bffU);
+    REQUIRE(floatToHalf(std::ldexp(1.0F, -14)) == 0x0400U);
+
+    REQUIRE(halfToFloat(0x3c00U) == 1.0F);
+    REQUIRE(halfToFloat(0xc000U) == -2.0F);
+    REQUIRE(halfToFloat(0x7bffU) == 65504.0F);
+    REQUIRE(halfToFloat(0x0400U) == std::ldexp(1.0F, -14));
+  }
+
+  SUBCASE("Subnormal numbers") {
+    REQUIRE(floatToHalf(std::ldexp(1.0F, -24)) == 0x0001U);
+    REQUIRE(floatToHalf(-std::ldexp(1.0F, -24)) == 0x8001U);
+    REQUIRE(floatToHalf(std::ldexp(1023.0F, -24)) == 0x03ffU);
+    REQUIRE(halfToFloat(0x0001U) == std::ldexp(1.0F, -24));
+    REQUIRE(halfToFloat(0x8001U) == -std::ldexp(1.0F, -24));
+    REQUIRE(halfToFloat(0x03ffU) == std::ldexp(1023.0F, -24));
+
+    // below the smallest subnormal
+    REQUIRE(floatToHalf(std::ldexp(1.0F, -26)) == 0x0000U);
+    REQUIRE(floatToHalf(-std::ldexp(1.0F, -26)) == 0x8000U);
+    // the largest subnormal may round up to the smallest normal number
+    REQUIRE(floatToHalf(std::ldexp(2047.0F, -25)) == 0x0400U);
+  }
+
+  SUBCASE("Round to nearest even") {
+    // halfway cases between two normal numbers
+    REQUIRE(floatToHalf(1.0F + std::ldexp(1.0F, -11)) == 0x3c00U);
+    REQUIRE(floatToHalf(1.0F + std::ldexp(3.0F, -11)) == 0x3c02U);
+    // slightly above the halfway case
+    REQUIRE(floatToHalf(1.0F + std::ldexp(1.0F, -11) + std::ldexp(1.0F, -20)) == 0x3c01U);
+    // slightly below the halfway case
+    REQUIRE(floatToHalf(1.0F + std::ldexp(3.0F, -11) - std::ldexp(1.0F, -20)) == 0x3c01U);
+
+    // halfway cases between two subnormal numbers
+    REQUIRE(floatToHalf(std::ldexp(1.0F, -25)) == 0x0000U);
+    REQUIRE(floatToHalf(std::ldexp(3.0F, -25)) == 0x0002U);
+    REQUIRE(floatToHalf(std::ldexp(5.0F, -25)) == 0x0002U);
+  }
+
+  SUBCASE("Overflow to infinity") {
+    constexpr float Infinity = std::numeric_limits<float>::infinity();
+    // the largest value which still rounds down to 65504
+    REQUIRE(floatToHalf(65519.0F) == 0x7bffU);
+    // halfway between 65504 and 65536; rounds to the even neighbor, i.e. to infinity
+    REQUIRE(floatToHalf(65520.0F) == 0x7c00U);
+    REQUIRE(floatToHalf(1e10F) == 0x7c00U);
+    REQUIRE(floatToHalf(-1e10F) == 0xfc00U);
+    REQUIRE(floatToHalf(Infinity) == 0x7c00U);
+    REQUIRE(floatToHalf(-Infinity) == 0xfc00U);
+    REQUIRE(halfToFloat(0x7c00U) == Infinity);
+    REQUIRE(halfToFloat(0xfc00U) == -Infinity);
+  }
+
+  SUBCASE("NaN") {
+    const auto half = floatToHalf(std::numeric_limits<float>::quiet_NaN());
+    REQUIRE((half & 0x7c00U) == 0x7c00U);
+    REQUIRE((half & 0x03ffU) != 0);
+    REQUIRE(std::isnan(halfToFloat(half)));
+    REQUIRE(std::isnan(halfToFloat(0x7e00U)));
+    REQUIRE(std::isnan(halfToFloat(0xfc01U)));
+  }
+
+  SUBCASE("Round trip") {
+    // all non-NaN half values are exactly representable as float
+    for (std::uint32_t bits = 0; bits <= 0xffffU; ++bits) {
+      const auto half = static_cast<std::uint16_t>(bits);
+      if ((half & 0x7c00U) == 0x7c00U && (half & 0x03ffU) != 0) {
+        continue;
+      }
+      REQUIRE(floatToHalf(halfToFloat(half)) == half);
+    }
+  }
+}
+
+} // namespace seissol::unit_test
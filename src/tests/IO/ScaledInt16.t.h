@@ -0,0 +1,132 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "IO/Writer/File/ScaledInt16.h"
+#include "doctest.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Scaled 16-bit encoding") {
+  using namespace seissol::io::writer::file;
+
+  constexpr std::size_t Rows = 37;
+  constexpr std::size_t RowSize = 3;
+  constexpr std::size_t BlockRows = 8;
+  constexpr std::size_t Blocks = (Rows + BlockRows - 1) / BlockRows;
+  // the rows are split across two (virtual) ranks, with a boundary inside a block
+  constexpr std::size_t SplitRow = 13;
+
+  std::vector<double> values(Rows * RowSize);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    const std::size_t block = i / RowSize / BlockRows;
+    // a different magnitude and offset per block
+    values[i] = std::pow(10.0, static_cast<int>(block) - 2) * std::sin(0.7 * i) + 5.0 * block;
+  }
+  // a constant block
+  for (std::size_t i = 2 * BlockRows * RowSize; i < 3 * BlockRows * RowSize; ++i) {
+    values[i] = -3.5;
+  }
+
+  std::vector<double> lower(Blocks, std::numeric_limits<double>::infinity());
+  std::vector<double> upper(Blocks, -std::numeric_limits<double>::infinity());
+  blockRange(values.data(), SplitRow, RowSize, 0, BlockRows, lower, upper);
+  blockRange(values.data() + SplitRow * RowSize,
+             Rows - SplitRow,
+             RowSize,
+             SplitRow,
+             BlockRows,
+             lower,
+             upper);
+
+  std::vector<double> offsets;
+  std::vector<double> scales;
+  blockScaling(lower, upper, offsets, scales);
+  REQUIRE(offsets.size() == Blocks);
+  REQUIRE(scales.size() == Blocks);
+  REQUIRE(scales[2] == 1.0);
+  REQUIRE(offsets[2] == -3.5);
+
+  std::vector<std::int16_t> quantized(values.size());
+  quantize(values.data(), SplitRow, RowSize, 0, BlockRows, offsets, scales, quantized.data());
+  quantize(values.data() + SplitRow * RowSize,
+           Rows - SplitRow,
+           RowSize,
+           SplitRow,
+           BlockRows,
+           offsets,
+           scales,
+           quantized.data() + SplitRow * RowSize);
+
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    const std::size_t block = i / RowSize / BlockRows;
+    const double decoded = offsets[block] + scales[block] * quantized[i];
+    // allow for the rounding of the decoding itself
+    const double tolerance =
+        scales[block] / 2 + 4 * std::numeric_limits<double>::epsilon() * std::abs(values[i]);
+    REQUIRE(std::abs(decoded - values[i]) <= tolerance);
+  }
+
+  // the extremal values of each block map to the extremal integers
+  for (std::size_t block = 0; block < Blocks; ++block) {
+    if (block == 2) {
+      continue;
+    }
+    bool hasMin = false;
+    bool hasMax = false;
+    for (std::size_t i = block * BlockRows * RowSize;
+         i < std::min(values.size(), (block + 1) * BlockRows * RowSize);
+         ++i) {
+      hasMin = hasMin || quantized[i] == -32767;
+      hasMax = hasMax || quantized[i] == 32767;
+    }
+    REQUIRE(hasMin);
+    REQUIRE(hasMax);
+  }
+
+  SUBCASE("Non-finite values") {
+    const std::vector<float> special{1.0F,
+                                     std::numeric_limits<float>::quiet_NaN(),
+                                     std::numeric_limits<float>::infinity(),
+                                     -std::numeric_limits<float>::infinity(),
+                                     3.0F};
+    std::vector<double> specialLower(1, std::numeric_limits<double>::infinity());
+    std::vector<double> specialUpper(1, -std::numeric_limits<double>::infinity());
+    blockRange(special.data(), special.size(), 1, 0, special.size(), specialLower, specialUpper);
+    REQUIRE(specialLower[0] == 1.0);
+    REQUIRE(specialUpper[0] == 3.0);
+
+    std::vector<double> specialOffsets;
+    std::vector<double> specialScales;
+    blockScaling(specialLower, specialUpper, specialOffsets, specialScales);
+    std::vector<std::int16_t> specialQuantized(special.size());
+    quantize(special.data(),
+             special.size(),
+             1,
+             0,
+             special.size(),
+             specialOffsets,
+             specialScales,
+             specialQuantized.data());
+    REQUIRE(specialQuantized[0] == -32767);
+    REQUIRE(specialQuantized[1] == 0);
+    REQUIRE(specialQuantized[2] == 32767);
+    REQUIRE(specialQuantized[3] == -32767);
+    REQUIRE(specialQuantized[4] == 32767);
+  }
+
+  SUBCASE("Empty block") {
+    std::vector<double> emptyOffsets;
+    std::vector<double> emptyScales;
+    blockScaling({std::numeric_limits<double>::infinity()},
+                 {-std::numeric_limits<double>::infinity()},
+                 emptyOffsets,
+                 emptyScales);
+    REQUIRE(emptyOffsets[0] == 0.0);
+    REQUIRE(emptyScales[0] == 1.0);
+  }
+}
+
+} // namespace seissol::unit_test
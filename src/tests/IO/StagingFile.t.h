@@ -0,0 +1,72 @@
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "IO/Writer/File/StagingFile.h"
+#include "IO/Writer/Writer.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Staging file") {
+  using namespace seissol::io::writer;
+
+  const std::string path = file::StagingFile::fileName("stagingFileTest", 3);
+  REQUIRE(path == "stagingFileTest-3.stage");
+
+  const std::vector<double> first{1.0, -2.5, 3.25};
+  const std::vector<int> second{7, 8};
+  const std::string plan = "instructions: []";
+
+  SUBCASE("Write and read") {
+    file::StagingFile::write(path,
+                             plan,
+                             4,
+                             {{5, first.data(), first.size() * sizeof(double)},
+                              {2, second.data(), second.size() * sizeof(int)},
+                              {9, nullptr, 0}});
+    {
+      const file::StagingFile staged(path);
+      REQUIRE(staged.plan() == plan);
+      REQUIRE(staged.commsize() == 4);
+
+      REQUIRE(staged.hasBuffer(5));
+      REQUIRE(staged.bufferSize(5) == first.size() * sizeof(double));
+      REQUIRE(std::memcmp(staged.buffer(5), first.data(), staged.bufferSize(5)) == 0);
+
+      REQUIRE(staged.hasBuffer(2));
+      REQUIRE(staged.bufferSize(2) == second.size() * sizeof(int));
+      REQUIRE(std::memcmp(staged.buffer(2), second.data(), staged.bufferSize(2)) == 0);
+
+      REQUIRE(staged.hasBuffer(9));
+      REQUIRE(staged.bufferSize(9) == 0);
+
+      REQUIRE_FALSE(staged.hasBuffer(0));
+    }
+    std::remove(path.c_str());
+  }
+
+  SUBCASE("A mapped file stays intact when it is replaced") {
+    file::StagingFile::write(path, plan, 1, {{0, first.data(), first.size() * sizeof(double)}});
+    const file::StagingFile staged(path);
+
+    const std::vector<double> replacement{4.0, 5.0, 6.0};
+    file::StagingFile::write(
+        path, plan, 2, {{0, replacement.data(), replacement.size() * sizeof(double)}});
+    REQUIRE(std::memcmp(staged.buffer(0), first.data(), staged.bufferSize(0)) == 0);
+
+    const file::StagingFile restaged(path);
+    REQUIRE(restaged.commsize() == 2);
+    REQUIRE(std::memcmp(restaged.buffer(0), replacement.data(), restaged.bufferSize(0)) == 0);
+    std::remove(path.c_str());
+  }
+
+  SUBCASE("The staging path is part of the plan") {
+    Writer writer;
+    REQUIRE(Writer(writer.serialize()).stagingPath().empty());
+    writer.setStagingPath("/tmp/stagingFileTest");
+    REQUIRE(Writer(writer.serialize()).stagingPath() == "/tmp/stagingFileTest");
+  }
+}
+
+} // namespace seissol::unit_test
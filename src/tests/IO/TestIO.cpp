@@ -0,0 +1,5 @@
+#include "doctest.h"
+
+#include "HalfPrecision.t.h"
+#include "ScaledInt16.t.h"
+#include "StagingFile.t.h"
@@ -0,0 +1,77 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Initializer/EasiQueryCache.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Easi query cache") {
+  using namespace seissol::initializer;
+  const std::string directory = "easiQueryCacheTest";
+  const std::string modelFile = "easiQueryCacheTest.yaml";
+  {
+    std::ofstream file(modelFile);
+    file << "!ConstantMap\nmap:\n  rho: 2600.0\n";
+  }
+
+  easi::Query query(3, 3);
+  for (unsigned point = 0; point < 3; ++point) {
+    for (unsigned dim = 0; dim < 3; ++dim) {
+      query.x(point, dim) = point + 0.5 * dim;
+    }
+    query.group(point) = 1;
+  }
+  const std::vector<std::string> parameters{"elastic", "rho"};
+  const auto key = EasiQueryCache::key(modelFile, query, parameters);
+
+  SUBCASE("Keys") {
+    REQUIRE(EasiQueryCache::key(modelFile, query, parameters) == key);
+    REQUIRE(EasiQueryCache::key(modelFile, query, {"elastic", "rho", "mu"}) != key);
+
+    query.group(2) = 2;
+    REQUIRE(EasiQueryCache::key(modelFile, query, parameters) != key);
+    query.group(2) = 1;
+    query.x(1, 2) += 1.0e-12;
+    REQUIRE(EasiQueryCache::key(modelFile, query, parameters) != key);
+    query.x(1, 2) -= 1.0e-12;
+    REQUIRE(EasiQueryCache::key(modelFile, query, parameters) == key);
+
+    {
+      std::ofstream file(modelFile);
+      file << "!ConstantMap\nmap:\n  rho: 2700.0\n";
+    }
+    REQUIRE(EasiQueryCache::key(modelFile, query, parameters) != key);
+  }
+
+  SUBCASE("Store and load") {
+    const EasiQueryCache cache(directory);
+    REQUIRE(cache.enabled());
+    const std::vector<double> values{2600.0, 2650.0, 2700.0};
+    std::vector<double> loaded(values.size());
+    const auto reader = [&](const double* data) { loaded.assign(data, data + values.size()); };
+
+    REQUIRE_FALSE(cache.load(key, values.size(), reader));
+    cache.store(key, values);
+    REQUIRE(cache.load(key, values.size(), reader));
+    REQUIRE(loaded == values);
+
+    // entries of a different size or key are not used
+    REQUIRE_FALSE(cache.load(key, values.size() + 1, reader));
+    REQUIRE_FALSE(cache.load(key + 1, values.size(), reader));
+  }
+
+  SUBCASE("Disabled cache") {
+    const EasiQueryCache cache("");
+    REQUIRE_FALSE(cache.enabled());
+    cache.store(key, {1.0});
+    REQUIRE_FALSE(cache.load(key, 1, [](const double* /*data*/) {}));
+  }
+
+  std::filesystem::remove_all(directory);
+  std::remove(modelFile.c_str());
+}
+
+} // namespace seissol::unit_test
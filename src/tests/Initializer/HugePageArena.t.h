@@ -0,0 +1,65 @@
+#include <cstdint>
+#include <cstring>
+
+#include "Initializer/HugePageArena.h"
+#include "Initializer/MemoryAllocator.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Huge page arena") {
+  using namespace seissol::memory;
+  constexpr std::size_t BlockSize = 4 * HugePageArena::HugePageSize;
+
+  HugePageArena arena(BlockSize);
+  REQUIRE(arena.allocate(0, 64) == nullptr);
+
+  auto* first = static_cast<char*>(arena.allocate(100, 64));
+  auto* second = static_cast<char*>(arena.allocate(1000, 256));
+  REQUIRE(reinterpret_cast<std::uintptr_t>(first) % HugePageArena::HugePageSize == 0);
+  REQUIRE(reinterpret_cast<std::uintptr_t>(second) % 256 == 0);
+  REQUIRE(second >= first + 100);
+  std::memset(first, 1, 100);
+  std::memset(second, 2, 1000);
+  REQUIRE(first[99] == 1);
+
+  // does not fit into the first block anymore
+  auto* large = static_cast<char*>(arena.allocate(BlockSize, 64));
+  std::memset(large, 3, BlockSize);
+  REQUIRE(second[999] == 2);
+
+  auto statistics = arena.statistics();
+  REQUIRE(statistics.allocations == 3);
+  REQUIRE(statistics.blocks == 2);
+  REQUIRE(statistics.mappedBytes == 2 * BlockSize);
+  REQUIRE(statistics.usedBytes == 256 + 1000 + BlockSize);
+  REQUIRE(statistics.mappedBytesPerKind[0] + statistics.mappedBytesPerKind[1] +
+              statistics.mappedBytesPerKind[2] ==
+          statistics.mappedBytes);
+
+  // the remainder of the first block is still used
+  REQUIRE(static_cast<char*>(arena.allocate(100, 64)) < first + BlockSize);
+
+  const auto pageSize = HugePageArena::pageSizeOf(first);
+  REQUIRE((pageSize == HugePageArena::HugePageSize || pageSize == HugePageArena::GiganticPageSize));
+  REQUIRE(HugePageArena::pageSizeOf(large + BlockSize - 1) >= HugePageArena::HugePageSize);
+  int notInArena = 0;
+  REQUIRE(HugePageArena::pageSizeOf(&notInArena) == 0);
+
+  // a reserved block has the size of the demand, not the block size
+  HugePageArena reserved(16 * HugePageArena::HugePageSize);
+  reserved.reserve(HugePageArena::HugePageSize + 1000);
+  auto* reservedFirst = static_cast<char*>(reserved.allocate(HugePageArena::HugePageSize, 64));
+  auto* reservedSecond = static_cast<char*>(reserved.allocate(1000, 64));
+  REQUIRE(reservedSecond == reservedFirst + HugePageArena::HugePageSize);
+  REQUIRE(reserved.statistics().blocks == 1);
+  REQUIRE(reserved.statistics().mappedBytes == 2 * HugePageArena::HugePageSize);
+  // nothing more to map, if the demand fits
+  reserved.reserve(1000);
+  REQUIRE(reserved.statistics().blocks == 1);
+
+  ManagedAllocator allocator;
+  REQUIRE(allocator.allocateMemory(100, 64, HugePages) != nullptr);
+  REQUIRE(allocator.hugePageStatistics().allocations == 1);
+}
+
+} // namespace seissol::unit_test
@@ -1,4 +1,8 @@
 #include "doctest.h"
 
+#include "EasiQueryCache.t.h"
+#include "HugePageArena.t.h"
 #include "PointMapper.t.h"
+#include "time_stepping/CostFactors.t.h"
+#include "time_stepping/CostModel.t.h"
 #include "time_stepping/LTSWeights.t.h"
@@ -0,0 +1,66 @@
+#include <vector>
+
+#include "Initializer/TimeStepping/LtsWeights/CostFactors.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Cost factors for rebalancing") {
+  using namespace seissol::initializer::time_stepping;
+
+  SUBCASE("Measured factor") {
+    // 2 s per 1000 updates locally, 3 s per 3000 updates on all ranks
+    REQUIRE(measuredCostFactor({2.0, 1000.0}, {3.0, 3000.0}) == doctest::Approx(2.0));
+    REQUIRE(measuredCostFactor({0.5, 1000.0}, {3.0, 3000.0}) == doctest::Approx(0.5));
+    // nothing measured
+    REQUIRE(measuredCostFactor({0.0, 0.0}, {3.0, 3000.0}) == 1.0);
+    REQUIRE(measuredCostFactor({1.0, 100.0}, {0.0, 0.0}) == 1.0);
+  }
+
+  SUBCASE("Composition per group") {
+    const std::vector<double> loadedFactors{1.0, 2.0, 1.5, 1.0};
+    const std::vector<std::size_t> cellGroups{0, 0, 1, 2};
+    const std::vector<CostMeasurement> local{{2.0, 100.0}, {1.0, 100.0}, {0.0, 0.0}};
+    const std::vector<CostMeasurement> global{{4.0, 400.0}, {3.0, 600.0}, {1.0, 100.0}};
+
+    std::vector<double> factors(loadedFactors.size());
+    composeCostFactors(factors, loadedFactors, cellGroups, local, global);
+    REQUIRE(factors[0] == doctest::Approx(2.0));
+    REQUIRE(factors[1] == doctest::Approx(4.0));
+    REQUIRE(factors[2] == doctest::Approx(3.0));
+    // a group without updates keeps the loaded factor
+    REQUIRE(factors[3] == doctest::Approx(1.0));
+  }
+
+  SUBCASE("Restarts do not undo the correction") {
+    // the cells of group 0 are twice as expensive as the model predicts
+    const std::vector<std::size_t> cellGroups{0, 1};
+    const std::vector<CostMeasurement> global{{3.0, 2000.0}, {3.0, 2000.0}};
+
+    // first run: not rebalanced yet
+    const std::vector<double> initialFactors{1.0, 1.0};
+    std::vector<double> factors(initialFactors.size());
+    composeCostFactors(
+        factors, initialFactors, cellGroups, {{3.0, 1000.0}, {1.5, 1000.0}}, global);
+    REQUIRE(factors[0] == doctest::Approx(2.0));
+    REQUIRE(factors[1] == doctest::Approx(1.0));
+
+    // restart with the written factors: the partition is balanced, hence the measured factors
+    // are 1; the written factors must stay the same
+    const auto loadedFactors = factors;
+    composeCostFactors(factors, loadedFactors, cellGroups, {{1.5, 1000.0}, {1.5, 1000.0}}, global);
+    REQUIRE(factors[0] == doctest::Approx(2.0));
+    REQUIRE(factors[1] == doctest::Approx(1.0));
+  }
+
+  SUBCASE("Application to the cell costs") {
+    std::vector<int> cellCosts{100, 100, 300, 1};
+    applyCostFactors(cellCosts, {2.0, 0.51, 1.0 / 3.0, 0.1});
+    REQUIRE(cellCosts[0] == 200);
+    REQUIRE(cellCosts[1] == 51);
+    REQUIRE(cellCosts[2] == 100);
+    // a cell keeps a positive cost
+    REQUIRE(cellCosts[3] == 1);
+  }
+}
+
+} // namespace seissol::unit_test
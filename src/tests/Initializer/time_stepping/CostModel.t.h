@@ -0,0 +1,62 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+#include "Initializer/TimeStepping/LtsWeights/CostModel.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Cost model for LTS weights") {
+  using namespace seissol::initializer::time_stepping;
+  const seissol::initializer::parameters::VertexWeightParameters vertexWeights{100, 200, 300};
+
+  SUBCASE("Derive costs") {
+    const auto costModel = deriveCostModel(2.0, 1000.0, 3.0, 500.0, vertexWeights);
+    REQUIRE(costModel.element == doctest::Approx(2e-3));
+    REQUIRE(costModel.dynamicRupture == doctest::Approx(6e-3));
+    REQUIRE(costModel.freeSurfaceWithGravity == doctest::Approx(6e-3));
+  }
+
+  SUBCASE("Without dynamic rupture, the parameter file weights are kept") {
+    const auto costModel = deriveCostModel(2.0, 1000.0, 0.0, 0.0, vertexWeights);
+    const auto weights = toVertexWeights(costModel, vertexWeights);
+    REQUIRE(weights.weightElement == 100);
+    REQUIRE(weights.weightDynamicRupture == 200);
+    REQUIRE(weights.weightFreeSurfaceWithGravity == 300);
+  }
+
+  SUBCASE("Vertex weights") {
+    const CostModel costModel{1e-6, 5e-6, 0.5e-6};
+    const auto weights = toVertexWeights(costModel, vertexWeights);
+    REQUIRE(weights.weightElement == 100);
+    // a dynamic rupture face is charged to both of its elements
+    REQUIRE(weights.weightDynamicRupture == 250);
+    REQUIRE(weights.weightFreeSurfaceWithGravity == 50);
+  }
+
+  SUBCASE("Write and read") {
+    const std::string fileName = "costModelTest.txt";
+    const CostModel costModel{1.25e-6, 3.5e-6, 0.75e-6};
+    writeCostModel(fileName, costModel);
+    const auto readModel = readCostModel(fileName);
+    REQUIRE(readModel.has_value());
+    REQUIRE(readModel->element == costModel.element);
+    REQUIRE(readModel->dynamicRupture == costModel.dynamicRupture);
+    REQUIRE(readModel->freeSurfaceWithGravity == costModel.freeSurfaceWithGravity);
+    std::remove(fileName.c_str());
+  }
+
+  SUBCASE("Missing or invalid files") {
+    REQUIRE_FALSE(readCostModel("costModelTestMissing.txt").has_value());
+
+    const std::string fileName = "costModelTestInvalid.txt";
+    {
+      std::ofstream file(fileName);
+      file << "dynamicRupture 1e-6" << std::endl;
+    }
+    REQUIRE_FALSE(readCostModel(fileName).has_value());
+    std::remove(fileName.c_str());
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,172 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "Equations/Datastructures.h"
+#include "Kernels/Plasticity.h"
+#include "Kernels/Precision.h"
+#include "Model/Plasticity.h"
+#include "generated_code/init.h"
+#include "generated_code/tensor.h"
+
+#include "doctest.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Plasticity screening is conservative") {
+  alignas(Alignment) real vandermonde[tensor::v::size()];
+  alignas(Alignment) real vandermondeInverse[tensor::vInv::size()];
+  std::copy_n(init::v::Values, tensor::v::size(), vandermonde);
+  std::copy_n(init::vInv::Values, tensor::vInv::size(), vandermondeInverse);
+  GlobalData global;
+  global.vandermondeMatrix = vandermonde;
+  global.vandermondeMatrixInverse = vandermondeInverse;
+
+  const auto screening = kernels::Plasticity::computeScreening(&global);
+  CHECK(screening.constantBasis > 0.0);
+  CHECK(screening.nonConstantBound > 0.0);
+
+  const model::Plasticity parameters{0.6, 1.0e6, -5.0e6, -6.0e6, -7.0e6, 1.0e5, 0.0, 2.0e5};
+  model::ElasticMaterial material;
+  material.mu = 3.0e10;
+  const model::PlasticityData plasticityData(parameters, &material);
+
+  alignas(Alignment) real dofs[tensor::Q::size()];
+  alignas(Alignment) real reference[tensor::Q::size()];
+  real pstrain[tensor::QStress::size() + tensor::QEtaModal::size()];
+  auto dofsView = init::QStress::view::create(dofs);
+  const unsigned numBasisFunctions = dofsView.shape(0);
+
+  std::mt19937 generator(20241016);
+  std::uniform_real_distribution<real> distribution(-1.0, 1.0);
+
+  SUBCASE("cell at rest") {
+    std::fill_n(dofs, tensor::Q::size(), 0.0);
+    CHECK(kernels::Plasticity::isElastic(screening, &plasticityData, dofs));
+  }
+
+  SUBCASE("large deviatoric stress") {
+    std::fill_n(dofs, tensor::Q::size(), 0.0);
+    dofsView(0, 3) = 1.0e8;
+    CHECK(!kernels::Plasticity::isElastic(screening, &plasticityData, dofs));
+  }
+
+  SUBCASE("elastic cells are not changed by the nodal kernel") {
+    unsigned numElastic = 0;
+    for (unsigned trial = 0; trial < 200; ++trial) {
+      // stress perturbations over several orders of magnitude
+      const real scale = 1.0e3 * (1 << (trial % 16));
+      std::fill_n(dofs, tensor::Q::size(), 0.0);
+      for (unsigned basis = 0; basis < numBasisFunctions; ++basis) {
+        for (unsigned c = 0; c < 6; ++c) {
+          dofsView(basis, c) = scale * distribution(generator);
+        }
+      }
+      std::memcpy(reference, dofs, sizeof(dofs));
+      std::fill_n(pstrain, tensor::QStress::size() + tensor::QEtaModal::size(), 0.0);
+
+      if (kernels::Plasticity::isElastic(screening, &plasticityData, dofs)) {
+        ++numElastic;
+        const auto yielded = kernels::Plasticity::computePlasticity(
+            0.5, 1.0e-3, 0.05, &global, &plasticityData, dofs, pstrain);
+        CHECK(yielded == 0);
+        CHECK(std::equal(dofs, dofs + tensor::Q::size(), reference));
+      }
+    }
+    // the small perturbations should pass the screening
+    CHECK(numElastic > 0);
+  }
+}
+
+TEST_CASE("Plasticity for blocks of cells") {
+  alignas(Alignment) real vandermonde[tensor::v::size()];
+  alignas(Alignment) real vandermondeInverse[tensor::vInv::size()];
+  std::copy_n(init::v::Values, tensor::v::size(), vandermonde);
+  std::copy_n(init::vInv::Values, tensor::vInv::size(), vandermondeInverse);
+  GlobalData global;
+  global.vandermondeMatrix = vandermonde;
+  global.vandermondeMatrixInverse = vandermondeInverse;
+
+  constexpr std::size_t NumCells = kernels::Plasticity::BlockSize - 1;
+  constexpr auto PstrainSize = tensor::QStress::size() + tensor::QEtaModal::size();
+  constexpr real Epsilon = 100 * std::numeric_limits<real>::epsilon();
+
+  model::ElasticMaterial material;
+  material.mu = 3.0e10;
+  std::vector<model::PlasticityData> plasticityData;
+  for (std::size_t cell = 0; cell < NumCells; ++cell) {
+    const double cohesion = 1.0e6 * (cell + 1);
+    const model::Plasticity parameters{
+        0.6, cohesion, -5.0e6, -6.0e6, -7.0e6, 1.0e5 * cell, 0.0, 2.0e5};
+    plasticityData.emplace_back(parameters, &material);
+  }
+
+  struct alignas(Alignment) CellData {
+    alignas(Alignment) real dofs[tensor::Q::size()];
+    real pstrain[PstrainSize];
+  };
+  std::vector<CellData> single(NumCells);
+  std::vector<CellData> blocked(NumCells);
+
+  std::mt19937 generator(20241016);
+  std::uniform_real_distribution<real> distribution(-1.0, 1.0);
+  for (std::size_t cell = 0; cell < NumCells; ++cell) {
+    // from elastic to strongly yielding cells
+    const real scale = 1.0e4 * (1 << (2 * cell));
+    for (auto& value : single[cell].dofs) {
+      value = scale * distribution(generator);
+    }
+    for (auto& value : single[cell].pstrain) {
+      value = 1.0e-6 * distribution(generator);
+    }
+    blocked[cell] = single[cell];
+  }
+
+  unsigned numYieldedSingle = 0;
+  std::vector<unsigned> yieldedSingle(NumCells);
+  for (std::size_t cell = 0; cell < NumCells; ++cell) {
+    yieldedSingle[cell] = kernels::Plasticity::computePlasticity(
+        0.5, 1.0e-3, 0.05, &global, &plasticityData[cell], single[cell].dofs, single[cell].pstrain);
+    numYieldedSingle += yieldedSingle[cell];
+  }
+
+  const model::PlasticityData* plasticityPointers[NumCells];
+  real* dofsPointers[NumCells];
+  real* pstrainPointers[NumCells];
+  unsigned yieldedBlocked[NumCells];
+  for (std::size_t cell = 0; cell < NumCells; ++cell) {
+    plasticityPointers[cell] = &plasticityData[cell];
+    dofsPointers[cell] = blocked[cell].dofs;
+    pstrainPointers[cell] = blocked[cell].pstrain;
+  }
+  const auto numYieldedBlocked = kernels::Plasticity::computePlasticityBlock(0.5,
+                                                                             1.0e-3,
+                                                                             0.05,
+                                                                             &global,
+                                                                             NumCells,
+                                                                             plasticityPointers,
+                                                                             dofsPointers,
+                                                                             pstrainPointers,
+                                                                             yieldedBlocked);
+
+  CHECK(numYieldedSingle > 0);
+  CHECK(numYieldedSingle < NumCells);
+  CHECK(numYieldedBlocked == numYieldedSingle);
+  for (std::size_t cell = 0; cell < NumCells; ++cell) {
+    CHECK(yieldedBlocked[cell] == yieldedSingle[cell]);
+    for (std::size_t i = 0; i < tensor::Q::size(); ++i) {
+      CHECK(blocked[cell].dofs[i] == doctest::Approx(single[cell].dofs[i]).epsilon(Epsilon));
+    }
+    for (std::size_t i = 0; i < PstrainSize; ++i) {
+      CHECK(blocked[cell].pstrain[i] == doctest::Approx(single[cell].pstrain[i]).epsilon(Epsilon));
+    }
+  }
+}
+
+} // namespace seissol::unit_test
@@ -2,6 +2,10 @@
 
 #include "PointSourceCluster.t.h"
 
+#ifdef USE_ELASTIC
+#include "Plasticity.t.h"
+#endif // USE_ELASTIC
+
 #ifdef USE_POROELASTIC
 #include "STP.t.h"
 #endif // USE_POROELASTIC
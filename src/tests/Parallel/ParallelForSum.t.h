@@ -0,0 +1,56 @@
+#include <array>
+#include <cstddef>
+
+#include "Parallel/Runtime/ParallelFor.h"
+
+namespace seissol::unit_test {
+
+namespace {
+struct TwoSums {
+  std::array<double, 2> values{};
+
+  TwoSums& operator+=(const TwoSums& other) {
+    values[0] += other.values[0];
+    values[1] += other.values[1];
+    return *this;
+  }
+};
+} // namespace
+
+TEST_CASE("Parallel sums") {
+  using namespace seissol::parallel::runtime;
+  constexpr std::size_t Count = 1000;
+  const auto handler = [](std::size_t i) { return TwoSums{{static_cast<double>(i), 1.0}}; };
+
+  SUBCASE("Arithmetic") {
+    const auto sum = parallelForSum<unsigned>(Count, [](std::size_t i) { return i % 2; });
+    REQUIRE(sum == Count / 2);
+  }
+
+  SUBCASE("Struct") {
+    const auto sum = parallelForSum<TwoSums>(Count, handler);
+    REQUIRE(sum.values[0] == Count * (Count - 1) / 2);
+    REQUIRE(sum.values[1] == Count);
+  }
+
+  SUBCASE("Struct in tasks") {
+    TwoSums sum{};
+#ifdef _OPENMP
+#pragma omp parallel
+#pragma omp single
+#endif
+    {
+      sum = parallelForSum<TwoSums>(Count, handler);
+    }
+    REQUIRE(sum.values[0] == Count * (Count - 1) / 2);
+    REQUIRE(sum.values[1] == Count);
+  }
+
+  SUBCASE("Empty") {
+    const auto sum = parallelForSum<TwoSums>(0, handler);
+    REQUIRE(sum.values[0] == 0);
+    REQUIRE(sum.values[1] == 0);
+  }
+}
+
+} // namespace seissol::unit_test
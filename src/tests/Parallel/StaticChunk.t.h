@@ -0,0 +1,39 @@
+#include "Parallel/Runtime/ParallelFor.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Static chunks") {
+  using namespace seissol::parallel::runtime;
+  SUBCASE("Even") {
+    for (std::size_t thread = 0; thread < 4; ++thread) {
+      const auto chunk = staticChunk(12, thread, 4);
+      REQUIRE(chunk.begin == 3 * thread);
+      REQUIRE(chunk.end == 3 * thread + 3);
+    }
+  }
+
+  SUBCASE("Remainder") {
+    const std::size_t sizes[] = {3, 3, 2, 2};
+    std::size_t begin = 0;
+    for (std::size_t thread = 0; thread < 4; ++thread) {
+      const auto chunk = staticChunk(10, thread, 4);
+      REQUIRE(chunk.begin == begin);
+      REQUIRE(chunk.end - chunk.begin == sizes[thread]);
+      begin = chunk.end;
+    }
+    REQUIRE(begin == 10);
+  }
+
+  SUBCASE("More threads than iterations") {
+    std::size_t begin = 0;
+    for (std::size_t thread = 0; thread < 5; ++thread) {
+      const auto chunk = staticChunk(2, thread, 5);
+      REQUIRE(chunk.begin == begin);
+      REQUIRE(chunk.end - chunk.begin == (thread < 2 ? 1 : 0));
+      begin = chunk.end;
+    }
+    REQUIRE(begin == 2);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -1,3 +1,5 @@
 #include "doctest.h"
 
+#include "ParallelForSum.t.h"
 #include "PinTest.t.h"
+#include "StaticChunk.t.h"
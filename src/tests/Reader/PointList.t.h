@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "Reader/PointList.h"
+
+#include "doctest.h"
+
+#include <sstream>
+#include <vector>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Binary point lists") {
+  const std::vector<Eigen::Vector3d> points = {
+      {1.0, 0.1, 10.0}, {-1e4, 1e3, 1e-10}, {0.0, 0.0, 0.0}};
+
+  SUBCASE("round trip") {
+    std::stringstream stream;
+    reader::writeBinaryPointList(stream, points);
+    const auto read = reader::readBinaryPointList(stream);
+    REQUIRE(read.has_value());
+    REQUIRE(read->size() == points.size());
+    for (std::size_t i = 0; i < points.size(); ++i) {
+      CHECK((*read)[i] == points[i]);
+    }
+  }
+
+  SUBCASE("empty list") {
+    std::stringstream stream;
+    reader::writeBinaryPointList(stream, {});
+    const auto read = reader::readBinaryPointList(stream);
+    REQUIRE(read.has_value());
+    CHECK(read->empty());
+  }
+
+  SUBCASE("text is not recognized as binary") {
+    std::stringstream stream("1 0.1 10\n10 2 0.2\n");
+    CHECK(!reader::readBinaryPointList(stream).has_value());
+  }
+}
+
+} // namespace seissol::unit_test
@@ -1,6 +1,7 @@
 #include "doctest.h"
 
 #include "FSRMReader.t.h"
+#include "PointList.t.h"
 
 #ifdef USE_NETCDF
 #include "NRFReader.t.h"
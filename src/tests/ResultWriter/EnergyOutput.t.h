@@ -0,0 +1,41 @@
+#include <limits>
+#include <vector>
+
+#include "ResultWriter/EnergyOutput.h"
+
+namespace seissol::unit_test {
+
+TEST_CASE("Energy output") {
+  using namespace seissol::writer;
+
+  SUBCASE("Duplicated copy cells are counted once") {
+    constexpr auto Invalid = std::numeric_limits<unsigned>::max();
+    // cells 0 and 3 (and cells 2 and 4) belong to the same element; cell 5 has none
+    const std::vector<unsigned> ltsToMesh{1, 0, 2, 1, 2, Invalid};
+    // the primary cell of each element
+    const std::vector<unsigned> meshToLts{1, 3, 2};
+
+    const auto primaryMeshIds =
+        computePrimaryMeshIds(ltsToMesh.data(), ltsToMesh.size(), meshToLts.data());
+    const std::vector<unsigned> expected{Invalid, 0, 2, 1, Invalid, Invalid};
+    REQUIRE(primaryMeshIds == expected);
+  }
+
+  SUBCASE("Summing up energies") {
+    EnergiesStorage first{};
+    first.elasticEnergy() = 1.0;
+    first.plasticMoment() = 2.0;
+    EnergiesStorage second{};
+    second.elasticEnergy() = 0.5;
+    second.totalMomentumZ() = -1.0;
+
+    first += second;
+    REQUIRE(first.elasticEnergy() == 1.5);
+    REQUIRE(first.plasticMoment() == 2.0);
+    REQUIRE(first.totalMomentumZ() == -1.0);
+    REQUIRE(first.acousticEnergy() == 0.0);
+  }
+
+}
+
+} // namespace seissol::unit_test
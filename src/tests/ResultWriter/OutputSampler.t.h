@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2024 SeisSol Group
+//
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "Kernels/Precision.h"
+#include "ResultWriter/OutputSampler.h"
+#include <cstddef>
+#include <vector>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Output sampler") {
+  // two clusters with two cells each; one cell consists of two DOFs
+  const std::vector<real> dofs(8, 0.0);
+  std::vector<double> times;
+  std::vector<std::vector<real>> written;
+
+  seissol::writer::OutputSampler sampler;
+  sampler.init(0.5,
+               dofs.data(),
+               dofs.size(),
+               nullptr,
+               0,
+               [&](double time, const real* data, const real* pstrain) {
+                 REQUIRE(pstrain == nullptr);
+                 times.push_back(time);
+                 written.emplace_back(data, data + dofs.size());
+               });
+  sampler.setNumContributors(2);
+
+  REQUIRE(sampler.enabled());
+  REQUIRE(sampler.firstIndexAfter(0.0, 1e-6) == 1);
+  REQUIRE(sampler.firstIndexAfter(0.7, 1e-6) == 2);
+  REQUIRE(sampler.firstIndexAfter(1.0 - 1e-8, 1e-6) == 3);
+  REQUIRE(sampler.time(3) == 1.5);
+
+  const auto stage = [&](std::size_t index, std::size_t offset, real value) {
+    real* staged = sampler.stageDofs(index, dofs.data() + offset);
+    for (std::size_t i = 0; i < 4; ++i) {
+      staged[i] = value + i;
+    }
+    sampler.contribute(index);
+  };
+
+  SUBCASE("Snapshots are written once complete, in order") {
+    // the fast cluster passes two output times before the slow one passes the first
+    stage(1, 0, 10.0);
+    stage(2, 0, 20.0);
+    REQUIRE(sampler.flush() == 0);
+    REQUIRE(sampler.pending() == 2);
+
+    stage(1, 4, 30.0);
+    REQUIRE(sampler.flush() == 1);
+    REQUIRE(times == std::vector<double>{0.5});
+    REQUIRE(written[0] == std::vector<real>{10.0, 11.0, 12.0, 13.0, 30.0, 31.0, 32.0, 33.0});
+
+    stage(2, 4, 40.0);
+    stage(3, 4, 50.0);
+    REQUIRE(sampler.flush() == 1);
+    REQUIRE(times == std::vector<double>{0.5, 1.0});
+    REQUIRE(written[1] == std::vector<real>{20.0, 21.0, 22.0, 23.0, 40.0, 41.0, 42.0, 43.0});
+    REQUIRE(sampler.pending() == 1);
+
+    // the written snapshot is re-used for the next output time
+    stage(3, 0, 60.0);
+    REQUIRE(sampler.flush() == 1);
+    REQUIRE(times == std::vector<double>{0.5, 1.0, 1.5});
+    REQUIRE(written[2] == std::vector<real>{60.0, 61.0, 62.0, 63.0, 50.0, 51.0, 52.0, 53.0});
+    REQUIRE(sampler.pending() == 0);
+  }
+
+  SUBCASE("Incomplete snapshots are discarded") {
+    stage(1, 0, 10.0);
+    sampler.discard();
+    REQUIRE(sampler.pending() == 0);
+    REQUIRE(sampler.flush() == 0);
+    REQUIRE(times.empty());
+  }
+}
+
+} // namespace seissol::unit_test
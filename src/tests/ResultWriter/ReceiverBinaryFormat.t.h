@@ -0,0 +1,77 @@
+#include "ResultWriter/ReceiverBinaryFormat.h"
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace seissol::unit_test {
+
+TEST_CASE("Binary receiver file round trip") {
+  seissol::writer::ReceiverBinaryHeader header;
+  header.valueSize = sizeof(float);
+  header.variables = {"u", "v"};
+  header.pointIds = {4, 1};
+  header.points = {{1.0, 2.0, 3.0}, {-1.0, 0.5, 1e-3}};
+
+  const std::vector<std::vector<float>> firstChunk = {{0.0, 1.0, 2.0, 0.5, 3.0, 4.0}, {}};
+  const std::vector<std::vector<float>> secondChunk = {{1.0, 5.0, 6.0}, {1.0, 7.0, 8.0}};
+
+  std::stringstream stream;
+  seissol::writer::writeReceiverBinaryHeader(stream, header);
+  seissol::writer::writeReceiverBinaryChunk(stream, firstChunk);
+  seissol::writer::writeReceiverBinaryChunk(stream, secondChunk);
+
+  const auto readHeader = seissol::writer::readReceiverBinaryHeader(stream);
+  REQUIRE(readHeader.valueSize == sizeof(float));
+  REQUIRE(readHeader.ncols() == 3);
+  REQUIRE(readHeader.variables == header.variables);
+  REQUIRE(readHeader.pointIds == header.pointIds);
+  REQUIRE(readHeader.points == header.points);
+
+  std::vector<std::vector<double>> outputs;
+  for (const auto& expected : {firstChunk, secondChunk}) {
+    REQUIRE(seissol::writer::readReceiverBinaryChunk(stream, readHeader, outputs));
+    REQUIRE(outputs.size() == expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+      REQUIRE(outputs[i] == std::vector<double>(expected[i].begin(), expected[i].end()));
+    }
+  }
+  REQUIRE_FALSE(seissol::writer::readReceiverBinaryChunk(stream, readHeader, outputs));
+}
+
+TEST_CASE("Binary receiver file is resumed after the last complete chunk") {
+  seissol::writer::ReceiverBinaryHeader header;
+  header.variables = {"u"};
+  header.pointIds = {0, 3};
+  header.points = {{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}};
+  const std::vector<std::vector<double>> chunk = {{0.0, 1.0}, {0.0, 2.0, 0.5, 3.0}};
+
+  std::stringstream complete;
+  seissol::writer::writeReceiverBinaryHeader(complete, header);
+  const auto headerSize = complete.str().size();
+  seissol::writer::writeReceiverBinaryChunk(complete, chunk);
+  const auto firstChunkEnd = complete.str().size();
+  seissol::writer::writeReceiverBinaryChunk(complete, chunk);
+  const auto data = complete.str();
+
+  std::stringstream stream(data);
+  REQUIRE(seissol::writer::receiverBinaryResumeOffset(stream, header) == data.size());
+
+  // an aborted write leaves a partial chunk
+  std::stringstream partial(data.substr(0, data.size() - 3));
+  REQUIRE(seissol::writer::receiverBinaryResumeOffset(partial, header) == firstChunkEnd);
+
+  std::stringstream headerOnly(data.substr(0, headerSize));
+  REQUIRE(seissol::writer::receiverBinaryResumeOffset(headerOnly, header) == headerSize);
+
+  auto otherHeader = header;
+  otherHeader.pointIds = {0, 4};
+  std::stringstream other(data);
+  REQUIRE(seissol::writer::receiverBinaryResumeOffset(other, otherHeader) == 0);
+}
+
+TEST_CASE("Binary receiver file rejects foreign data") {
+  std::stringstream stream("TITLE = \"Temporal Signal for receiver number 00001\"");
+  CHECK_THROWS_AS(seissol::writer::readReceiverBinaryHeader(stream), std::runtime_error);
+}
+
+} // namespace seissol::unit_test
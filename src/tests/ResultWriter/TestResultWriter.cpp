@@ -1,3 +1,6 @@
 #include "doctest.h"
 
+#include "EnergyOutput.t.h"
+#include "OutputSampler.t.h"
+#include "ReceiverBinaryFormat.t.h"
 #include "ReceiverWriter.t.h"
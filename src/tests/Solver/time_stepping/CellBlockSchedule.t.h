@@ -0,0 +1,83 @@
+#include "doctest.h"
+
+#include "Solver/time_stepping/CellBlockSchedule.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace seissol::unit_test {
+using namespace time_stepping;
+
+TEST_CASE("CellBlockSchedule") {
+  constexpr auto None = CellBlockSchedule::NoNeighbor;
+  // a chain of cells 0 - 2 - 4 - 1 - 3 - 5, stored out of order
+  const std::vector<std::array<unsigned, 4>> neighbors{{2, None, None, None},
+                                                       {4, 3, None, None},
+                                                       {0, 4, None, None},
+                                                       {1, 5, None, None},
+                                                       {2, 1, None, None},
+                                                       {3, None, None, None}};
+
+  SUBCASE("Cells are ordered along the neighbors") {
+    const auto schedule = CellBlockSchedule(neighbors, std::vector<bool>(6, false), 2);
+    REQUIRE(schedule.cells() == std::vector<unsigned>{0, 2, 4, 1, 3, 5});
+    REQUIRE(schedule.numberOfBlocks() == 3);
+    for (std::size_t block = 0; block < schedule.numberOfBlocks(); ++block) {
+      REQUIRE(schedule.blockBegin(block) == 2 * block);
+      REQUIRE(schedule.blockEnd(block) == 2 * block + 2);
+    }
+  }
+
+  const auto dependencies = [](const CellBlockSchedule& schedule, std::size_t block) {
+    return std::vector<std::size_t>(schedule.dependencies().begin() + schedule.dependencyBegin(block),
+                                    schedule.dependencies().begin() + schedule.dependencyEnd(block));
+  };
+
+  SUBCASE("Blocks depend on the blocks of their neighbors") {
+    const auto schedule = CellBlockSchedule(neighbors, std::vector<bool>(6, false), 2);
+    REQUIRE(dependencies(schedule, 0) == std::vector<std::size_t>{0, 1});
+    REQUIRE(dependencies(schedule, 1) == std::vector<std::size_t>{0, 1, 2});
+    REQUIRE(dependencies(schedule, 2) == std::vector<std::size_t>{1, 2});
+  }
+
+  SUBCASE("Only the blocks of neighbors are dependencies") {
+    // a ring of cells 0 - 1 - 2 - 3 - 4 - 5 - 0, traversed as 0, 1, 5, 2, 4, 3
+    const std::vector<std::array<unsigned, 4>> ring{{1, 5, None, None},
+                                                    {0, 2, None, None},
+                                                    {1, 3, None, None},
+                                                    {2, 4, None, None},
+                                                    {3, 5, None, None},
+                                                    {4, 0, None, None}};
+    const auto schedule = CellBlockSchedule(ring, std::vector<bool>(6, false), 1);
+    REQUIRE(schedule.cells() == std::vector<unsigned>{0, 1, 5, 2, 4, 3});
+    REQUIRE(dependencies(schedule, 0) == std::vector<std::size_t>{0, 1, 2});
+    // the block of cell 5 lies in between, but is no dependency
+    REQUIRE(dependencies(schedule, 1) == std::vector<std::size_t>{0, 1, 3});
+    REQUIRE(dependencies(schedule, 5) == std::vector<std::size_t>{3, 4, 5});
+  }
+
+  SUBCASE("Deferred cells are left out of the fused sweep") {
+    std::vector<bool> deferred(6, false);
+    deferred[3] = true;
+    deferred[2] = true;
+    const auto schedule = CellBlockSchedule(neighbors, deferred, 2);
+    REQUIRE(schedule.deferredCells() == std::vector<unsigned>{2, 3});
+    for (std::size_t position = 0; position < schedule.cells().size(); ++position) {
+      REQUIRE(schedule.isFused(position) == !deferred[schedule.cells()[position]]);
+    }
+    // the neighbors of deferred cells do not matter for the fused sweep
+    REQUIRE(dependencies(schedule, 0) == std::vector<std::size_t>{0});
+  }
+
+  SUBCASE("Every cell is scheduled exactly once") {
+    const auto schedule = CellBlockSchedule(neighbors, std::vector<bool>(6, false), 4);
+    auto cells = schedule.cells();
+    std::sort(cells.begin(), cells.end());
+    REQUIRE(cells == std::vector<unsigned>{0, 1, 2, 3, 4, 5});
+    REQUIRE(schedule.numberOfBlocks() == 2);
+    REQUIRE(schedule.blockEnd(1) == 6);
+  }
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,65 @@
+#include "doctest.h"
+
+#include "Solver/time_stepping/CopyRegionSchedule.h"
+#include "Solver/time_stepping/GhostRegionReadiness.h"
+
+#include <array>
+#include <vector>
+
+namespace seissol::unit_test {
+using namespace time_stepping;
+
+TEST_CASE("CopyRegionSchedule") {
+  constexpr auto None = CopyRegionSchedule::NoRegion;
+  // two copy regions with two cells each; cell 1 also needs data from ghost region 1
+  const std::vector<unsigned> regionSizes{2, 2};
+  const std::vector<std::array<unsigned, 4>> ghostRegions{{0, None, None, None},
+                                                          {0, 1, None, None},
+                                                          {1, None, None, None},
+                                                          {None, 1, 1, None}};
+
+  SUBCASE("Regions depend on the ghost regions of their faces") {
+    const auto schedule =
+        CopyRegionSchedule(regionSizes, ghostRegions, std::vector<bool>(4, false));
+    REQUIRE(schedule.numberOfRegions() == 2);
+    REQUIRE(schedule.dependencies(0) == std::vector<unsigned>{0, 1});
+    REQUIRE(schedule.dependencies(1) == std::vector<unsigned>{1});
+    REQUIRE(schedule.cells(0) == std::vector<unsigned>{0, 1});
+    REQUIRE(schedule.cells(1) == std::vector<unsigned>{2, 3});
+  }
+
+  SUBCASE("Deferred cells are always left to the regular integration") {
+    std::vector<bool> deferred(4, false);
+    deferred[2] = true;
+    const auto schedule = CopyRegionSchedule(regionSizes, ghostRegions, deferred);
+    REQUIRE(schedule.cells(1) == std::vector<unsigned>{3});
+    REQUIRE(schedule.remainingCells({true, true}) == std::vector<unsigned>{2});
+  }
+
+  SUBCASE("Remaining cells exclude the integrated regions") {
+    const auto schedule =
+        CopyRegionSchedule(regionSizes, ghostRegions, std::vector<bool>(4, false));
+    REQUIRE(schedule.remainingCells({false, false}) == std::vector<unsigned>{0, 1, 2, 3});
+    REQUIRE(schedule.remainingCells({false, true}) == std::vector<unsigned>{0, 1});
+    REQUIRE(schedule.remainingCells({true, true}).empty());
+  }
+}
+
+TEST_CASE("GhostRegionReadiness") {
+  GhostRegionReadiness readiness(2);
+  REQUIRE(!readiness.isReady(0, 1.0, 1));
+
+  readiness.markReceived(0, 1.0, 2, false);
+  REQUIRE(readiness.isReady(0, 1.0, 1));
+  REQUIRE(readiness.isReady(0, 1.0, 2));
+  REQUIRE(!readiness.isReady(0, 1.0, 3));
+  REQUIRE(!readiness.isReady(1, 1.0, 1));
+  // data of another sync interval
+  REQUIRE(!readiness.isReady(0, 2.0, 1));
+
+  // the last receive before the sync point covers all remaining steps
+  readiness.markReceived(1, 1.0, 4, true);
+  REQUIRE(readiness.isReady(1, 1.0, 6));
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,84 @@
+#include "doctest.h"
+
+#include "Parallel/MPI.h"
+#include "Solver/time_stepping/MessageAggregator.h"
+
+#include <vector>
+
+namespace seissol::unit_test {
+using namespace time_stepping;
+
+TEST_CASE("MessageAggregator") {
+  const int rank = seissol::MPI::mpi.rank();
+  MessageAggregator aggregator;
+  aggregator.addParticipant();
+  aggregator.addParticipant();
+
+  std::vector<real> first{1, 2, 3};
+  std::vector<real> second{4, 5};
+  aggregator.send(rank, 7, first.data(), first.size());
+  aggregator.send(rank, 8, second.data(), second.size());
+
+  // the regions are only packed once all participants have acted
+  aggregator.endTurn();
+  REQUIRE(aggregator.isSendPending(rank, 7));
+  aggregator.endTurn();
+  REQUIRE(!aggregator.isSendPending(rank, 7));
+  REQUIRE(!aggregator.isSendPending(rank, 8));
+
+  // the copy regions may be overwritten after packing
+  first.assign(3, 0);
+  aggregator.send(rank, 7, first.data(), first.size());
+  aggregator.endTurn();
+  aggregator.endTurn();
+
+  std::vector<real> ghostFirst(3);
+  std::vector<real> ghostSecond(2);
+  while (!aggregator.receive(rank, 8, ghostSecond.data(), ghostSecond.size())) {
+    aggregator.progress();
+  }
+  REQUIRE(ghostSecond == std::vector<real>{4, 5});
+
+  // the data of a region is handed out in the order it was sent
+  while (!aggregator.receive(rank, 7, ghostFirst.data(), ghostFirst.size())) {
+    aggregator.progress();
+  }
+  REQUIRE(ghostFirst == std::vector<real>{1, 2, 3});
+  while (!aggregator.receive(rank, 7, ghostFirst.data(), ghostFirst.size())) {
+    aggregator.progress();
+  }
+  REQUIRE(ghostFirst == std::vector<real>{0, 0, 0});
+  REQUIRE(!aggregator.receive(rank, 7, ghostFirst.data(), ghostFirst.size()));
+
+  aggregator.finalize();
+}
+
+TEST_CASE("MessageAggregator in single precision") {
+  const int rank = seissol::MPI::mpi.rank();
+  MessageAggregator aggregator(true);
+  aggregator.addParticipant();
+
+  const std::vector<real> first{1.0 / 3.0, -2.0};
+  const std::vector<real> second{1e-3, 5.0, 0.1};
+  aggregator.send(rank, 1, first.data(), first.size());
+  aggregator.send(rank, 2, second.data(), second.size());
+  aggregator.endTurn();
+
+  // both regions are unpacked from the same message
+  std::vector<real> ghostSecond(3);
+  while (!aggregator.receive(rank, 2, ghostSecond.data(), ghostSecond.size())) {
+    aggregator.progress();
+  }
+  std::vector<real> ghostFirst(2);
+  REQUIRE(aggregator.receive(rank, 1, ghostFirst.data(), ghostFirst.size()));
+  for (std::size_t i = 0; i < first.size(); ++i) {
+    REQUIRE(ghostFirst[i] == static_cast<real>(static_cast<float>(first[i])));
+  }
+  for (std::size_t i = 0; i < second.size(); ++i) {
+    REQUIRE(ghostSecond[i] == static_cast<real>(static_cast<float>(second[i])));
+  }
+
+  aggregator.finalize();
+}
+
+} // namespace seissol::unit_test
@@ -0,0 +1,188 @@
+#include "doctest.h"
+
+#include "Solver/time_stepping/SinglePrecisionRegions.h"
+
+#include "Initializer/Typedefs.h"
+#include "Numerical/Quadrature.h"
+#include "Parallel/MPI.h"
+#include "Solver/time_stepping/DirectGhostTimeCluster.h"
+
+#ifdef USE_ELASTIC
+#include "Physics/InitialField.h"
+#endif
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace seissol::unit_test {
+using namespace time_stepping;
+
+/**
+ * Exchanges the copy region of a rank with itself, through the send and receive path of the
+ * ghost clusters.
+ */
+class SelfGhostTimeCluster : public DirectGhostTimeCluster {
+  public:
+  using DirectGhostTimeCluster::DirectGhostTimeCluster;
+
+  void exchange() {
+    receiveGhostLayer();
+    sendCopyLayer();
+    while (!testForGhostLayerReceives()) {
+    }
+    while (!testForCopyLayerSends()) {
+    }
+  }
+};
+
+//! sends one copy region of this rank to its own ghost region
+inline void exchangeWithSelf(std::vector<real>& copy,
+                             std::vector<real>& ghost,
+                             bool persistent,
+                             bool singlePrecision) {
+  const int rank = seissol::MPI::mpi.rank();
+  int neighboringClusters[1][2] = {{rank, 1}};
+  real* copyRegions[1] = {copy.data()};
+  real* ghostRegions[1] = {ghost.data()};
+  unsigned int regionSizes[1] = {static_cast<unsigned int>(copy.size())};
+  int identifiers[1] = {5};
+  MPI_Request sendRequests[1];
+  MPI_Request receiveRequests[1];
+
+  MeshStructure meshStructure{};
+  meshStructure.numberOfRegions = 1;
+  meshStructure.neighboringClusters = neighboringClusters;
+  meshStructure.copyRegions = copyRegions;
+  meshStructure.ghostRegions = ghostRegions;
+  meshStructure.copyRegionSizes = regionSizes;
+  meshStructure.ghostRegionSizes = regionSizes;
+  meshStructure.sendIdentifiers = identifiers;
+  meshStructure.receiveIdentifiers = identifiers;
+  meshStructure.sendRequests = sendRequests;
+  meshStructure.receiveRequests = receiveRequests;
+
+  SelfGhostTimeCluster cluster(1.0, 1, 0, 1, &meshStructure, persistent, singlePrecision);
+  cluster.exchange();
+  cluster.finalize();
+}
+
+TEST_CASE("SinglePrecisionRegions") {
+  SUBCASE("Regions are rounded to single precision") {
+    auto regions = SinglePrecisionRegions({3, 0, 2});
+    REQUIRE(regions.size(0) == 3);
+    REQUIRE(regions.size(1) == 0);
+    REQUIRE(regions.size(2) == 2);
+
+    const std::vector<real> copy{1.0, 0.1, -1e-20};
+    regions.pack(0, copy.data());
+    std::vector<real> ghost(3);
+    regions.unpack(0, ghost.data());
+    for (std::size_t i = 0; i < copy.size(); ++i) {
+      REQUIRE(ghost[i] == static_cast<real>(static_cast<float>(copy[i])));
+    }
+  }
+
+  SUBCASE("Ghost clusters transfer the copy regions in single precision") {
+    for (const bool persistent : {false, true}) {
+      for (const bool singlePrecision : {false, true}) {
+        // one region which this rank sends to itself
+        std::vector<real> copy{1.0, 0.1, -1.0 / 3.0, 3.14159265358979, 1e-20, 123456789.123};
+        const std::vector<real> copyBefore = copy;
+        std::vector<real> ghost(copy.size(), 0);
+        exchangeWithSelf(copy, ghost, persistent, singlePrecision);
+
+        // the rank keeps its own data in full precision
+        REQUIRE(copy == copyBefore);
+        bool rounded = false;
+        for (std::size_t i = 0; i < copy.size(); ++i) {
+          if (singlePrecision) {
+            REQUIRE(ghost[i] == static_cast<real>(static_cast<float>(copy[i])));
+          } else {
+            REQUIRE(ghost[i] == copy[i]);
+          }
+          rounded = rounded || ghost[i] != copy[i];
+        }
+        // (for double precision, the values above are not representable in single precision)
+        REQUIRE(rounded == (singlePrecision && sizeof(real) > sizeof(float)));
+      }
+    }
+  }
+
+#ifdef USE_ELASTIC
+  SUBCASE("Single-precision transfers keep the planar wave error norm") {
+    // the setup of the planar wave convergence test
+    const double materialValues[3] = {1.0, 1.0, 2.0};
+    CellMaterialData materialData;
+    materialData.local = model::ElasticMaterial(materialValues, 3);
+    const physics::Planarwave planarwave(materialData);
+
+    std::vector<std::array<double, 3>> points;
+    constexpr int PointsPerDimension = 4;
+    for (int i = 0; i < PointsPerDimension; ++i) {
+      for (int j = 0; j < PointsPerDimension; ++j) {
+        for (int k = 0; k < PointsPerDimension; ++k) {
+          points.push_back({static_cast<double>(i) / PointsPerDimension,
+                            static_cast<double>(j) / PointsPerDimension,
+                            static_cast<double>(k) / PointsPerDimension});
+        }
+      }
+    }
+    constexpr auto NumQuantities = model::MaterialT::NumQuantities;
+    const std::size_t numValues = points.size() * NumQuantities;
+
+    // integrates the planar wave over a time step with a Gauss-Legendre rule; with the given
+    // transfer, the neighbor receives the values at the quadrature points through its ghost region
+    constexpr double StartTime = 0.1;
+    constexpr double TimeStep = 0.2;
+    const auto integrate = [&](unsigned numTimePoints, auto&& transfer) {
+      std::vector<double> timePoints(numTimePoints);
+      std::vector<double> timeWeights(numTimePoints);
+      seissol::quadrature::GaussLegendre(timePoints.data(), timeWeights.data(), numTimePoints);
+
+      std::vector<real> copy(numTimePoints * numValues);
+      for (unsigned t = 0; t < numTimePoints; ++t) {
+        auto view = yateto::DenseTensorView<2, real, unsigned>(
+            copy.data() + t * numValues, {static_cast<unsigned>(points.size()), NumQuantities});
+        const double time = StartTime + TimeStep * (timePoints[t] + 1) / 2;
+        planarwave.evaluate(time, points, materialData, view);
+      }
+      std::vector<real> ghost(copy.size(), 0);
+      transfer(copy, ghost);
+
+      std::vector<double> integrated(numValues, 0);
+      for (unsigned t = 0; t < numTimePoints; ++t) {
+        for (std::size_t i = 0; i < numValues; ++i) {
+          integrated[i] += TimeStep / 2 * timeWeights[t] * ghost[t * numValues + i];
+        }
+      }
+      return integrated;
+    };
+
+    const auto reference = integrate(12, [](const auto& copy, auto& ghost) { ghost = copy; });
+
+    // (three quadrature points give the order 6 of the convergence test)
+    std::array<double, 2> errors{};
+    for (const bool singlePrecision : {false, true}) {
+      const auto integrated = integrate(3, [&](auto& copy, auto& ghost) {
+        exchangeWithSelf(copy, ghost, false, singlePrecision);
+      });
+      double error = 0;
+      for (std::size_t i = 0; i < numValues; ++i) {
+        error = std::max(error, std::abs(integrated[i] - reference[i]));
+      }
+      errors[singlePrecision ? 1 : 0] = error;
+    }
+
+    // the error norm is in the range of the finest mesh of the convergence test (about 5e-5)
+    REQUIRE(errors[0] > 1e-6);
+    REQUIRE(errors[0] < 1e-3);
+    // with single-precision transfers, the error norm may change by at most 1%
+    constexpr double Tolerance = 1e-2;
+    REQUIRE(std::abs(errors[1] - errors[0]) <= Tolerance * errors[0]);
+  }
+#endif
+}
+
+} // namespace seissol::unit_test
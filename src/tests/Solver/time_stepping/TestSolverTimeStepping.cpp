@@ -2,3 +2,7 @@
 #include <doctest/trompeloeil.hpp>
 
 #include "AbstractTimeCluster.t.h"
+#include "CellBlockSchedule.t.h"
+#include "CopyRegionSchedule.t.h"
+#include "MessageAggregator.t.h"
+#include "SinglePrecisionRegions.t.h"